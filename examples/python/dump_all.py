@@ -15,7 +15,7 @@ except ImportError:
 RD_HOST = "192.168.4.177"
 
 c = ModbusClient(host=RD_HOST, port=502, unit_id=1, auto_open=True, timeout=2)
-nr = 16
+nr = 125  # The dongle splits larger reads for the power supply
 print("address;value")
 for a in range(0, 1023, nr):
     regs = c.read_holding_registers(a, reg_nb=nr)
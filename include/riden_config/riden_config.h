@@ -6,6 +6,22 @@
 
 #include <Arduino.h>
 
+#ifndef DEFAULT_MODBUS_CACHE_MAX_AGE
+#define DEFAULT_MODBUS_CACHE_MAX_AGE 0 // milliseconds, 0 disables the cache
+#endif
+#ifndef DEFAULT_MODBUS_RTU_OVER_TCP_PORT
+#define DEFAULT_MODBUS_RTU_OVER_TCP_PORT 0 // 0 disables the listener
+#endif
+#ifndef DEFAULT_MODBUS_UDP_PORT
+#define DEFAULT_MODBUS_UDP_PORT 0 // 0 disables the listener
+#endif
+#ifndef DEFAULT_CLIENT_RATE_LIMIT
+#define DEFAULT_CLIENT_RATE_LIMIT 0 // requests/second per client, 0 disables rate limiting
+#endif
+#ifndef DEFAULT_CLIENT_BURST
+#define DEFAULT_CLIENT_BURST 10 // requests
+#endif
+
 namespace RidenDongle
 {
 
@@ -31,11 +47,26 @@ class RidenConfig
     bool get_and_reset_config_portal_on_boot();
     uint32_t get_uart_baudrate();
     void set_uart_baudrate(uint32_t baudrate);
+    uint32_t get_modbus_cache_max_age();
+    void set_modbus_cache_max_age(uint32_t max_age);
+    uint16_t get_modbus_rtu_over_tcp_port();
+    void set_modbus_rtu_over_tcp_port(uint16_t port);
+    uint16_t get_modbus_udp_port();
+    void set_modbus_udp_port(uint16_t port);
+    uint16_t get_client_rate_limit();
+    void set_client_rate_limit(uint16_t rate_limit);
+    uint16_t get_client_burst();
+    void set_client_burst(uint16_t burst);
 
   private:
     String tz_name = "";
     bool config_portal_on_boot = false;
     uint32_t uart_baudrate = DEFAULT_UART_BAUDRATE;
+    uint32_t modbus_cache_max_age = DEFAULT_MODBUS_CACHE_MAX_AGE;
+    uint16_t modbus_rtu_over_tcp_port = DEFAULT_MODBUS_RTU_OVER_TCP_PORT;
+    uint16_t modbus_udp_port = DEFAULT_MODBUS_UDP_PORT;
+    uint16_t client_rate_limit = DEFAULT_CLIENT_RATE_LIMIT;
+    uint16_t client_burst = DEFAULT_CLIENT_BURST;
 };
 
 extern RidenConfig riden_config;
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Large enough for any int32_t with sign, decimal point and terminator
+#define FIXED_BUFFER_LENGTH 16
+#define FIXED_MAX_DECIMALS 9
+
+namespace RidenDongle
+{
+
+/**
+ * @brief Print a scaled integer as a decimal number, e.g. 5020 mV with
+ *        3 decimals as "5.020".
+ *
+ * Uses integer arithmetic only and writes into the caller's buffer.
+ *
+ * @param size Size of `buffer`, at least `FIXED_BUFFER_LENGTH` for any value.
+ * @param decimals Number of decimals, at most `FIXED_MAX_DECIMALS`.
+ * @return Number of characters written, excluding the terminator, or 0 if
+ *         the buffer is too small.
+ */
+size_t format_scaled(char *buffer, const size_t size, const int32_t value, const uint8_t decimals);
+
+/**
+ * @brief Print `value` rounded to `decimals` decimals.
+ *
+ * The value is scaled and rounded once, then printed by `format_scaled()`.
+ *
+ * @return Number of characters written, excluding the terminator.
+ */
+size_t format_fixed(char *buffer, const size_t size, const double value, const uint8_t decimals);
+
+} // namespace RidenDongle
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace RidenDongle
+{
+
+/**
+ * @brief Writes JSON into a caller-supplied buffer, without allocating.
+ *
+ * Commas are inserted between members and elements. Writing past the end
+ * of the buffer marks the writer as failed; the text is then truncated
+ * but still terminated.
+ */
+class JsonWriter
+{
+  public:
+    JsonWriter(char *buffer, const size_t size);
+
+    JsonWriter &begin_object();
+    JsonWriter &end_object();
+    JsonWriter &begin_array();
+    JsonWriter &end_array();
+
+    /**
+     * @brief Name of the next member of an object.
+     */
+    JsonWriter &key(const char *name);
+
+    JsonWriter &boolean(const bool value);
+    JsonWriter &null();
+    JsonWriter &number(const int32_t value);
+
+    /**
+     * @brief Number with a fixed number of decimals, see `format_fixed()`.
+     *        null if the value is not finite or cannot be formatted.
+     */
+    JsonWriter &fixed(const double value, const uint8_t decimals);
+
+    /**
+     * @brief String, escaped as needed.
+     */
+    JsonWriter &string(const char *value);
+
+    const char *c_str() { return buffer; }
+    size_t length() { return position; }
+    bool failed() { return overflow; }
+
+  private:
+    char *buffer;
+    size_t size;
+    size_t position = 0;
+    bool need_separator = false;
+    bool overflow = false;
+
+    void separate();
+    void raw(const char *text, const size_t length);
+    void raw(const char c);
+};
+
+} // namespace RidenDongle
@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <riden_scpi/riden_scpi.h>
+
+#include <ESP8266WiFi.h>
+#include <list>
+
+#define HISLIP_PORT 4880
+#define HISLIP_MAX_SESSIONS 2
+#define HISLIP_MAX_PENDING_CONNECTIONS 4 // Connections not yet initialized as a sync or async channel
+#define HISLIP_INITIALIZE_TIMEOUT 5000   // milliseconds for a new connection to send its first message
+#define HISLIP_HEADER_LENGTH 16
+#define HISLIP_MAX_MESSAGE_SIZE 1024 // Largest command accepted, announced by AsyncMaximumMessageSize
+#define HISLIP_SHORT_PAYLOAD 64      // Payload kept of messages other than Data and DataEnd
+#define HISLIP_SEND_CHUNK 256        // Response bytes sent per Data message
+#define HISLIP_VERSION 0x0200        // Protocol version 2.0
+#define HISLIP_VENDOR_ID 0x5244      // "RD"
+#define HISLIP_INITIAL_MESSAGE_ID 0xffffff00
+
+namespace RidenDongle
+{
+
+/**
+ * @brief HiSLIP message types, see IVI-6.1 section 6.
+ */
+enum class HiSlipMessageType : uint8_t {
+    Initialize = 0,
+    InitializeResponse = 1,
+    FatalError = 2,
+    Error = 3,
+    AsyncLock = 4,
+    AsyncLockResponse = 5,
+    Data = 6,
+    DataEnd = 7,
+    DeviceClearComplete = 8,
+    DeviceClearAcknowledge = 9,
+    AsyncRemoteLocalControl = 10,
+    AsyncRemoteLocalResponse = 11,
+    Trigger = 12,
+    Interrupted = 13,
+    AsyncInterrupted = 14,
+    AsyncMaximumMessageSize = 15,
+    AsyncMaximumMessageSizeResponse = 16,
+    AsyncInitialize = 17,
+    AsyncInitializeResponse = 18,
+    AsyncDeviceClear = 19,
+    AsyncServiceRequest = 20,
+    AsyncStatusQuery = 21,
+    AsyncStatusResponse = 22,
+    AsyncDeviceClearAcknowledge = 23,
+    AsyncLockInfo = 24,
+    AsyncLockInfoResponse = 25,
+};
+
+/**
+ * @brief Convert HiSlipMessageType to uint8_t.
+ *
+ * @param type The message type.
+ * @return The uint8_t.
+ */
+constexpr uint8_t operator+(HiSlipMessageType type) noexcept
+{
+    return static_cast<uint8_t>(type);
+}
+
+/**
+ * @brief Control codes of FatalError.
+ */
+enum class HiSlipFatalError : uint8_t {
+    PoorlyFormedHeader = 1,
+    InvalidInitialization = 3,
+    MaximumClientsExceeded = 4,
+};
+
+/**
+ * @brief Control codes of Error.
+ */
+enum class HiSlipError : uint8_t {
+    UnrecognizedMessageType = 1,
+    MessageTooLarge = 4,
+};
+
+constexpr uint8_t operator+(HiSlipFatalError error) noexcept
+{
+    return static_cast<uint8_t>(error);
+}
+
+constexpr uint8_t operator+(HiSlipError error) noexcept
+{
+    return static_cast<uint8_t>(error);
+}
+
+/**
+ * @brief A message being received on a channel.
+ */
+struct HiSlipReader {
+    uint8_t header[HISLIP_HEADER_LENGTH];
+    uint8_t header_length = 0;
+    uint64_t payload_left = 0;   // Bytes of the payload still to come
+    uint32_t payload_length = 0; // Bytes of the payload kept
+    bool overflow = false;       // Some of the payload did not fit and was dropped
+
+    HiSlipMessageType type() { return HiSlipMessageType(header[2]); }
+    uint8_t control() { return header[3]; }
+    uint32_t parameter();
+    void reset();
+};
+
+/**
+ * @brief A connection which has not yet sent Initialize or AsyncInitialize.
+ */
+struct HiSlipPendingConnection {
+    WiFiClient client;
+    HiSlipReader reader;
+    uint8_t payload[HISLIP_SHORT_PAYLOAD];
+    unsigned long accepted_at = 0;
+};
+
+/**
+ * @brief A HiSLIP client, with its synchronous and asynchronous channel
+ *        and a SCPI session of its own.
+ */
+struct HiSlipSession {
+    bool used = false;
+    uint16_t id = 0;
+    int handle = -1; // See RidenScpi::claim_external_control()
+    WiFiClient sync;
+    WiFiClient async;
+    bool has_async = false;
+    HiSlipReader sync_reader;
+    HiSlipReader async_reader;
+    uint8_t async_payload[HISLIP_SHORT_PAYLOAD];
+
+    bool overlapped = true;
+    bool clearing = false;   // Between AsyncDeviceClear and DeviceClearComplete
+    bool responding = false; // Sending the response to message_id
+    uint32_t message_id = HISLIP_INITIAL_MESSAGE_ID;
+    bool srq_asserted = false;
+
+    bool shared_lock = false; // Holds the shared lock, see RidenHiSlip::shared_lock_name
+    bool lock_waiting = false; // For the lock requested by the AsyncLock in async_reader
+    unsigned long lock_requested_at = 0;
+    uint32_t lock_timeout = 0;
+
+    uint32_t input_length = 0; // Of the command collected from Data messages
+    bool input_overflow = false;
+    bool command_pending = false; // Input is complete and waits for the rate limit, see execute_command()
+    unsigned long command_received_at = 0;
+    char input[HISLIP_MAX_MESSAGE_SIZE];
+};
+
+/**
+ * @brief HiSLIP 2.0 server, sharing the SCPI engine with the raw socket
+ *        and VXI-11 servers.
+ *
+ * Responses are sent as they are produced, tagged with the MessageID of
+ * the command they answer, so both overlapped and synchronized mode are
+ * served. Locks only apply among HiSLIP clients.
+ */
+class RidenHiSlip
+{
+  public:
+    explicit RidenHiSlip(RidenScpi &ridenScpi, uint16_t port = HISLIP_PORT) : ridenScpi(ridenScpi), tcpServer(port) {}
+
+    bool begin();
+    bool loop();
+
+    uint16_t port();
+    std::list<IPAddress> get_connected_clients();
+    void disconnect_client(const IPAddress &ip);
+    const char *get_visa_resource();
+
+  private:
+    RidenScpi &ridenScpi;
+    WiFiServer tcpServer;
+    bool initialized = false;
+
+    HiSlipPendingConnection pending[HISLIP_MAX_PENDING_CONNECTIONS];
+    HiSlipSession sessions[HISLIP_MAX_SESSIONS];
+    uint16_t next_session_id = 1;
+
+    int8_t lock_owner = -1; // Index of the session holding the exclusive lock
+    char shared_lock_name[HISLIP_SHORT_PAYLOAD];
+    uint8_t shared_lock_name_length = 0;
+
+    // Header followed by response data, sent as one write
+    uint8_t send_buffer[HISLIP_HEADER_LENGTH + HISLIP_SEND_CHUNK];
+
+    void accept_connections();
+    void initialize_connection(HiSlipPendingConnection &connection);
+    void close_session(HiSlipSession &session);
+    void handle_sync_message(HiSlipSession &session);
+    void execute_command(HiSlipSession &session);
+    void handle_async_message(HiSlipSession &session);
+    void handle_lock(HiSlipSession &session);
+    void check_lock_request(HiSlipSession &session);
+    void check_service_request(HiSlipSession &session);
+    void send_response(HiSlipSession &session);
+
+    bool try_lock(HiSlipSession &session, bool shared, const char *name, uint8_t name_length);
+    bool is_locked_out(HiSlipSession &session);
+    uint8_t session_index(HiSlipSession &session);
+
+    bool receive(WiFiClient &client, HiSlipReader &reader, uint8_t *payload, uint32_t capacity);
+    void send_message(WiFiClient &client, HiSlipMessageType type, uint8_t control, uint32_t parameter,
+                      const uint8_t *payload = nullptr, uint32_t length = 0);
+};
+
+} // namespace RidenDongle
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <riden_hislip/riden_hislip.h>
 #include <riden_modbus/riden_modbus.h>
 #include <riden_modbus_bridge/riden_modbus_bridge.h>
 #include <riden_scpi/riden_scpi.h>
@@ -12,14 +13,27 @@
 #include <ESP8266WebServer.h>
 
 #define HTTP_RAW_PORT 80
+#define EVENTS_MAX_SUBSCRIBERS 4
+#define EVENTS_DEFAULT_INTERVAL 1000 // milliseconds
+#define EVENTS_MIN_INTERVAL RIDEN_POLL_INTERVAL // Events follow the background poll
+#define EVENTS_MAX_INTERVAL 60000
 
 namespace RidenDongle
 {
 
+/**
+ * @brief A page following the telemetry pushed by /events.
+ */
+struct EventSubscriber {
+    WiFiClient client;
+    uint16_t interval = 0; // milliseconds, 0 if the slot is free
+    unsigned long sent_at = 0;
+};
+
 class RidenHttpServer
 {
   public:
-    explicit RidenHttpServer(RidenModbus &modbus, RidenScpi &scpi, RidenModbusBridge &bridge, VXI_Server &vxi_server) : modbus(modbus), scpi(scpi), bridge(bridge), vxi_server(vxi_server), server(HTTP_RAW_PORT) {}
+    explicit RidenHttpServer(RidenModbus &modbus, RidenScpi &scpi, RidenModbusBridge &bridge, VXI_Server &vxi_server, RidenHiSlip &hislip) : modbus(modbus), scpi(scpi), bridge(bridge), vxi_server(vxi_server), hislip(hislip), server(HTTP_RAW_PORT) {}
     bool begin();
     void loop(void);
     uint16_t port();
@@ -29,8 +43,12 @@ class RidenHttpServer
     RidenScpi &scpi;
     RidenModbusBridge &bridge;
     VXI_Server &vxi_server;
+    RidenHiSlip &hislip;
     ESP8266WebServer server;
 
+    EventSubscriber subscribers[EVENTS_MAX_SUBSCRIBERS];
+    uint32_t events_poll_count = 0; // Background poll the last events were made from
+
     void handle_root_get();
     void handle_psu_get();
     void handle_config_get();
@@ -46,6 +64,8 @@ class RidenHttpServer
     void handle_set_i();
     void handle_set_v();
     void handle_toggle_out();
+    void handle_events_get();
+    void push_events();
     
     void handle_modbus_qps();
     void send_redirect_root();
@@ -56,8 +76,10 @@ class RidenHttpServer
     void send_services();
     void send_power_supply_info();
     void send_connected_clients();
+    void send_client_statistics();
 
     void send_as_chunks(const char *str);
+    void send_gzip(const char *content_type, const uint8_t *content, size_t length, const char *etag);
     void send_info_row(const String key, const String value);
     void send_client_row(const IPAddress &ip, const String protocol);
 
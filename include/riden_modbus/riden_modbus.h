@@ -5,6 +5,10 @@
 #pragma once
 
 #include "riden_modbus_registers.h"
+#include "riden_register_cache.h"
+#include "riden_sample_log.h"
+#include "riden_scheduler.h"
+#include "riden_sequencer.h"
 
 #include <ModbusRTU.h>
 #include <WString.h>
@@ -13,6 +17,20 @@
 
 #define MODBUS_ADDRESS 1
 #define NUMBER_OF_PRESETS 9
+// Reading more registers at once fails silently
+#define RIDEN_MAX_REGISTERS_PER_READ 20
+// How often the output is sampled in the background
+#define RIDEN_POLL_INTERVAL 500 // milliseconds
+#define RIDEN_POLL_FIRST_REGISTER Register::SystemTemperatureCelsius_Sign
+#define RIDEN_POLL_REGISTERS (+Register::CurrentRange - +RIDEN_POLL_FIRST_REGISTER + 1)
+// Battery, probe temperature and counters change slowly, and are polled
+// after every RIDEN_SLOW_POLL_EVERY polls of the output
+#define RIDEN_SLOW_POLL_EVERY 2
+#define RIDEN_SLOW_POLL_FIRST_REGISTER Register::BatteryMode
+#define RIDEN_SLOW_POLL_REGISTERS (+Register::WH_L - +RIDEN_SLOW_POLL_FIRST_REGISTER + 1)
+// Polled values older than this are not used by get_polled_values()
+#define RIDEN_POLL_MAX_AGE (3 * RIDEN_POLL_INTERVAL)
+#define RIDEN_SLOW_POLL_MAX_AGE (3 * RIDEN_SLOW_POLL_EVERY * RIDEN_POLL_INTERVAL)
 
 namespace RidenDongle
 {
@@ -80,6 +98,51 @@ struct AllValues {
     Preset presets[NUMBER_OF_PRESETS];
 };
 
+/**
+ * @brief Output measurements, read in a single transaction.
+ */
+struct Measurements {
+    double voltage_out;
+    double current_out;
+    double power_out;
+};
+
+/**
+ * @brief Output measurements with state, temperatures and accumulated
+ *        capacity and energy.
+ */
+struct ExtendedMeasurements {
+    double voltage_out;
+    double current_out;
+    double power_out;
+    OutputMode output_mode;
+    Protection protection;
+    double system_temperature_celsius;
+    double probe_temperature_celsius;
+    double ah;
+    double wh;
+};
+
+/**
+ * @brief Transaction statistics for the serial connection.
+ *
+ * Latencies are in milliseconds and only cover successful transactions.
+ */
+struct ModbusStatistics {
+    uint32_t transactions = 0;
+    uint32_t failures = 0;
+    uint32_t total_latency = 0;
+    uint16_t last_latency = 0;
+    uint16_t min_latency = 0;
+    uint16_t max_latency = 0;
+
+    uint16_t average_latency()
+    {
+        uint32_t successes = transactions - failures;
+        return (successes == 0) ? 0 : total_latency / successes;
+    }
+};
+
 /**
  * @brief Serial modbus connection to Riden power supply.
  */
@@ -96,6 +159,31 @@ class RidenModbus
     String get_type();
     bool get_all_values(AllValues &all_values, bool subset = false);
 
+    /**
+     * @brief Fill the subset of `get_all_values()` from the background poll,
+     *        without touching the bus.
+     *
+     * @return false if the polled values are missing or too old.
+     */
+    bool get_polled_values(AllValues &all_values);
+
+    /**
+     * @brief Number of background polls of the output completed so far, to
+     *        tell when `get_polled_values()` has something new.
+     */
+    uint32_t get_poll_count() { return poll_count; }
+
+    /**
+     * @brief Read output voltage, current and power in one transaction.
+     */
+    bool get_measurements(Measurements &measurements);
+
+    /**
+     * @brief Read extended measurements in two transactions, one for
+     *        registers 4-17 and one for registers 34-41.
+     */
+    bool get_extended_measurements(ExtendedMeasurements &measurements);
+
     bool get_id(uint16_t &id);
     bool get_serial_number(uint32_t &serial_number);
     bool get_firmware_version(uint16_t &firmware_version);
@@ -109,6 +197,11 @@ class RidenModbus
     bool get_current_set(double &current);
     bool set_current_set(const double current);
 
+    /**
+     * @brief Set voltage and current in a single transaction.
+     */
+    bool set_voltage_and_current_set(const double voltage, const double current);
+
     bool get_voltage_out(double &voltage);
     bool get_current_out(double &current);
 
@@ -277,6 +370,35 @@ class RidenModbus
     bool write_holding_register(const Register reg, const uint16_t value);
     bool write_holding_registers(const Register reg, uint16_t *value, uint16_t numregs = 1);
 
+    // Register Cache
+    /**
+     * @brief Retrieve registers from the cache without touching the bus.
+     *
+     * @param max_age Maximum age in milliseconds of the cached values.
+     * @return true if all registers were cached and fresh enough.
+     */
+    bool read_cached_holding_registers(const uint16_t offset, uint16_t *value, const uint16_t numregs, const unsigned long max_age);
+    void update_cached_holding_registers(const uint16_t offset, const uint16_t *value, const uint16_t numregs);
+    void invalidate_cached_holding_registers();
+
+    // Statistics
+    ModbusStatistics &get_statistics() { return statistics; }
+
+    /**
+     * @brief Output samples collected in the background by `loop()`.
+     */
+    SampleLog &get_sample_log() { return sample_log; }
+
+    /**
+     * @brief Rate limiting and fair sharing of the power supply between clients.
+     */
+    RidenScheduler &get_scheduler() { return scheduler; }
+
+    /**
+     * @brief Setpoint lists run by `loop()`.
+     */
+    RidenSequencer &get_sequencer() { return sequencer; }
+
     double get_max_voltage() { return v_max; }
     double get_max_current() { return i_max; }
 
@@ -285,6 +407,22 @@ class RidenModbus
     unsigned long timeout = 500; // milliseconds
     bool initialized = false;
     String type;
+    RegisterCache register_cache;
+    ModbusStatistics statistics;
+    SampleLog sample_log;
+    RidenScheduler scheduler;
+    RidenSequencer sequencer;
+
+    // Background polling of the output
+    bool polling = false;
+    bool polling_slow = false; // The poll in progress is of the slow registers
+    bool slow_poll_due = false;
+    uint8_t polls_since_slow = 0;
+    uint32_t poll_count = 0;
+    unsigned long poll_started_at = 0;
+    unsigned long slow_poll_started_at = 0;
+    uint16_t poll_values[RIDEN_POLL_REGISTERS];
+    uint16_t slow_poll_values[RIDEN_SLOW_POLL_REGISTERS];
 
     double v_multi = 100.0;
     double i_multi = 100.0;
@@ -300,6 +438,11 @@ class RidenModbus
      */
     bool wait_for_inactive();
 
+    void start_poll(const bool slow);
+    void finish_poll();
+    void decode_values(const uint16_t *values, AllValues &all_values);
+    void record_transaction(const unsigned long started_at, const bool success);
+
     bool read_voltage(const Register reg, double &voltage);
     bool write_voltage(const Register reg, double voltage);
     bool read_current(const Register reg, double &current);
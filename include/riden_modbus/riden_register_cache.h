@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "riden_modbus_registers.h"
+
+#include <stdint.h>
+
+// Covers everything up to and including the presets.
+#define REGISTER_CACHE_SIZE (+Register::M9_OCP + 1)
+
+namespace RidenDongle
+{
+
+/**
+ * @brief Most recently read or written value of each holding register.
+ *
+ * Every register carries the time it was last seen on the bus, so
+ * readers can decide for themselves how old a value may be.
+ */
+class RegisterCache
+{
+  public:
+    /**
+     * @brief Remember values read from or written to the power supply.
+     *
+     * Registers outside the cached range are ignored.
+     */
+    void store(const uint16_t offset, const uint16_t *values, const uint16_t numregs);
+
+    /**
+     * @brief Retrieve `numregs` registers starting at `offset`.
+     *
+     * @param max_age Maximum age in milliseconds of every register in the span.
+     * @return true if all registers are cached and fresh enough.
+     */
+    bool lookup(const uint16_t offset, uint16_t *values, const uint16_t numregs, const unsigned long max_age);
+
+    /**
+     * @brief Forget all cached values.
+     */
+    void invalidate();
+
+  private:
+    uint16_t values[REGISTER_CACHE_SIZE] = {};
+    unsigned long updated_at[REGISTER_CACHE_SIZE] = {};
+    bool valid[REGISTER_CACHE_SIZE] = {};
+};
+
+} // namespace RidenDongle
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#define SAMPLE_LOG_SIZE 128
+#define SAMPLE_AVERAGE_WINDOW 16 // Number of samples used for averages
+#define SAMPLE_MAX_GAP 5000      // milliseconds, longer gaps are not integrated
+
+namespace RidenDongle
+{
+
+/**
+ * @brief Output measured by the power supply at a point in time.
+ */
+struct Sample {
+    unsigned long timestamp; // millis()
+    float voltage;
+    float current;
+    float power;
+};
+
+/**
+ * @brief Averages over the most recent samples.
+ */
+struct SampleAverages {
+    uint16_t count;
+    double voltage;
+    double current;
+    double power;
+};
+
+/**
+ * @brief Ring buffer of the most recent output samples.
+ *
+ * Besides keeping the samples around, the log integrates output power
+ * into an energy counter with a much finer resolution than the Wh
+ * register of the power supply.
+ */
+class SampleLog
+{
+  public:
+    void add(const Sample &sample);
+    void clear();
+
+    /**
+     * @brief Number of samples in the log.
+     */
+    uint16_t size() { return count; }
+    uint16_t capacity() { return SAMPLE_LOG_SIZE; }
+
+    /**
+     * @brief Retrieve sample at `index`.
+     *
+     * @param index Zero-based index, `0` being the oldest sample.
+     */
+    const Sample &get(const uint16_t index);
+
+    /**
+     * @brief Retrieve the most recent sample.
+     *
+     * @return false if the log is empty.
+     */
+    bool latest(Sample &sample);
+
+    /**
+     * @brief Sequence number of the next sample to be added. Samples are
+     *        numbered from 0 at boot and the numbers survive clear().
+     */
+    uint32_t get_next_sequence() { return next_sequence; }
+
+    /**
+     * @brief Retrieve sample by sequence number.
+     *
+     * @return false if the sample has been overwritten or cleared.
+     */
+    bool get_by_sequence(const uint32_t sequence, Sample &sample);
+
+    /**
+     * @brief Average the last `SAMPLE_AVERAGE_WINDOW` samples.
+     */
+    SampleAverages get_averages();
+
+    /**
+     * @brief Energy delivered since boot in watt-seconds.
+     */
+    double get_energy() { return energy; }
+
+  private:
+    Sample samples[SAMPLE_LOG_SIZE];
+    uint16_t first = 0;
+    uint16_t count = 0;
+    uint32_t next_sequence = 0;
+    double energy = 0.0;
+};
+
+} // namespace RidenDongle
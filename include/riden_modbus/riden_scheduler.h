@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#define SCHEDULER_MAX_CLIENTS 8
+#define SCHEDULER_WEIGHT_MODBUS 1 // Share of the power supply for Modbus clients
+#define SCHEDULER_WEIGHT_SCPI 1   // Share of the power supply for SCPI clients
+
+namespace RidenDongle
+{
+
+/**
+ * @brief Protocols competing for the power supply.
+ */
+enum class TrafficClass : uint8_t {
+    Modbus = 0,
+    Scpi = 1,
+    COUNT = 2, // Number of traffic classes
+};
+
+/**
+ * @brief Convert TrafficClass to uint8_t.
+ *
+ * @param traffic_class The traffic class.
+ * @return The uint8_t.
+ */
+constexpr uint8_t operator+(TrafficClass traffic_class) noexcept
+{
+    return static_cast<uint8_t>(traffic_class);
+}
+
+/**
+ * @brief Rate limiting state and statistics of a single client.
+ */
+struct ClientStatistics {
+    bool used = false;
+    TrafficClass traffic_class = TrafficClass::Modbus;
+    uint32_t ip = 0;
+    float tokens = 0;
+    unsigned long refilled_at = 0;
+    unsigned long last_seen = 0;
+    uint32_t requests = 0;
+    uint32_t throttled = 0;
+    uint32_t completed = 0;
+    uint32_t total_latency = 0; // milliseconds
+
+    uint32_t average_latency() { return (completed == 0) ? 0 : total_latency / completed; }
+};
+
+/**
+ * @brief Decides who gets to use the power supply next.
+ *
+ * Every client has a token bucket limiting its request rate, and the
+ * protocols share the power supply by weighted fair queuing, so no single
+ * client or protocol can starve the others.
+ */
+class RidenScheduler
+{
+  public:
+    /**
+     * @brief Count a request received from a client.
+     */
+    void record_request(const TrafficClass traffic_class, const uint32_t ip);
+
+    /**
+     * @brief Count a request delayed or rejected by the rate limit.
+     */
+    void record_throttled(const TrafficClass traffic_class, const uint32_t ip);
+
+    /**
+     * @brief Record the time from receiving a request until responding.
+     */
+    void record_latency(const TrafficClass traffic_class, const uint32_t ip, const unsigned long received_at);
+
+    /**
+     * @brief Tell whether a protocol has requests waiting.
+     *
+     * Only protocols with waiting requests compete for the fair share.
+     */
+    void set_backlogged(const TrafficClass traffic_class, const bool backlogged);
+
+    /**
+     * @brief Check whether the client has tokens left.
+     */
+    bool within_rate(const TrafficClass traffic_class, const uint32_t ip);
+
+    /**
+     * @brief Check whether the protocol is within its fair share.
+     */
+    bool within_share(const TrafficClass traffic_class);
+
+    /**
+     * @brief Charge the client and the protocol for a request sent to
+     *        the power supply.
+     */
+    void admit(const TrafficClass traffic_class, const uint32_t ip);
+
+    /**
+     * @brief Retrieve client at `index`, or nullptr if unused.
+     *
+     * @param index Zero-based index less than `SCHEDULER_MAX_CLIENTS`.
+     */
+    ClientStatistics *get_client(const uint8_t index);
+
+  private:
+    ClientStatistics clients[SCHEDULER_MAX_CLIENTS];
+    double virtual_time[+TrafficClass::COUNT] = {};
+    bool backlogged[+TrafficClass::COUNT] = {};
+
+    ClientStatistics &find_client(const TrafficClass traffic_class, const uint32_t ip);
+    void refill(ClientStatistics &client);
+    double cost(const TrafficClass traffic_class);
+};
+
+} // namespace RidenDongle
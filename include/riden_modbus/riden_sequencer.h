@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#define SEQUENCE_MAX_STEPS 32
+
+namespace RidenDongle
+{
+
+class RidenModbus;
+
+enum class SequenceState : uint16_t {
+    Idle = 0,
+    Armed = 1,   // Initiated, waiting for a trigger
+    Running = 2,
+};
+
+/**
+ * @brief Convert SequenceState to uint16_t.
+ *
+ * @param state The state.
+ * @return The uint16_t.
+ */
+constexpr uint16_t operator+(SequenceState state) noexcept
+{
+    return static_cast<uint16_t>(state);
+}
+
+/**
+ * @brief Runs a list of setpoints on the dongle.
+ *
+ * Voltage, current and dwell lists are uploaded once. A list holding a
+ * single value applies it to every step, and an empty voltage or current
+ * list leaves that setpoint alone. Steps are applied from `loop()`, so
+ * their timing does not depend on the network.
+ */
+class RidenSequencer
+{
+  public:
+    /**
+     * @brief Replace one of the lists. Fails while a sequence is active.
+     *
+     * @param count Number of values, at most `SEQUENCE_MAX_STEPS`.
+     */
+    bool set_voltages(const float *values, const uint8_t count);
+    bool set_currents(const float *values, const uint8_t count);
+    bool set_dwells(const float *seconds, const uint8_t count);
+
+    uint8_t get_voltages(const float *&values);
+    uint8_t get_currents(const float *&values);
+    uint8_t get_dwells(const float *&seconds);
+
+    /**
+     * @brief Number of times to run through the lists, 0 for forever.
+     */
+    bool set_count(const uint16_t count);
+    uint16_t get_count() { return count; }
+
+    /**
+     * @brief Advance on the dwell timer (true) or on every trigger (false).
+     */
+    bool set_step_auto(const bool step_auto);
+    bool is_step_auto() { return step_auto; }
+
+    /**
+     * @brief Arm the sequence, checking that the lists fit together.
+     *
+     * @return false if the lists are inconsistent.
+     */
+    bool initiate();
+
+    /**
+     * @brief Start an armed sequence, or advance one step in
+     *        step-once mode.
+     *
+     * @return false if the trigger was ignored.
+     */
+    bool trigger();
+
+    void abort();
+
+    /**
+     * @brief Apply due steps to the power supply.
+     */
+    void loop(RidenModbus &ridenModbus);
+
+    SequenceState get_state() { return state; }
+
+    /**
+     * @brief Zero-based index of the current step.
+     */
+    uint8_t get_step() { return step; }
+
+    /**
+     * @brief Number of steps, i.e. the length of the longest list.
+     */
+    uint8_t get_length();
+
+  private:
+    float voltages[SEQUENCE_MAX_STEPS];
+    float currents[SEQUENCE_MAX_STEPS];
+    float dwells[SEQUENCE_MAX_STEPS]; // seconds
+    uint8_t voltage_count = 0;
+    uint8_t current_count = 0;
+    uint8_t dwell_count = 0;
+    uint16_t count = 1;
+    bool step_auto = true;
+
+    SequenceState state = SequenceState::Idle;
+    uint8_t step = 0;
+    uint16_t repetition = 0;
+    bool apply_pending = false;
+    unsigned long step_started_at = 0;
+
+    bool set_list(float *list, uint8_t &list_count, const float *values, const uint8_t count);
+    void advance();
+    unsigned long dwell_ms(const uint8_t step);
+};
+
+} // namespace RidenDongle
@@ -4,14 +4,57 @@
 
 #pragma once
 
+#include "riden_virtual_registers.h"
 #include <riden_modbus/riden_modbus.h>
 
+#include <ESP8266WiFi.h>
 #include <ModbusTCP.h>
+#include <WiFiUdp.h>
 #include <list>
 
+#define MODBUS_BRIDGE_QUEUE_SIZE 8         // Pending requests across all clients
+#define MODBUS_BRIDGE_CLIENT_QUEUE_DEPTH 4 // Pending requests per client
+#define MODBUS_BRIDGE_MAX_PDU_LENGTH 253
+#define MODBUS_MAX_REGISTERS_PER_RESPONSE 125
+#define MODBUS_RTU_OVER_TCP_MAX_CLIENTS 2
+#define MODBUS_RTU_MAX_FRAME_LENGTH 256
+#define MODBUS_RTU_FRAME_GAP 20 // milliseconds of silence ending a frame
+#define MODBUS_UDP_MAX_PACKET_LENGTH (7 + MODBUS_BRIDGE_MAX_PDU_LENGTH)
+
 namespace RidenDongle
 {
 
+/**
+ * @brief The framing a request arrived with, and its response must use.
+ */
+enum class BridgeSource : uint8_t {
+    ModbusTCP,  // MBAP header over TCP
+    RtuOverTcp, // Raw RTU frames, including CRC, over TCP
+    Udp,        // MBAP header over UDP
+};
+
+/**
+ * @brief A Modbus request waiting to be forwarded to the power supply.
+ *
+ * Each request carries the transaction context needed to route the
+ * response back to the client it came from.
+ */
+struct BridgeRequest {
+    bool used = false;
+    uint32_t sequence = 0;       // Arrival order, used as tie breaker
+    uint32_t turn = 0;           // Round-robin position among clients
+    BridgeSource source = BridgeSource::ModbusTCP;
+    uint32_t ip = 0;             // Requesting client
+    uint16_t port = 0;           // UDP port to respond to
+    int8_t client = -1;          // RTU over TCP connection, -1 if gone
+    uint16_t transaction_id = 0; // ModbusTCP/UDP transaction
+    unsigned long received_at = 0;
+    bool throttled = false;      // Has been held back by the rate limit
+    uint8_t slave_id = 0;        // Request slave
+    uint8_t len = 0;
+    uint8_t data[MODBUS_BRIDGE_MAX_PDU_LENGTH];
+};
+
 class RidenModbusTCP : public ModbusTCP
 {
   public:
@@ -28,8 +71,21 @@ class RidenModbusTCP : public ModbusTCP
     void disconnect_client(const IPAddress &ip);
 };
 
+/**
+ * @brief A connection on the Modbus RTU over TCP listener.
+ */
+struct RtuOverTcpClient {
+    WiFiClient client;
+    uint8_t buffer[MODBUS_RTU_MAX_FRAME_LENGTH];
+    uint16_t len = 0;
+    unsigned long last_received_at = 0;
+};
+
 /**
  * @brief Modbus TCP bridge.
+ *
+ * Besides Modbus TCP, the bridge optionally accepts raw RTU frames over
+ * TCP and Modbus UDP. All requests share the same queue.
  */
 class RidenModbusBridge
 {
@@ -39,7 +95,16 @@ class RidenModbusBridge
     bool loop();
 
     uint16_t port();
+    /**
+     * @brief Port of the Modbus RTU over TCP listener, 0 when disabled.
+     */
+    uint16_t rtu_over_tcp_port();
+    /**
+     * @brief Port of the Modbus UDP listener, 0 when disabled.
+     */
+    uint16_t udp_port();
     std::list<IPAddress> get_connected_clients();
+    std::list<IPAddress> get_connected_rtu_over_tcp_clients();
     void disconnect_client(const IPAddress &ip);
 
     Modbus::ResultCode modbus_tcp_raw_callback(uint8_t *data, uint8_t len, void *custom_data);
@@ -50,10 +115,52 @@ class RidenModbusBridge
     RidenModbusTCP modbus_tcp;
     bool initialized = false;
 
-    // State of any currently running modbus command
-    uint16_t transaction_id = 0; // ModbusTCP transaction
-    uint8_t slave_id = 0;        // Request slave
-    uint32_t ip = 0;
+    uint16_t rtu_over_tcp_listen_port = 0;
+    WiFiServer rtu_over_tcp_server = WiFiServer(0);
+    RtuOverTcpClient rtu_over_tcp_clients[MODBUS_RTU_OVER_TCP_MAX_CLIENTS];
+    uint16_t udp_listen_port = 0;
+    WiFiUDP udp;
+
+    // Requests waiting for the power supply, served round-robin
+    // between clients and in order of arrival for each client.
+    BridgeRequest queue[MODBUS_BRIDGE_QUEUE_SIZE];
+    uint32_t next_sequence = 0;
+    uint32_t current_turn = 0;
+
+    // Index into `queue` of the request currently sent to the power supply
+    int8_t active = -1;
+    // Whether ModbusRTU is waiting for the power supply on behalf of `active`
+    bool awaiting_response = false;
+    unsigned long dispatched_at = 0;
+
+    // Large reads are split into several reads the power supply can
+    // handle. The partial results are collected here.
+    uint16_t split_received = 0; // Registers received so far
+    uint8_t split_response[2 + 2 * MODBUS_MAX_REGISTERS_PER_RESPONSE];
+
+    void accept_rtu_over_tcp_clients();
+    void receive_rtu_over_tcp();
+    void receive_rtu_over_tcp_frames(int8_t index);
+    void receive_udp();
+    void close_rtu_over_tcp_client(int8_t index);
+
+    bool enqueue(const BridgeRequest &origin, const uint8_t *data, uint8_t len);
+    int8_t next_request();
+    void serve_locally();
+    bool serve_virtual_registers(const BridgeRequest &request);
+    void read_virtual_registers(uint16_t *values);
+    bool serve_from_cache(const BridgeRequest &request);
+    void send_registers(const BridgeRequest &request, const uint16_t *values, uint16_t numregs);
+    bool is_first_pending(int8_t index);
+    void update_cache(const BridgeRequest &request, const uint8_t *data, uint8_t len);
+    void dispatch_next_request();
+    bool needs_split(const BridgeRequest &request);
+    void dispatch_split_read();
+    bool collect_split_read(const uint8_t *data, uint8_t len);
+    void check_active_request();
+    void release_request(int8_t index);
+    void send_response(const BridgeRequest &request, uint8_t *data, uint8_t len);
+    void send_error(const BridgeRequest &request, Modbus::ResultCode code);
 };
 
 } // namespace RidenDongle
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+namespace RidenDongle
+{
+
+// Registers served from dongle RAM by the Modbus TCP bridge. They never
+// reach the power supply. 32- and 64-bit values are stored with the most
+// significant word first, like PowerOut_H/PowerOut_L.
+enum class VirtualRegister {
+    // Dongle
+    Uptime_H = 1000, // seconds
+    Uptime_L = 1001,
+    WiFiRSSI = 1002, // dBm, signed
+    FreeHeap_H = 1003, // bytes
+    FreeHeap_L = 1004,
+    // Modbus RTU
+    Transactions_H = 1005,
+    Transactions_L = 1006,
+    Failures_H = 1007,
+    Failures_L = 1008,
+    LatencyLast = 1009, // milliseconds
+    LatencyMin = 1010,
+    LatencyMax = 1011,
+    LatencyAverage = 1012,
+    // Averages over the most recent samples
+    AverageSamples = 1013,
+    AverageVoltage_H = 1014, // µV
+    AverageVoltage_L = 1015,
+    AverageCurrent_H = 1016, // µA
+    AverageCurrent_L = 1017,
+    AveragePower_H = 1018, // µW
+    AveragePower_L = 1019,
+    // Energy integrated from samples since boot, µWh
+    Energy_3 = 1020,
+    Energy_2 = 1021,
+    Energy_1 = 1022,
+    Energy_0 = 1023,
+    // Sequence engine
+    SequenceState = 1024, // See RidenDongle::SequenceState
+    SequenceStep = 1025,
+    // Sample log
+    SampleLogFill = 1026,
+    SampleLogCapacity = 1027,
+    END = 1028, // Used to indicate the end of the virtual registers
+};
+
+#define VIRTUAL_REGISTER_FIRST (+VirtualRegister::Uptime_H)
+#define VIRTUAL_REGISTER_COUNT (+VirtualRegister::END - +VirtualRegister::Uptime_H)
+
+/**
+ * @brief Convert VirtualRegister to uint16_t.
+ *
+ * @param reg The register.
+ * @return The uint16_t.
+ */
+constexpr uint16_t operator+(VirtualRegister reg) noexcept
+{
+    return static_cast<uint16_t>(reg);
+}
+
+} // namespace RidenDongle
@@ -12,12 +12,107 @@
 
 #define WRITE_BUFFER_LENGTH (256)
 #define SCPI_INPUT_BUFFER_LENGTH 256
+#define SCPI_RECEIVE_BUFFER_LENGTH 512 // Raw socket data waiting to be executed
 #define SCPI_ERROR_QUEUE_SIZE 17
+#define SCPI_TRAILER_LENGTH 256 // Output waiting behind a full write buffer or a streamed response
+#define SCPI_SEND_TIMEOUT 5000 // ms a raw socket may stall a response before it is closed
+#define SCPI_MAX_SESSIONS 3 // Raw socket, VXI-11 and HiSLIP clients together
+#define SCPI_MAX_ROOTS 40    // Distinct first mnemonics in the command table
 #define DEFAULT_SCPI_PORT 5025
+#define SCPI_OPER_SEQUENCE_DONE 0x0100 // STATus:OPERation bit 8, set when a LIST sequence ends
+
+// Decimals in responses, enough for the finest resolution of any model
+#define SCPI_VOLTAGE_DECIMALS 3
+#define SCPI_CURRENT_DECIMALS 4
+#define SCPI_POWER_DECIMALS 3
+#define SCPI_ENERGY_DECIMALS 3 // Ah and Wh
+#define SCPI_TEMPERATURE_DECIMALS 0
+#define SCPI_TIME_DECIMALS 3
 
 namespace RidenDongle
 {
 
+class RidenScpi;
+
+/**
+ * @brief Encoding of bulk data, selected by FORMat:DATA.
+ */
+enum class DataFormat {
+    Ascii,  // Comma-separated values
+    Real32, // Definite-length block of little-endian float32
+    Int32,  // Definite-length block of little-endian int32, milli-units
+};
+
+/**
+ * @brief Convert DataFormat to int32_t.
+ *
+ * @param format The data format.
+ * @return The int32_t.
+ */
+constexpr int32_t operator+(DataFormat format) noexcept
+{
+    return static_cast<int32_t>(format);
+}
+
+/**
+ * @brief Progress of a TRACe:DATA? response, which is produced while it
+ *        is being sent rather than all at once.
+ */
+struct TraceStream {
+    bool active = false;
+    int32_t quantity = 0;
+    uint32_t next_sequence = 0; // Sample log sequence number
+    uint32_t end_sequence = 0;
+    uint8_t next_value = 0; // Index of the value within the sample
+    bool separator = false; // ASCII values after the first need a comma
+};
+
+/**
+ * @brief State of a single SCPI client.
+ *
+ * Each session has its own parser context, so input, output and error
+ * queue are kept apart while the command table is shared.
+ */
+struct ScpiSession {
+    RidenScpi *owner = nullptr;
+    bool used = false;
+    bool external = false;     // Driven through write()/read() rather than a socket
+    bool output_ready = false; // Response complete and waiting for read()
+    DataFormat data_format = DataFormat::Ascii;
+
+    scpi_t context;
+    char input_buffer[SCPI_INPUT_BUFFER_LENGTH] = {};
+    scpi_error_t error_queue_data[SCPI_ERROR_QUEUE_SIZE];
+
+    char write_buffer[WRITE_BUFFER_LENGTH] = {};
+    size_t write_buffer_length = 0;
+
+    TraceStream trace;
+    char trailer[SCPI_TRAILER_LENGTH];
+    uint16_t trailer_length = 0;
+    bool flush_pending = false; // Response is complete once the stream and trailer have been produced
+
+    WiFiClient client;
+    uint32_t ip = 0;                 // Peer of an outside link, for the scheduler
+    unsigned long pending_since = 0; // When unprocessed input arrived, 0 if none
+    bool throttled = false;          // Pending input has been held back by the rate limit
+
+    // Ring buffer of data received on the raw socket
+    char receive_buffer[SCPI_RECEIVE_BUFFER_LENGTH];
+    size_t receive_start = 0;
+    size_t receive_length = 0;
+};
+
+/**
+ * @brief First entry in the command table for a root mnemonic.
+ */
+struct ScpiRoot {
+    const char *name; // Long form, not terminated
+    uint8_t length;
+    uint8_t short_length;
+    uint16_t first;
+};
+
 class RidenScpi
 {
   public:
@@ -32,14 +127,16 @@ class RidenScpi
     const char *get_visa_resource();
 
     // some inferface functions to handle commands to the SCPI parser from an outside source
-    // TODO: The SCPI parser should be externalised into another class and instance
-    bool claim_external_control() { 
-      external_control = true; 
-      return true; // I always gain priority
-    }
-    void release_external_control() { external_control = false; }
-    void write(const char *data, size_t len);
-    scpi_result_t read(char *data, size_t *len, size_t max_len);
+    // Every outside link gets a session of its own, identified by the handle
+    // returned from claim_external_control(), so raw socket clients stay connected.
+    int claim_external_control(const uint32_t ip);
+    void release_external_control(int handle);
+    bool can_write(int handle, const unsigned long received_at);
+    void write(int handle, char *data, size_t len);
+    scpi_result_t read(int handle, char *data, size_t *len, size_t max_len, int term_char, bool *end);
+    uint8_t read_status_byte(int handle);
+    void device_clear(int handle);
+    void device_trigger(int handle);
 
   private:
     RidenModbus &ridenModbus;
@@ -50,25 +147,34 @@ class RidenScpi
     char idn3[10] = {0};        // <serial number>
     char idn4[10] = {0};        // <firmware revision>
 
-    scpi_t scpi_context;
-    char scpi_input_buffer[SCPI_INPUT_BUFFER_LENGTH] = {};
-    scpi_error_t scpi_error_queue_data[SCPI_ERROR_QUEUE_SIZE];
-
-    char write_buffer[WRITE_BUFFER_LENGTH] = {};
-    size_t write_buffer_length = 0;
-
-    // external_control is used to indicate that the SCPI parser is handling a command from outside of the socket server
-    // See claim_external_control() and release_external_control()
-    bool external_control = false;
-    bool external_output_ready = false;
+    ScpiSession sessions[SCPI_MAX_SESSIONS];
+    SequenceState sequence_state = SequenceState::Idle; // As seen by the last loop()
 
     static const scpi_command_t scpi_commands[];
     static scpi_interface_t scpi_interface;
 
+    // Index into scpi_commands by root mnemonic, see find_commands()
+    ScpiRoot roots[SCPI_MAX_ROOTS];
+    uint8_t root_count = 0;
+
     WiFiServer tcpServer;
-    WiFiClient client;
 
-    void reset_buffers();
+    void index_commands();
+    void add_root(const char *name, const size_t length, const uint16_t first);
+    const scpi_command_t *find_commands(const char *line, const size_t length);
+    ScpiSession *allocate_session();
+    ScpiSession *find_external_session(int handle);
+    void free_session(ScpiSession &session);
+    void reset_buffers(ScpiSession &session);
+    bool receive(ScpiSession &session);
+    bool execute_next_line(ScpiSession &session, bool &backlogged);
+    int find_line_end(ScpiSession &session);
+    void produce_output(ScpiSession &session);
+    bool produce_trace_value(ScpiSession &session);
+    bool send_output(ScpiSession &session);
+    bool wait_for_output(ScpiSession &session);
+    void reset_output(ScpiSession &session);
+    bool fetch_sample(scpi_t *context, Sample &sample);
 
     // SCPI Functions and Commands
     // ===========================
@@ -76,8 +182,6 @@ class RidenScpi
     // conventions.
     static size_t SCPI_Write(scpi_t *context, const char *data, size_t len);
     static scpi_result_t SCPI_Flush(scpi_t *context);
-    scpi_result_t SCPI_FlushRaw(void);
-  
     static int SCPI_Error(scpi_t *context, int_fast16_t err);
     static scpi_result_t SCPI_Control(scpi_t *context, scpi_ctrl_name_t ctrl, scpi_reg_val_t val);
     static scpi_result_t SCPI_Reset(scpi_t *context);
@@ -113,6 +217,40 @@ class RidenScpi
     static scpi_result_t MeasureCurrentQ(scpi_t *context);
     static scpi_result_t MeasurePowerQ(scpi_t *context);
     static scpi_result_t MeasureTemperatureQ(scpi_t *context);
+    static scpi_result_t MeasureAllQ(scpi_t *context);
+    static scpi_result_t MeasureAllExtendedQ(scpi_t *context);
+
+    static scpi_result_t FetchVoltageQ(scpi_t *context);
+    static scpi_result_t FetchCurrentQ(scpi_t *context);
+    static scpi_result_t FetchPowerQ(scpi_t *context);
+    static scpi_result_t FetchAllQ(scpi_t *context);
+    static scpi_result_t FetchTimestampQ(scpi_t *context);
+
+    static scpi_result_t FormatData(scpi_t *context);
+    static scpi_result_t FormatDataQ(scpi_t *context);
+    static scpi_result_t FormatBorderQ(scpi_t *context);
+    static scpi_result_t TraceDataQ(scpi_t *context);
+    static scpi_result_t TracePointsQ(scpi_t *context);
+
+    static scpi_result_t ListVoltage(scpi_t *context);
+    static scpi_result_t ListVoltageQ(scpi_t *context);
+    static scpi_result_t ListVoltagePointsQ(scpi_t *context);
+    static scpi_result_t ListCurrent(scpi_t *context);
+    static scpi_result_t ListCurrentQ(scpi_t *context);
+    static scpi_result_t ListCurrentPointsQ(scpi_t *context);
+    static scpi_result_t ListDwell(scpi_t *context);
+    static scpi_result_t ListDwellQ(scpi_t *context);
+    static scpi_result_t ListDwellPointsQ(scpi_t *context);
+    static scpi_result_t ListCount(scpi_t *context);
+    static scpi_result_t ListCountQ(scpi_t *context);
+    static scpi_result_t ListStep(scpi_t *context);
+    static scpi_result_t ListStepQ(scpi_t *context);
+    static scpi_result_t Initiate(scpi_t *context);
+    static scpi_result_t Abort(scpi_t *context);
+    static scpi_result_t Trigger(scpi_t *context);
+    static bool ParamList(scpi_t *context, float *values, uint8_t &count, const scpi_unit_t unit, const double max_value);
+    static void ResultList(scpi_t *context, const float *values, const uint8_t count, const uint8_t decimals);
+    static size_t ResultFixed(scpi_t *context, const double value, const uint8_t decimals);
 
     static scpi_result_t SystemBeeperState(scpi_t *context);
     static scpi_result_t SystemBeeperStateQ(scpi_t *context);
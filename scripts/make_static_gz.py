@@ -0,0 +1,76 @@
+# SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+#
+# SPDX-License-Identifier: MIT
+
+# Compress the static web pages of http_static.h into PROGMEM blobs, to be
+# served with "Content-Encoding: gzip" and an ETag derived from their content.
+#
+# Runs before every build; it can also be run by hand from the project root.
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    PROJECT_DIR = os.getcwd()
+
+SOURCE_FILE = os.path.join(PROJECT_DIR, "src", "riden_http_server", "http_static.h")
+DEST_FILE = os.path.join(PROJECT_DIR, "src", "riden_http_server", "http_static_gz.h")
+
+# Pages served compressed, and the strings of http_static.h they are made of
+PAGES = {
+    "HTML_CONTROL_PAGE": ["HTML_HEADER", "HTML_CONTROL_BODY", "HTML_FOOTER"],
+}
+
+C_ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "\"": "\"", "'": "'", "\\": "\\"}
+
+
+def read_string(source: str, name: str) -> bytes:
+    """ Value of the string literals making up `static const char name[] PROGMEM = ...;` """
+    match = re.search(r"static const char " + name + r"\[\] PROGMEM =((?:\s*\"(?:[^\"\\]|\\.)*\")+)\s*;", source)
+    if match is None:
+        raise ValueError(f"{name} was not found in {SOURCE_FILE}")
+    literals = re.findall(r"\"((?:[^\"\\]|\\.)*)\"", match.group(1))
+    text = "".join(re.sub(r"\\(.)", lambda m: C_ESCAPES[m.group(1)], literal) for literal in literals)
+    return text.encode("utf-8")
+
+
+def make_page(name: str, parts: list, source: str) -> str:
+    content = b"".join(read_string(source, part) for part in parts)
+    compressed = gzip.compress(content, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(content).hexdigest()[:16]
+    print("Compressed {} to {:.0f}% (was {} bytes, now {} bytes)".format(
+        name, (len(compressed) / len(content)) * 100, len(content), len(compressed)))
+
+    lines = [f"// {' + '.join(parts)}, {len(content)} bytes before compression"]
+    lines.append(f"#define {name}_ETAG \"\\\"{etag}\\\"\"")
+    lines.append(f"static const uint8_t {name}_GZ[] PROGMEM = {{")
+    for i in range(0, len(compressed), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in compressed[i:i + 16]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def make_static_gz():
+    with open(SOURCE_FILE, "r", encoding="utf-8") as f:
+        source = f.read()
+
+    dest = "// Generated by scripts/make_static_gz.py from http_static.h. DO NOT MODIFY.\n\n"
+    dest += "#pragma once\n\n#include <Arduino.h>\n"
+    for name, parts in PAGES.items():
+        dest += "\n" + make_page(name, parts, source)
+
+    # Only touch the file when it changes, to keep incremental builds
+    if os.path.exists(DEST_FILE):
+        with open(DEST_FILE, "r", encoding="utf-8") as f:
+            if f.read() == dest:
+                return
+    with open(DEST_FILE, "w", encoding="utf-8") as f:
+        f.write(dest)
+
+
+make_static_gz()
@@ -48,6 +48,8 @@ def test_device(port: str, repeat_query: int, timeout: int):
         # write_delay_ms = 150  # for socket connections, a delay is needed between writes sometimes
     msgs = ["*IDN?"]
     msgs = ["VOLT 1", "VOLT?", "VOLT 2", "VOLT?", "VOLT 3", "VOLT?"]
+    # Two messages in one write, the second with a root before the first in the command table
+    msgs += ["VOLT 4\n*IDN?"]
     if repeat_query > 0:
         print(f"Repeating query tests for {repeat_query} seconds...")
         start = time.time()
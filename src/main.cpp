@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <riden_config/riden_config.h>
+#include <riden_hislip/riden_hislip.h>
 #include <riden_http_server/riden_http_server.h>
 #include <riden_logging/riden_logging.h>
 #include <riden_modbus/riden_modbus.h>
@@ -45,7 +46,8 @@ static RidenModbusBridge modbus_bridge(riden_modbus); ///< The modbus TCP server
 static SCPI_handler scpi_handler(riden_scpi);         ///< The bridge from the vxi server to the SCPI command handler
 static VXI_Server vxi_server(scpi_handler);           ///< The vxi server
 static RPC_Bind_Server rpc_bind_server(vxi_server);   ///< The RPC_Bind_Server for the vxi server
-static RidenHttpServer http_server(riden_modbus, riden_scpi, modbus_bridge, vxi_server); ///< The web server
+static RidenHiSlip hislip_server(riden_scpi);         ///< The HiSLIP server
+static RidenHttpServer http_server(riden_modbus, riden_scpi, modbus_bridge, vxi_server, hislip_server); ///< The web server
 
 /**
  * Invoked by led_ticker to flash the LED.
@@ -106,6 +108,7 @@ void setup()
         modbus_bridge.begin();
         vxi_server.begin();
         rpc_bind_server.begin();
+        hislip_server.begin();
 
         // turn off led
         led_ticker.detach();
@@ -198,6 +201,7 @@ void loop()
         modbus_bridge.loop();
         rpc_bind_server.loop();
         vxi_server.loop();
+        hislip_server.loop();
     }
     http_server.loop();
     ArduinoOTA.handle();
@@ -9,7 +9,7 @@
 #include <EEPROM.h>
 
 #define MAGIC "RD"
-#define CURRENT_CONFIG_VERSION 2
+#define CURRENT_CONFIG_VERSION 5
 
 using namespace RidenDongle;
 
@@ -34,6 +34,39 @@ struct RidenConfigStructV2 {
     uint32_t uart_baudrate;
 };
 
+// V3 Configuration Struct
+struct RidenConfigStructV3 {
+    RidenConfigHeader header;
+    char tz_name[100];
+    bool config_portal_on_boot;
+    uint32_t uart_baudrate;
+    uint32_t modbus_cache_max_age;
+};
+
+// V4 Configuration Struct
+struct RidenConfigStructV4 {
+    RidenConfigHeader header;
+    char tz_name[100];
+    bool config_portal_on_boot;
+    uint32_t uart_baudrate;
+    uint32_t modbus_cache_max_age;
+    uint16_t modbus_rtu_over_tcp_port;
+    uint16_t modbus_udp_port;
+};
+
+// V5 Configuration Struct
+struct RidenConfigStructV5 {
+    RidenConfigHeader header;
+    char tz_name[100];
+    bool config_portal_on_boot;
+    uint32_t uart_baudrate;
+    uint32_t modbus_cache_max_age;
+    uint16_t modbus_rtu_over_tcp_port;
+    uint16_t modbus_udp_port;
+    uint16_t client_rate_limit;
+    uint16_t client_burst;
+};
+
 #define STRINGIZER(arg) #arg
 #define STR_VALUE(arg) STRINGIZER(arg)
 
@@ -72,6 +105,42 @@ bool RidenConfig::begin()
             success = true;
             break;
         }
+        case 3: {
+            RidenConfigStructV3 config;
+            EEPROM.get(0, config);
+            tz_name = config.tz_name;
+            config_portal_on_boot = config.config_portal_on_boot;
+            uart_baudrate = config.uart_baudrate;
+            modbus_cache_max_age = config.modbus_cache_max_age;
+            success = true;
+            break;
+        }
+        case 4: {
+            RidenConfigStructV4 config;
+            EEPROM.get(0, config);
+            tz_name = config.tz_name;
+            config_portal_on_boot = config.config_portal_on_boot;
+            uart_baudrate = config.uart_baudrate;
+            modbus_cache_max_age = config.modbus_cache_max_age;
+            modbus_rtu_over_tcp_port = config.modbus_rtu_over_tcp_port;
+            modbus_udp_port = config.modbus_udp_port;
+            success = true;
+            break;
+        }
+        case 5: {
+            RidenConfigStructV5 config;
+            EEPROM.get(0, config);
+            tz_name = config.tz_name;
+            config_portal_on_boot = config.config_portal_on_boot;
+            uart_baudrate = config.uart_baudrate;
+            modbus_cache_max_age = config.modbus_cache_max_age;
+            modbus_rtu_over_tcp_port = config.modbus_rtu_over_tcp_port;
+            modbus_udp_port = config.modbus_udp_port;
+            client_rate_limit = config.client_rate_limit;
+            client_burst = config.client_burst;
+            success = true;
+            break;
+        }
         default:
             success = false;
         }
@@ -86,6 +155,10 @@ bool RidenConfig::begin()
         LOG_F("\tTimezone: %s\r\n", tz_name.c_str());
         LOG_F("\tPortal on boot: %s\r\n", (config_portal_on_boot) ? "Yes" : "No");
         LOG_F("\tUART baudrate: %u\r\n", uart_baudrate);
+        LOG_F("\tModbus cache max age: %u ms\r\n", modbus_cache_max_age);
+        LOG_F("\tModbus RTU over TCP port: %u\r\n", modbus_rtu_over_tcp_port);
+        LOG_F("\tModbus UDP port: %u\r\n", modbus_udp_port);
+        LOG_F("\tClient rate limit: %u/s, burst %u\r\n", client_rate_limit, client_burst);
     }
 
     return success;
@@ -148,21 +221,80 @@ void RidenConfig::set_uart_baudrate(uint32_t baudrate)
     this->uart_baudrate = baudrate;
 }
 
+uint32_t RidenConfig::get_modbus_cache_max_age()
+{
+    return modbus_cache_max_age;
+}
+
+void RidenConfig::set_modbus_cache_max_age(uint32_t max_age)
+{
+    this->modbus_cache_max_age = max_age;
+}
+
+uint16_t RidenConfig::get_modbus_rtu_over_tcp_port()
+{
+    return modbus_rtu_over_tcp_port;
+}
+
+void RidenConfig::set_modbus_rtu_over_tcp_port(uint16_t port)
+{
+    this->modbus_rtu_over_tcp_port = port;
+}
+
+uint16_t RidenConfig::get_modbus_udp_port()
+{
+    return modbus_udp_port;
+}
+
+void RidenConfig::set_modbus_udp_port(uint16_t port)
+{
+    this->modbus_udp_port = port;
+}
+
+uint16_t RidenConfig::get_client_rate_limit()
+{
+    return client_rate_limit;
+}
+
+void RidenConfig::set_client_rate_limit(uint16_t rate_limit)
+{
+    this->client_rate_limit = rate_limit;
+}
+
+uint16_t RidenConfig::get_client_burst()
+{
+    return client_burst;
+}
+
+void RidenConfig::set_client_burst(uint16_t burst)
+{
+    this->client_burst = burst;
+}
+
 bool RidenConfig::commit()
 {
 #ifdef MOCK_RIDEN
     return true;
 #else
-    RidenConfigStructV2 config;
+    RidenConfigStructV5 config;
     memcpy(config.header.magic, MAGIC, sizeof(MAGIC));
     config.header.config_version = CURRENT_CONFIG_VERSION;
     strcpy(config.tz_name, tz_name.c_str());
     config.config_portal_on_boot = config_portal_on_boot;
     config.uart_baudrate = uart_baudrate;
+    config.modbus_cache_max_age = modbus_cache_max_age;
+    config.modbus_rtu_over_tcp_port = modbus_rtu_over_tcp_port;
+    config.modbus_udp_port = modbus_udp_port;
+    config.client_rate_limit = client_rate_limit;
+    config.client_burst = client_burst;
     LOG_F("Saving configuration (%u bytes)\r\n", sizeof(config));
     LOG_F("\tTimezone: %s\r\n", config.tz_name);
     LOG_F("\tPortal on boot: %s\r\n", (config.config_portal_on_boot) ? "Yes" : "No");
     LOG_F("\tUART baudrate: %u\r\n", config.uart_baudrate);
+    LOG_F("\tModbus cache max age: %u ms\r\n", config.modbus_cache_max_age);
+    LOG_F("\tModbus RTU over TCP port: %u\r\n", config.modbus_rtu_over_tcp_port);
+    LOG_F("\tModbus UDP port: %u\r\n", config.modbus_udp_port);
+    LOG_F("\tClient rate limit: %u/s, burst %u\r\n", config.client_rate_limit, config.client_burst);
     EEPROM.put(0, config);
     bool success = EEPROM.commit();
     if (success) {
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_format/riden_format.h>
+
+#include <math.h>
+#include <stdio.h>
+
+using namespace RidenDongle;
+
+static const double powers_of_ten[FIXED_MAX_DECIMALS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+size_t RidenDongle::format_scaled(char *buffer, const size_t size, const int32_t value, const uint8_t decimals)
+{
+    if (size == 0) {
+        return 0;
+    }
+    if (decimals > FIXED_MAX_DECIMALS) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    // Collect digits least significant first, with at least one digit
+    // before the decimal point
+    char digits[FIXED_BUFFER_LENGTH];
+    size_t count = 0;
+    uint32_t magnitude = (value < 0) ? uint32_t(-int64_t(value)) : uint32_t(value);
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0 || count <= decimals);
+
+    size_t length = (value < 0 ? 1 : 0) + count + (decimals > 0 ? 1 : 0);
+    if (length >= size) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    size_t position = 0;
+    if (value < 0) {
+        buffer[position++] = '-';
+    }
+    while (count > 0) {
+        if (count == decimals) {
+            buffer[position++] = '.';
+        }
+        buffer[position++] = digits[--count];
+    }
+    buffer[position] = '\0';
+    return position;
+}
+
+size_t RidenDongle::format_fixed(char *buffer, const size_t size, const double value, const uint8_t decimals)
+{
+    if (decimals <= FIXED_MAX_DECIMALS) {
+        double scaled = round(value * powers_of_ten[decimals]);
+        if (scaled >= INT32_MIN && scaled <= INT32_MAX) {
+            return format_scaled(buffer, size, int32_t(scaled), decimals);
+        }
+    }
+    // Out of range for the integer path
+    int length = snprintf(buffer, size, "%.*f", int(decimals), value);
+    if (length < 0 || size_t(length) >= size) {
+        if (size > 0) {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+    return length;
+}
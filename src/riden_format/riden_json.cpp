@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_format/riden_format.h>
+#include <riden_format/riden_json.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace RidenDongle;
+
+JsonWriter::JsonWriter(char *buffer, const size_t size) : buffer(buffer), size(size)
+{
+    if (size > 0) {
+        buffer[0] = '\0';
+    } else {
+        overflow = true;
+    }
+}
+
+JsonWriter &JsonWriter::begin_object()
+{
+    separate();
+    raw('{');
+    need_separator = false;
+    return *this;
+}
+
+JsonWriter &JsonWriter::end_object()
+{
+    raw('}');
+    need_separator = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::begin_array()
+{
+    separate();
+    raw('[');
+    need_separator = false;
+    return *this;
+}
+
+JsonWriter &JsonWriter::end_array()
+{
+    raw(']');
+    need_separator = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::key(const char *name)
+{
+    string(name);
+    raw(':');
+    need_separator = false;
+    return *this;
+}
+
+JsonWriter &JsonWriter::boolean(const bool value)
+{
+    separate();
+    raw(value ? "true" : "false", value ? 4 : 5);
+    return *this;
+}
+
+JsonWriter &JsonWriter::null()
+{
+    separate();
+    raw("null", 4);
+    return *this;
+}
+
+JsonWriter &JsonWriter::number(const int32_t value)
+{
+    char text[FIXED_BUFFER_LENGTH];
+    separate();
+    raw(text, format_scaled(text, sizeof(text), value, 0));
+    return *this;
+}
+
+JsonWriter &JsonWriter::fixed(const double value, const uint8_t decimals)
+{
+    // JSON has no NaN or infinity, and an empty number is no value at all
+    char text[FIXED_BUFFER_LENGTH];
+    size_t length = isfinite(value) ? format_fixed(text, sizeof(text), value, decimals) : 0;
+    if (length == 0) {
+        return null();
+    }
+    separate();
+    raw(text, length);
+    return *this;
+}
+
+JsonWriter &JsonWriter::string(const char *value)
+{
+    separate();
+    raw('"');
+    for (const char *c = value; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            raw('\\');
+            raw(*c);
+        } else if ((unsigned char)*c < 0x20) {
+            char escape[7];
+            snprintf(escape, sizeof(escape), "\\u%04x", *c);
+            raw(escape, 6);
+        } else {
+            raw(*c);
+        }
+    }
+    raw('"');
+    return *this;
+}
+
+void JsonWriter::separate()
+{
+    if (need_separator) {
+        raw(',');
+    }
+    need_separator = true;
+}
+
+void JsonWriter::raw(const char *text, const size_t length)
+{
+    if (overflow || length >= size - position) {
+        overflow = true;
+        return;
+    }
+    memcpy(&buffer[position], text, length);
+    position += length;
+    buffer[position] = '\0';
+}
+
+void JsonWriter::raw(const char c)
+{
+    raw(&c, 1);
+}
@@ -0,0 +1,557 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_hislip/riden_hislip.h>
+#include <riden_logging/riden_logging.h>
+
+#include <Arduino.h>
+#include <ESP8266mDNS.h>
+#include <algorithm>
+
+using namespace RidenDongle;
+
+static uint32_t get_u32(const uint8_t *data)
+{
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | data[3];
+}
+
+static void put_u32(uint8_t *data, uint32_t value)
+{
+    data[0] = value >> 24;
+    data[1] = value >> 16;
+    data[2] = value >> 8;
+    data[3] = value;
+}
+
+uint32_t HiSlipReader::parameter()
+{
+    return get_u32(&header[4]);
+}
+
+void HiSlipReader::reset()
+{
+    header_length = 0;
+    payload_left = 0;
+    payload_length = 0;
+    overflow = false;
+}
+
+bool RidenHiSlip::begin()
+{
+    if (initialized) {
+        return true;
+    }
+
+    LOG_LN("RidenHiSlip initializing");
+
+    tcpServer.begin();
+    tcpServer.setNoDelay(true);
+
+    if (MDNS.isRunning()) {
+        LOG_LN("RidenHiSlip advertising as hislip.");
+        MDNS.addService(NULL, "hislip", "tcp", tcpServer.port());
+    }
+
+    LOG_LN("RidenHiSlip initialized");
+
+    initialized = true;
+    return true;
+}
+
+bool RidenHiSlip::loop()
+{
+    accept_connections();
+    for (HiSlipPendingConnection &connection : pending) {
+        if (connection.client) {
+            initialize_connection(connection);
+        }
+    }
+
+    for (HiSlipSession &session : sessions) {
+        if (!session.used) {
+            continue;
+        }
+        if (!session.sync.connected() || (session.has_async && !session.async.connected())) {
+            LOG_F("RidenHiSlip: closing session %u\r\n", session.id);
+            close_session(session);
+            continue;
+        }
+        // The lock string of a waiting AsyncLock stays in async_payload
+        if (session.has_async && !session.lock_waiting &&
+            receive(session.async, session.async_reader, session.async_payload, sizeof(session.async_payload))) {
+            handle_async_message(session);
+            if (!session.lock_waiting) {
+                session.async_reader.reset();
+            }
+        }
+        if (session.responding) {
+            // Commands wait until the previous response has been sent
+            send_response(session);
+        } else if (session.command_pending) {
+            execute_command(session);
+        } else if (!is_locked_out(session) &&
+                   receive(session.sync, session.sync_reader, (uint8_t *)&session.input[session.input_length],
+                           HISLIP_MAX_MESSAGE_SIZE - session.input_length)) {
+            handle_sync_message(session);
+            session.sync_reader.reset();
+        }
+        check_lock_request(session);
+        check_service_request(session);
+    }
+    return true;
+}
+
+void RidenHiSlip::accept_connections()
+{
+    WiFiClient new_client = tcpServer.accept();
+    if (!new_client) {
+        return;
+    }
+    for (HiSlipPendingConnection &connection : pending) {
+        if (!connection.client) {
+            new_client.setNoDelay(true);
+            connection.client = new_client;
+            connection.reader.reset();
+            connection.accepted_at = millis();
+            return;
+        }
+    }
+    LOG_LN("RidenHiSlip: too many new connections, rejecting client.");
+    new_client.stop();
+}
+
+/**
+ * Turn a new connection into the synchronous channel of a new session
+ * (Initialize) or the asynchronous channel of an existing one
+ * (AsyncInitialize).
+ */
+void RidenHiSlip::initialize_connection(HiSlipPendingConnection &connection)
+{
+    WiFiClient &client = connection.client;
+    if (!client.connected() || millis() - connection.accepted_at > HISLIP_INITIALIZE_TIMEOUT) {
+        client.stop();
+        connection.client = WiFiClient();
+        return;
+    }
+    if (!receive(client, connection.reader, connection.payload, sizeof(connection.payload))) {
+        return;
+    }
+
+    HiSlipReader &reader = connection.reader;
+    HiSlipSession *found = nullptr;
+    if (reader.type() == HiSlipMessageType::Initialize) {
+        for (HiSlipSession &session : sessions) {
+            if (!session.used) {
+                found = &session;
+                break;
+            }
+        }
+        int handle = (found != nullptr) ? ridenScpi.claim_external_control(client.remoteIP()) : -1;
+        if (handle < 0) {
+            LOG_LN("RidenHiSlip: no free session, rejecting client.");
+            send_message(client, HiSlipMessageType::FatalError, +HiSlipFatalError::MaximumClientsExceeded, 0);
+            client.stop();
+        } else {
+            *found = HiSlipSession();
+            found->used = true;
+            found->id = next_session_id++;
+            found->handle = handle;
+            found->sync = client;
+            LOG_F("RidenHiSlip: session %u for %s, sub-address \"%.*s\"\r\n", found->id,
+                  client.remoteIP().toString().c_str(), (int)reader.payload_length, (char *)connection.payload);
+            // Overlapped mode, the lower of the client's and our protocol version, and session id
+            uint16_t version = std::min(uint16_t(reader.parameter() >> 16), uint16_t(HISLIP_VERSION));
+            send_message(client, HiSlipMessageType::InitializeResponse, 1,
+                         (uint32_t(version) << 16) | found->id);
+        }
+    } else if (reader.type() == HiSlipMessageType::AsyncInitialize) {
+        uint16_t id = reader.parameter() & 0xffff;
+        for (HiSlipSession &session : sessions) {
+            if (session.used && !session.has_async && session.id == id) {
+                found = &session;
+                break;
+            }
+        }
+        if (found == nullptr) {
+            send_message(client, HiSlipMessageType::FatalError, +HiSlipFatalError::InvalidInitialization, 0);
+            client.stop();
+        } else {
+            found->async = client;
+            found->has_async = true;
+            send_message(client, HiSlipMessageType::AsyncInitializeResponse, 0, HISLIP_VENDOR_ID);
+        }
+    } else {
+        send_message(client, HiSlipMessageType::FatalError, +HiSlipFatalError::InvalidInitialization, 0);
+        client.stop();
+    }
+    connection.client = WiFiClient();
+    connection.reader.reset();
+}
+
+/**
+ * Execute the command collected from Data messages, once the rate limit of
+ * the client allows. Until then no further messages are read from the
+ * synchronous channel.
+ */
+void RidenHiSlip::execute_command(HiSlipSession &session)
+{
+    if (!ridenScpi.can_write(session.handle, session.command_received_at)) {
+        return;
+    }
+    size_t len = session.input_length;
+    // right trim. SCPI parser doesn't like \r\n
+    while (len > 0 && isspace(session.input[len - 1])) {
+        len--;
+    }
+    ridenScpi.write(session.handle, session.input, len);
+    session.command_pending = false;
+    session.input_length = 0;
+    session.responding = true;
+}
+
+void RidenHiSlip::close_session(HiSlipSession &session)
+{
+    ridenScpi.release_external_control(session.handle);
+    if (lock_owner == session_index(session)) {
+        lock_owner = -1;
+    }
+    session.sync.stop();
+    session.async.stop();
+    session = HiSlipSession();
+}
+
+void RidenHiSlip::handle_sync_message(HiSlipSession &session)
+{
+    HiSlipReader &reader = session.sync_reader;
+    HiSlipMessageType type = reader.type();
+    if (session.clearing && type != HiSlipMessageType::DeviceClearComplete) {
+        return; // discarded until the device clear completes
+    }
+
+    switch (type) {
+    case HiSlipMessageType::Data:
+    case HiSlipMessageType::DataEnd:
+        session.input_length += reader.payload_length;
+        session.input_overflow = session.input_overflow || reader.overflow;
+        if (type == HiSlipMessageType::Data) {
+            break;
+        }
+        session.message_id = reader.parameter();
+        if (session.input_overflow) {
+            LOG_F("RidenHiSlip: command too large on session %u\r\n", session.id);
+            send_message(session.sync, HiSlipMessageType::Error, +HiSlipError::MessageTooLarge, 0);
+            session.input_length = 0;
+            session.input_overflow = false;
+        } else {
+            session.command_pending = true;
+            session.command_received_at = millis();
+            execute_command(session);
+        }
+        break;
+    case HiSlipMessageType::Trigger:
+        session.message_id = reader.parameter();
+        ridenScpi.device_trigger(session.handle);
+        break;
+    case HiSlipMessageType::DeviceClearComplete:
+        session.clearing = false;
+        session.overlapped = (reader.control() & 1) != 0;
+        session.message_id = HISLIP_INITIAL_MESSAGE_ID;
+        send_message(session.sync, HiSlipMessageType::DeviceClearAcknowledge, session.overlapped ? 1 : 0, 0);
+        break;
+    default:
+        send_message(session.sync, HiSlipMessageType::Error, +HiSlipError::UnrecognizedMessageType, 0);
+        break;
+    }
+}
+
+void RidenHiSlip::handle_async_message(HiSlipSession &session)
+{
+    HiSlipReader &reader = session.async_reader;
+    switch (reader.type()) {
+    case HiSlipMessageType::AsyncLock:
+        handle_lock(session);
+        break;
+    case HiSlipMessageType::AsyncLockInfo: {
+        uint32_t holders = (lock_owner >= 0) ? 1 : 0;
+        for (HiSlipSession &other : sessions) {
+            if (other.used && other.shared_lock && lock_owner != session_index(other)) {
+                holders++;
+            }
+        }
+        send_message(session.async, HiSlipMessageType::AsyncLockInfoResponse, (lock_owner >= 0) ? 1 : 0, holders);
+        break;
+    }
+    case HiSlipMessageType::AsyncRemoteLocalControl:
+        // The power supply has no remote/local state to control
+        send_message(session.async, HiSlipMessageType::AsyncRemoteLocalResponse, 0, 0);
+        break;
+    case HiSlipMessageType::AsyncMaximumMessageSize: {
+        uint8_t size[8] = {0};
+        put_u32(&size[4], HISLIP_MAX_MESSAGE_SIZE);
+        send_message(session.async, HiSlipMessageType::AsyncMaximumMessageSizeResponse, 0, 0, size, sizeof(size));
+        break;
+    }
+    case HiSlipMessageType::AsyncDeviceClear:
+        LOG_F("RidenHiSlip: device clear on session %u\r\n", session.id);
+        ridenScpi.device_clear(session.handle);
+        session.clearing = true;
+        session.responding = false;
+        session.command_pending = false;
+        session.input_length = 0;
+        session.input_overflow = false;
+        // Prefer overlapped mode
+        send_message(session.async, HiSlipMessageType::AsyncDeviceClearAcknowledge, 1, 0);
+        break;
+    case HiSlipMessageType::AsyncStatusQuery:
+        send_message(session.async, HiSlipMessageType::AsyncStatusResponse,
+                     ridenScpi.read_status_byte(session.handle), 0);
+        break;
+    default:
+        send_message(session.async, HiSlipMessageType::Error, +HiSlipError::UnrecognizedMessageType, 0);
+        break;
+    }
+}
+
+/**
+ * AsyncLock requests (control code 1) or releases (control code 0) the
+ * lock. An empty lock string requests the exclusive lock, any other the
+ * shared lock of that name.
+ */
+void RidenHiSlip::handle_lock(HiSlipSession &session)
+{
+    HiSlipReader &reader = session.async_reader;
+    if (reader.control() == 1) {
+        bool shared = reader.payload_length > 0;
+        if (try_lock(session, shared, (char *)session.async_payload, reader.payload_length)) {
+            send_message(session.async, HiSlipMessageType::AsyncLockResponse, 1, 0);
+        } else if (reader.parameter() == 0) {
+            send_message(session.async, HiSlipMessageType::AsyncLockResponse, 0, 0);
+        } else {
+            // Wait for the lock without holding up the other clients
+            session.lock_waiting = true;
+            session.lock_requested_at = millis();
+            session.lock_timeout = reader.parameter();
+        }
+    } else if (lock_owner == session_index(session)) {
+        lock_owner = -1;
+        send_message(session.async, HiSlipMessageType::AsyncLockResponse, 1, 0);
+    } else if (session.shared_lock) {
+        session.shared_lock = false;
+        send_message(session.async, HiSlipMessageType::AsyncLockResponse, 2, 0);
+    } else {
+        send_message(session.async, HiSlipMessageType::AsyncLockResponse, 3, 0);
+    }
+}
+
+void RidenHiSlip::check_lock_request(HiSlipSession &session)
+{
+    if (!session.lock_waiting) {
+        return;
+    }
+    uint32_t name_length = session.async_reader.payload_length;
+    if (try_lock(session, name_length > 0, (char *)session.async_payload, name_length)) {
+        send_message(session.async, HiSlipMessageType::AsyncLockResponse, 1, 0);
+    } else if (millis() - session.lock_requested_at >= session.lock_timeout) {
+        send_message(session.async, HiSlipMessageType::AsyncLockResponse, 0, 0);
+    } else {
+        return;
+    }
+    session.lock_waiting = false;
+    session.async_reader.reset();
+}
+
+bool RidenHiSlip::try_lock(HiSlipSession &session, bool shared, const char *name, uint8_t name_length)
+{
+    int8_t index = session_index(session);
+    if (lock_owner >= 0 && lock_owner != index) {
+        return false;
+    }
+    bool shared_by_others = false;
+    for (HiSlipSession &other : sessions) {
+        shared_by_others = shared_by_others || (other.used && other.shared_lock && &other != &session);
+    }
+    if (!shared) {
+        if (shared_by_others) {
+            return false;
+        }
+        lock_owner = index;
+        return true;
+    }
+    if (shared_by_others &&
+        (name_length != shared_lock_name_length || memcmp(name, shared_lock_name, name_length) != 0)) {
+        return false;
+    }
+    memcpy(shared_lock_name, name, name_length);
+    shared_lock_name_length = name_length;
+    session.shared_lock = true;
+    return true;
+}
+
+/**
+ * @return true if another client holds a lock this one does not share.
+ */
+bool RidenHiSlip::is_locked_out(HiSlipSession &session)
+{
+    int8_t index = session_index(session);
+    if (lock_owner >= 0) {
+        return lock_owner != index;
+    }
+    if (session.shared_lock) {
+        return false;
+    }
+    for (HiSlipSession &other : sessions) {
+        if (other.used && other.shared_lock) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t RidenHiSlip::session_index(HiSlipSession &session)
+{
+    return &session - sessions;
+}
+
+/**
+ * Send AsyncServiceRequest when the session starts requesting service.
+ */
+void RidenHiSlip::check_service_request(HiSlipSession &session)
+{
+    if (!session.has_async) {
+        return;
+    }
+    uint8_t stb = ridenScpi.read_status_byte(session.handle);
+    bool asserted = (stb & STB_SRQ) != 0;
+    if (asserted && !session.srq_asserted) {
+        LOG_F("RidenHiSlip: service request on session %u\r\n", session.id);
+        send_message(session.async, HiSlipMessageType::AsyncServiceRequest, stb, 0);
+    }
+    session.srq_asserted = asserted;
+}
+
+/**
+ * Send as much of the response as the connection takes, read from the
+ * SCPI session straight behind the message header.
+ */
+void RidenHiSlip::send_response(HiSlipSession &session)
+{
+    size_t space = session.sync.availableForWrite();
+    if (space <= HISLIP_HEADER_LENGTH) {
+        return;
+    }
+    char *data = (char *)&send_buffer[HISLIP_HEADER_LENGTH];
+    size_t max_len = std::min(space - HISLIP_HEADER_LENGTH, (size_t)HISLIP_SEND_CHUNK);
+    size_t len = 0;
+    bool end = false;
+    if (ridenScpi.read(session.handle, data, &len, max_len, -1, &end) != SCPI_RES_OK) {
+        // The command had no response
+        session.responding = false;
+        return;
+    }
+    HiSlipMessageType type = end ? HiSlipMessageType::DataEnd : HiSlipMessageType::Data;
+    send_buffer[0] = 'H';
+    send_buffer[1] = 'S';
+    send_buffer[2] = +type;
+    send_buffer[3] = 0;
+    put_u32(&send_buffer[4], session.message_id);
+    put_u32(&send_buffer[8], 0);
+    put_u32(&send_buffer[12], len);
+    session.sync.write(send_buffer, HISLIP_HEADER_LENGTH + len);
+    if (end) {
+        session.responding = false;
+    }
+}
+
+/**
+ * Receive what has arrived of a message, without waiting for more.
+ * Payload beyond `capacity` is dropped.
+ *
+ * @return true when the message is complete.
+ */
+bool RidenHiSlip::receive(WiFiClient &client, HiSlipReader &reader, uint8_t *payload, uint32_t capacity)
+{
+    while (client.available() > 0) {
+        if (reader.header_length < HISLIP_HEADER_LENGTH) {
+            int n = client.read(&reader.header[reader.header_length], HISLIP_HEADER_LENGTH - reader.header_length);
+            if (n <= 0) {
+                break;
+            }
+            reader.header_length += n;
+            if (reader.header_length < HISLIP_HEADER_LENGTH) {
+                continue;
+            }
+            if (reader.header[0] != 'H' || reader.header[1] != 'S') {
+                LOG_F("RidenHiSlip: poorly formed header from %s\r\n", client.remoteIP().toString().c_str());
+                send_message(client, HiSlipMessageType::FatalError, +HiSlipFatalError::PoorlyFormedHeader, 0);
+                client.stop(); // the session is closed from loop()
+                return false;
+            }
+            reader.payload_left = (uint64_t(get_u32(&reader.header[8])) << 32) | get_u32(&reader.header[12]);
+        } else {
+            uint8_t discard[32];
+            uint32_t space = capacity - reader.payload_length;
+            uint8_t *target = (space > 0) ? &payload[reader.payload_length] : discard;
+            size_t size = std::min(reader.payload_left, (uint64_t)((space > 0) ? space : sizeof(discard)));
+            int n = client.read(target, size);
+            if (n <= 0) {
+                break;
+            }
+            if (space > 0) {
+                reader.payload_length += n;
+            } else {
+                reader.overflow = true;
+            }
+            reader.payload_left -= n;
+        }
+        if (reader.header_length == HISLIP_HEADER_LENGTH && reader.payload_left == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void RidenHiSlip::send_message(WiFiClient &client, HiSlipMessageType type, uint8_t control, uint32_t parameter,
+                               const uint8_t *payload, uint32_t length)
+{
+    uint8_t header[HISLIP_HEADER_LENGTH] = {'H', 'S', +type, control};
+    put_u32(&header[4], parameter);
+    put_u32(&header[8], 0);
+    put_u32(&header[12], length);
+    client.write(header, sizeof(header));
+    if (length > 0) {
+        client.write(payload, length);
+    }
+}
+
+uint16_t RidenHiSlip::port()
+{
+    return tcpServer.port();
+}
+
+std::list<IPAddress> RidenHiSlip::get_connected_clients()
+{
+    std::list<IPAddress> connected_clients;
+    for (HiSlipSession &session : sessions) {
+        if (session.used && session.sync.connected()) {
+            connected_clients.push_back(session.sync.remoteIP());
+        }
+    }
+    return connected_clients;
+}
+
+void RidenHiSlip::disconnect_client(const IPAddress &ip)
+{
+    for (HiSlipSession &session : sessions) {
+        if (session.used && session.sync.connected() && session.sync.remoteIP() == ip) {
+            close_session(session);
+        }
+    }
+}
+
+const char *RidenHiSlip::get_visa_resource()
+{
+    static char visa_resource[40];
+    sprintf(visa_resource, "TCPIP::%s::hislip0::INSTR", WiFi.localIP().toString().c_str());
+    return visa_resource;
+}
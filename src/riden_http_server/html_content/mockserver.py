@@ -1,4 +1,5 @@
-from flask import Flask, jsonify
+from flask import Flask, Response, jsonify, request
+import json
 import time
 from flask import send_from_directory
 
@@ -25,9 +26,7 @@ i_out = 0.0
 v_out = 0.0
 
 
-@app.route("/status", methods=["GET"])
-def status():
-    time.sleep(1)
+def step():
     global i_out, v_out
     if out_on:
         if i_out < 10.0:
@@ -38,29 +37,41 @@ def status():
     else:
         i_out = 0.0
         v_out = 0.0
+    return {
+        "out_on": out_on,
+        "set_v": 13.500,
+        "set_c": 0.100,
+        "out_v": v_out,
+        "out_c": i_out,
+        "batt_mode": False,
+        "cvmode": True,
+        "prot": "None",
+        "batt_v": 12.600,
+        "ext_t_c": None,
+        "int_t_c": 36.00,
+        "ah": 15.000,
+        "wh": 0.200,
+        "max_v": 40,
+        "max_c": 10,
+    }
+
+
+@app.route("/status", methods=["GET"])
+def status():
+    time.sleep(1)
+    return jsonify(step()), 200
+
+
+@app.route("/events", methods=["GET"])
+def events():
+    interval = min(max(request.args.get("interval", 1000, type=int), 500), 60000)
+
+    def stream():
+        while True:
+            yield "data: " + json.dumps(list(step().values()), separators=(",", ":")) + "\n\n"
+            time.sleep(interval / 1000)
 
-    return (
-        jsonify(
-            {
-                "out_on": out_on,
-                "set_v": 13.500,
-                "set_c": 0.100,
-                "out_v": v_out,
-                "out_c": i_out,
-                "batt_mode": False,
-                "cvmode": True,
-                "prot": "None",
-                "batt_v": 12.600,
-                "ext_t_c": None,
-                "int_t_c": 36.00,
-                "ah": 15.000,
-                "wh": 0.200,
-                "max_v": 40,
-                "max_c": 10
-            }
-        ),
-        200,
-    )
+    return Response(stream(), mimetype="text/event-stream", headers={"Cache-Control": "no-cache"})
 
 
 @app.route("/toggle_out", methods=["GET"])
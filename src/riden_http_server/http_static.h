@@ -171,6 +171,15 @@ static const char HTML_FOOTER[] PROGMEM =
     "    </body>"
     "</html>";
 
+// Response headers of /events, which is streamed without a length
+static const char EVENTS_HEADER[] PROGMEM =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 2000\n\n";
+
 static const char HTML_CONFIG_BODY_1[] PROGMEM =
     "<form method='post'>"
     "    <div class='box'>"
@@ -191,6 +200,41 @@ static const char HTML_CONFIG_BODY_2[] PROGMEM =
 static const char HTML_CONFIG_BODY_3[] PROGMEM =
     "                    </select></td>"
     "                </tr>"
+    "                <tr>"
+    "                    <th>Modbus TCP cache max age (ms)</th>"
+    "                    <td><input type='number' name='modbus_cache_max_age' min='0' max='60000' value='";
+
+static const char HTML_CONFIG_BODY_4[] PROGMEM =
+    "'></td>"
+    "                </tr>"
+    "                <tr>"
+    "                    <th>Modbus RTU over TCP port (0 = off)</th>"
+    "                    <td><input type='number' name='modbus_rtu_over_tcp_port' min='0' max='65535' value='";
+
+static const char HTML_CONFIG_BODY_5[] PROGMEM =
+    "'></td>"
+    "                </tr>"
+    "                <tr>"
+    "                    <th>Modbus UDP port (0 = off)</th>"
+    "                    <td><input type='number' name='modbus_udp_port' min='0' max='65535' value='";
+
+static const char HTML_CONFIG_BODY_6[] PROGMEM =
+    "'></td>"
+    "                </tr>"
+    "                <tr>"
+    "                    <th>Client rate limit (requests/s, 0 = off)</th>"
+    "                    <td><input type='number' name='client_rate_limit' min='0' max='1000' value='";
+
+static const char HTML_CONFIG_BODY_7[] PROGMEM =
+    "'></td>"
+    "                </tr>"
+    "                <tr>"
+    "                    <th>Client burst (requests)</th>"
+    "                    <td><input type='number' name='client_burst' min='1' max='1000' value='";
+
+static const char HTML_CONFIG_BODY_8[] PROGMEM =
+    "'></td>"
+    "                </tr>"
     "                <tr><th></th><td><input type='submit' value='Save'></td></tr>"
     "            </tbody>"
     "        </table>"
@@ -1055,7 +1099,9 @@ static const char HTML_CONTROL_BODY[] PROGMEM =
     "    if (data === \"\") {\n"
     "      return;\n"
     "    }\n"
-    "    const obj = JSON.parse(data);\n"
+    "    set_status(JSON.parse(data), full_set);\n"
+    "  }\n"
+    "  function set_status(obj, full_set = false) {\n"
     "    self.out_v.innerHTML = obj.out_v.toFixed(2).padStart(6, \" \") + \" V\";\n"
     "    self.out_i.innerHTML = obj.out_c.toFixed(2).padStart(6, \" \") + \" A\";\n"
     "    if (full_set) {\n"
@@ -1231,9 +1277,34 @@ static const char HTML_CONTROL_BODY[] PROGMEM =
     "      self.chart.clearData();\n"
     "    }\n"
     "  }\n"
+    "  const EVENT_FIELDS = [\"out_on\", \"set_v\", \"set_c\", \"out_v\", \"out_c\", \"batt_mode\", \"cvmode\", \"prot\",\n"
+    "    \"batt_v\", \"ext_t_c\", \"int_t_c\", \"ah\", \"wh\", \"max_v\", \"max_c\"];\n"
+    "  function subscribe(interval) {\n"
+    "    if (!window.EventSource) {\n"
+    "      return false;\n"
+    "    }\n"
+    "    const events = new EventSource(\"/events?interval=\" + interval);\n"
+    "    events.onmessage = function (event) {\n"
+    "      const values = JSON.parse(event.data);\n"
+    "      const obj = {};\n"
+    "      EVENT_FIELDS.forEach((field, i) => {\n"
+    "        obj[field] = values[i];\n"
+    "      });\n"
+    "      set_status(obj, false);\n"
+    "    };\n"
+    "    events.onerror = function () {\n"
+    "      if (events.readyState === EventSource.CLOSED) {\n"
+    "        console.warn(\"No telemetry push, polling /status instead\");\n"
+    "        setInterval(tick, interval);\n"
+    "      }\n"
+    "    };\n"
+    "    return true;\n"
+    "  }\n"
     "  window.addEventListener(\"load\", function () {\n"
     "    tick(true);\n"
-    "    setInterval(tick, 1000);\n"
+    "    if (!subscribe(1000)) {\n"
+    "      setInterval(tick, 1000);\n"
+    "    }\n"
     "  });\n"
     "</script>";
 // END OF SECTION GENERATED BY 'extract_code.py'
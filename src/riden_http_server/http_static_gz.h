@@ -0,0 +1,960 @@
+// Generated by scripts/make_static_gz.py from http_static.h. DO NOT MODIFY.
+
+#pragma once
+
+#include <Arduino.h>
+
+// HTML_HEADER + HTML_CONTROL_BODY + HTML_FOOTER, 51603 bytes before compression
+#define HTML_CONTROL_PAGE_ETAG "\"22758e9ae827d18f\""
+static const uint8_t HTML_CONTROL_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xbd, 0xf9, 0x97, 0xe2, 0x38,
+    0xb2, 0x28, 0xfc, 0x7b, 0xff, 0x15, 0x0c, 0x73, 0x67, 0x6e, 0xe6, 0xa5, 0x32, 0xbd, 0x61, 0xc0,
+    0x59, 0x4b, 0x7f, 0xec, 0x18, 0x30, 0xab, 0x59, 0xfb, 0xd4, 0xe9, 0x31, 0xde, 0xf1, 0x8a, 0x77,
+    0x33, 0xaf, 0xbe, 0xbf, 0xfd, 0xc9, 0x36, 0x8b, 0xcd, 0x92, 0x99, 0x55, 0xdd, 0x7d, 0xdf, 0xbb,
+    0xe7, 0x55, 0xd7, 0xe9, 0x04, 0x4b, 0xa1, 0x50, 0x28, 0x14, 0x11, 0x8a, 0x08, 0xc9, 0xe2, 0x93,
+    0xe4, 0x68, 0xea, 0x97, 0x5f, 0x72, 0xb9, 0x4f, 0x12, 0xcf, 0x70, 0xd1, 0x17, 0xf0, 0xd5, 0x91,
+    0x1d, 0x95, 0xff, 0x32, 0x91, 0x39, 0x5e, 0xcf, 0x51, 0xae, 0xea, 0xc8, 0x4f, 0x23, 0xd7, 0x32,
+    0x0d, 0x9b, 0xcf, 0x2d, 0xe4, 0x96, 0x9c, 0x6b, 0x18, 0xba, 0xa8, 0xf2, 0x9f, 0xa0, 0x04, 0x2c,
+    0x69, 0x62, 0x3b, 0xe1, 0xf1, 0x7b, 0x2e, 0xb7, 0x31, 0xb8, 0x30, 0xf7, 0xef, 0xc3, 0x43, 0x2e,
+    0x27, 0x18, 0xba, 0xf3, 0x24, 0x30, 0x9a, 0xac, 0x86, 0x2f, 0x39, 0x9b, 0xd1, 0xed, 0x27, 0x9b,
+    0xb7, 0x64, 0xe1, 0xe3, 0x09, 0xc0, 0x97, 0x39, 0x47, 0x7a, 0xc9, 0xe1, 0xf0, 0x3f, 0xce, 0x65,
+    0x9a, 0xac, 0x3f, 0x1d, 0xca, 0xcb, 0x28, 0x6c, 0x06, 0xa9, 0x1a, 0xc6, 0x12, 0x65, 0xfd, 0x25,
+    0x87, 0x80, 0xd2, 0x1c, 0xe3, 0x3a, 0x46, 0x0e, 0x8e, 0x3f, 0xce, 0x10, 0xac, 0xa1, 0x1a, 0xd6,
+    0x4b, 0xee, 0xef, 0x58, 0x05, 0x2b, 0xa2, 0x95, 0x63, 0xf9, 0xb7, 0xc3, 0x27, 0x27, 0x7b, 0x29,
+    0xe2, 0x12, 0x6c, 0x4f, 0x1b, 0xc3, 0x71, 0x0c, 0xed, 0x25, 0x57, 0x3a, 0xf7, 0x94, 0x82, 0x7f,
+    0x8e, 0x98, 0xc3, 0x5b, 0xf7, 0x9b, 0x21, 0xf0, 0x75, 0x3b, 0xe6, 0xef, 0xac, 0xa1, 0x0b, 0xb2,
+    0xe8, 0x5a, 0x7c, 0x9a, 0x19, 0xaa, 0xc1, 0x38, 0x2f, 0x39, 0x4b, 0x16, 0x25, 0xe7, 0x56, 0x4f,
+    0x1b, 0x23, 0x48, 0x41, 0x6f, 0x18, 0x56, 0x11, 0x2d, 0xc3, 0xd5, 0xb9, 0xa7, 0xe3, 0xa0, 0xf8,
+    0x22, 0xf8, 0x87, 0x5e, 0xb2, 0xe3, 0xc9, 0x31, 0xcc, 0x2c, 0x19, 0xb9, 0x9c, 0xc9, 0x70, 0x9c,
+    0xac, 0x8b, 0x2f, 0xb9, 0xe2, 0xed, 0x41, 0x71, 0x8c, 0x2e, 0x66, 0x06, 0x75, 0xab, 0x37, 0x0e,
+    0x25, 0x30, 0xe2, 0xb2, 0xf5, 0x75, 0xd3, 0x03, 0xbc, 0x2f, 0xc9, 0x0e, 0x7f, 0x0f, 0x9a, 0xf9,
+    0x70, 0x59, 0xf0, 0x22, 0x19, 0x1e, 0x6f, 0x5d, 0x17, 0x33, 0xac, 0x23, 0x7b, 0xfc, 0x75, 0xb9,
+    0x27, 0xdb, 0x00, 0x3f, 0xf7, 0xde, 0x7e, 0x23, 0x5e, 0x3a, 0xcc, 0x46, 0x4d, 0xf3, 0xff, 0x20,
+    0x53, 0x08, 0x7c, 0x16, 0xb6, 0x0c, 0xbc, 0x84, 0xa6, 0x80, 0x1d, 0x3e, 0x70, 0x9e, 0x18, 0x55,
+    0x16, 0x81, 0xb8, 0xb1, 0xbc, 0xee, 0xf0, 0xd6, 0xb5, 0x18, 0xc2, 0xe0, 0x5f, 0x05, 0x48, 0x22,
+    0x7c, 0xbb, 0x7b, 0xee, 0x38, 0x0a, 0x47, 0xba, 0x83, 0x58, 0xe5, 0x85, 0x2b, 0x49, 0x88, 0xa9,
+    0x7e, 0x96, 0x75, 0xc1, 0xb8, 0xdf, 0x2e, 0x23, 0x42, 0xa7, 0xd9, 0x7e, 0x8a, 0x8b, 0x2f, 0x45,
+    0xe1, 0x5a, 0xc3, 0x6e, 0xf5, 0xc4, 0xbd, 0x83, 0xc2, 0x73, 0x47, 0x51, 0xe9, 0xf7, 0xf6, 0xc3,
+    0xaa, 0x32, 0x60, 0xa3, 0xfd, 0x23, 0xcc, 0x38, 0x35, 0xe5, 0x7e, 0xb8, 0xa9, 0x60, 0x58, 0x5a,
+    0xaa, 0x31, 0x27, 0xdb, 0xa6, 0xca, 0x00, 0x9b, 0x24, 0xeb, 0xaa, 0xac, 0xdf, 0x10, 0x1f, 0x59,
+    0x8c, 0xf0, 0x5f, 0x5a, 0x32, 0x5b, 0xde, 0xf3, 0x2f, 0x39, 0x8c, 0xd7, 0x3e, 0x66, 0xcb, 0x7d,
+    0x3e, 0xe1, 0xfc, 0xc6, 0x50, 0xb9, 0x8f, 0xb7, 0x8d, 0x5f, 0x7e, 0x60, 0x00, 0x73, 0x35, 0x05,
+    0x26, 0x30, 0x47, 0x19, 0xba, 0x91, 0xff, 0x90, 0xd3, 0xc0, 0x87, 0x6d, 0x32, 0x2c, 0xff, 0xf1,
+    0xfe, 0x1c, 0xe7, 0xfe, 0x26, 0x6b, 0xa6, 0x61, 0x39, 0x8c, 0x9e, 0x9a, 0x85, 0x58, 0xe2, 0x9f,
+    0xe2, 0xa6, 0x2f, 0x39, 0xdd, 0xf0, 0x2d, 0xc6, 0xbc, 0x9a, 0x86, 0x0a, 0x2b, 0x5d, 0x0d, 0xca,
+    0xd6, 0x18, 0x55, 0xbd, 0x3f, 0x2c, 0x24, 0x3d, 0xac, 0x3f, 0x4c, 0xc9, 0xb1, 0x57, 0x50, 0xa9,
+    0xdf, 0xef, 0xf9, 0xcf, 0x62, 0xdc, 0x71, 0xb9, 0xb8, 0x1e, 0xf5, 0x41, 0x0c, 0x00, 0x46, 0xcb,
+    0x50, 0xd3, 0x06, 0xcf, 0xb0, 0x80, 0x59, 0x8f, 0x8c, 0x9d, 0xca, 0x98, 0x36, 0x20, 0xff, 0xf8,
+    0xed, 0xe3, 0x7b, 0xec, 0x45, 0x16, 0x6b, 0x4a, 0xd3, 0xb3, 0xe5, 0x69, 0x51, 0x7f, 0x4d, 0x77,
+    0x5e, 0x51, 0xe0, 0x6f, 0x6f, 0x63, 0xbe, 0x6f, 0xaa, 0xee, 0x35, 0x7e, 0xd1, 0x1d, 0xe9, 0x89,
+    0x95, 0x64, 0x95, 0x7b, 0x40, 0x1e, 0xef, 0xd0, 0xce, 0x65, 0x80, 0xde, 0x67, 0x88, 0xde, 0x21,
+    0x0f, 0xaf, 0xf4, 0x82, 0x3e, 0xbe, 0xd3, 0xfe, 0xbe, 0xa3, 0x9b, 0x67, 0x20, 0x23, 0x82, 0xf0,
+    0x2a, 0xbe, 0x1b, 0x12, 0x7d, 0xd1, 0x7a, 0xe3, 0x82, 0x25, 0x5e, 0xbf, 0xa3, 0x2d, 0xcf, 0xf8,
+    0x59, 0x5f, 0x6e, 0xb6, 0x7b, 0x96, 0xed, 0xdf, 0x33, 0xad, 0x6f, 0xac, 0xb1, 0xb0, 0x00, 0xdf,
+    0x54, 0xac, 0x43, 0xfd, 0x46, 0x05, 0x4d, 0xde, 0x4b, 0x67, 0xd2, 0x5f, 0xb2, 0xae, 0xbe, 0xda,
+    0xab, 0x25, 0x6e, 0x1e, 0x10, 0x0c, 0xff, 0x90, 0x43, 0x71, 0xf0, 0x07, 0x7c, 0x7b, 0x7c, 0xad,
+    0x8b, 0xe3, 0x54, 0x5d, 0x31, 0xe3, 0xb4, 0x0a, 0x46, 0x2b, 0xe0, 0xf9, 0xff, 0x8f, 0xaf, 0x2e,
+    0xd0, 0x37, 0xb9, 0x50, 0x2a, 0x95, 0x6e, 0xbb, 0x2e, 0x39, 0x04, 0x4d, 0x23, 0x3c, 0xe8, 0xac,
+    0xc5, 0x70, 0xb2, 0x6b, 0x67, 0x7c, 0x9b, 0x63, 0x1d, 0x98, 0x17, 0xd0, 0xca, 0x36, 0x54, 0x99,
+    0xcb, 0xfd, 0xbd, 0x52, 0xa9, 0xbc, 0xaa, 0xcc, 0x80, 0x42, 0xd7, 0xb2, 0x23, 0x0a, 0x4c, 0x43,
+    0xbe, 0xa5, 0x36, 0x17, 0x63, 0x7f, 0x4e, 0x7c, 0x93, 0x37, 0x79, 0x8b, 0x22, 0x28, 0xe0, 0xed,
+    0xe1, 0xcf, 0xe3, 0x1f, 0x9a, 0xdf, 0x2c, 0x01, 0xef, 0x9c, 0x5b, 0x14, 0x86, 0x41, 0xd7, 0x87,
+    0x3f, 0xef, 0x9a, 0x5b, 0x59, 0x37, 0x5d, 0xe7, 0x37, 0x27, 0x34, 0xf9, 0xcf, 0x79, 0xdd, 0xd5,
+    0x36, 0xbc, 0x95, 0xff, 0x7a, 0xcf, 0x8b, 0x7f, 0x97, 0x3d, 0xce, 0x28, 0x0a, 0xfa, 0xea, 0xc2,
+    0x72, 0x65, 0x20, 0xb8, 0x67, 0x47, 0xd6, 0x78, 0x9b, 0x65, 0x32, 0xce, 0x1b, 0x18, 0xb8, 0x23,
+    0x83, 0xb2, 0x63, 0x5b, 0xe0, 0xf4, 0x5e, 0xdb, 0xcf, 0xd8, 0x13, 0x46, 0x6f, 0x58, 0xcf, 0x14,
+    0xca, 0x3b, 0x72, 0x7c, 0xed, 0x45, 0x9f, 0x56, 0x30, 0x4f, 0x7c, 0x9b, 0xe5, 0x18, 0x06, 0xb8,
+    0x7d, 0xf8, 0xf3, 0x98, 0xc5, 0xf0, 0x09, 0x3a, 0x45, 0x48, 0x9f, 0xa0, 0x63, 0xa8, 0xf5, 0x29,
+    0x0a, 0x94, 0x0e, 0x01, 0x14, 0x93, 0x93, 0xb9, 0xcf, 0x79, 0xc9, 0xd0, 0xf8, 0x7c, 0x4e, 0xb2,
+    0x78, 0xe1, 0x73, 0x1e, 0xca, 0x7f, 0xe9, 0x80, 0xc7, 0x4f, 0x10, 0xf3, 0xe5, 0x9f, 0xfa, 0xc6,
+    0x3e, 0x8c, 0xf4, 0x00, 0x78, 0x98, 0xb4, 0x13, 0xec, 0xe1, 0x19, 0xb4, 0xa9, 0x27, 0xdf, 0xa2,
+    0x66, 0x17, 0x0d, 0x92, 0x58, 0x24, 0xdd, 0x04, 0x94, 0x24, 0x2d, 0x92, 0xaa, 0xa8, 0xcd, 0xa7,
+    0x28, 0x3c, 0x62, 0x55, 0xc6, 0xb6, 0x3f, 0xe7, 0x81, 0x03, 0x9b, 0x8f, 0xe9, 0x64, 0x72, 0x31,
+    0xf5, 0x9f, 0xf3, 0xe9, 0xe8, 0xe5, 0x84, 0xc8, 0xb4, 0x5d, 0x80, 0xa5, 0xc1, 0x3b, 0x8c, 0xac,
+    0xda, 0x87, 0x7e, 0x3f, 0x49, 0xe8, 0x97, 0x91, 0xe1, 0x03, 0x41, 0x9d, 0xba, 0xa6, 0xa9, 0x86,
+    0xb9, 0x13, 0x59, 0xa0, 0x22, 0xaa, 0x07, 0xdd, 0x1c, 0xa3, 0xcd, 0xd8, 0x43, 0x3f, 0x74, 0x79,
+    0x1c, 0xd7, 0x31, 0x94, 0xfc, 0xe4, 0x9c, 0x79, 0x14, 0x3f, 0x03, 0x7e, 0x47, 0x9c, 0x37, 0xcf,
+    0x45, 0x49, 0x61, 0xa2, 0xdb, 0x9f, 0xf3, 0x28, 0xfc, 0x8f, 0x7c, 0x0e, 0xba, 0x57, 0x8b, 0xfc,
+    0x70, 0xe5, 0x25, 0xde, 0x4f, 0xd0, 0x35, 0x25, 0x9f, 0x1c, 0x2b, 0xd3, 0xdc, 0x91, 0xbe, 0x4c,
+    0x79, 0x07, 0x04, 0xca, 0xd2, 0x65, 0xf1, 0xad, 0xb2, 0xa1, 0xeb, 0x00, 0x05, 0x7c, 0x1b, 0x1a,
+    0x3c, 0x59, 0xaf, 0xf4, 0xc9, 0xa5, 0x1f, 0x41, 0x41, 0xac, 0xd6, 0x99, 0x22, 0xa0, 0x5e, 0x69,
+    0x25, 0xbf, 0xa8, 0x8b, 0x84, 0xc5, 0xe6, 0x9d, 0xdf, 0xbd, 0xcb, 0x8a, 0x48, 0x93, 0x3f, 0xe7,
+    0x4b, 0x97, 0xc5, 0x1e, 0xa3, 0xba, 0xa0, 0xfc, 0xb2, 0x18, 0xc4, 0xef, 0x9f, 0xf3, 0xf0, 0x55,
+    0x29, 0x13, 0x00, 0x14, 0x57, 0xc5, 0xb6, 0xc3, 0x9b, 0x00, 0xfa, 0x19, 0x46, 0xb2, 0x35, 0xd9,
+    0xd9, 0x80, 0xb2, 0x63, 0x8b, 0x86, 0xfa, 0xe9, 0xa0, 0xc8, 0x07, 0xa2, 0xbd, 0x7c, 0xce, 0xd0,
+    0x81, 0xb7, 0xcf, 0x2a, 0xc9, 0xe3, 0xc3, 0x63, 0xfe, 0xcb, 0xfc, 0x09, 0xcc, 0x41, 0xee, 0x9f,
+    0xa2, 0xf3, 0xf1, 0x13, 0x94, 0x40, 0x7f, 0xb9, 0x89, 0xc9, 0xb4, 0x4e, 0x42, 0x78, 0x70, 0xfc,
+    0xf3, 0x31, 0x5a, 0xc3, 0x8d, 0x78, 0xf1, 0x25, 0xf7, 0xf4, 0xfc, 0xf4, 0x94, 0x9b, 0x7f, 0x82,
+    0x00, 0xdc, 0x4d, 0x04, 0x17, 0x5c, 0xd7, 0xc4, 0x1b, 0x7c, 0x65, 0xaf, 0x99, 0x6a, 0xb1, 0x9f,
+    0xf3, 0x1c, 0xe3, 0x30, 0x2f, 0xb2, 0xc6, 0x88, 0x3c, 0x64, 0xea, 0xe2, 0xc7, 0x0d, 0x63, 0xf3,
+    0xa5, 0xe2, 0x07, 0x79, 0x5e, 0x1b, 0x4e, 0x7c, 0xb8, 0xd7, 0x16, 0x8d, 0x2a, 0xf8, 0x6f, 0x30,
+    0x9d, 0x49, 0xcd, 0x99, 0x08, 0xbe, 0xd5, 0xa3, 0x3f, 0x55, 0xa9, 0x5e, 0x5d, 0x45, 0x0f, 0x56,
+    0x85, 0xd7, 0x54, 0xf0, 0xa5, 0xd9, 0xd0, 0xd4, 0xc6, 0x18, 0xa9, 0x59, 0x63, 0x98, 0x6b, 0x6c,
+    0xd0, 0xc0, 0x63, 0xd5, 0x81, 0xbf, 0x5a, 0x0c, 0xd4, 0x09, 0x3a, 0x77, 0xd7, 0xcb, 0xae, 0xb9,
+    0x42, 0xba, 0x9d, 0x31, 0x68, 0x3a, 0x24, 0xd1, 0xc1, 0x7c, 0x8e, 0x18, 0x9d, 0xd6, 0x6c, 0x36,
+    0x32, 0x5d, 0xdc, 0x0e, 0x6d, 0x65, 0x6f, 0x8c, 0x66, 0xe6, 0x8e, 0x99, 0x36, 0xbc, 0x22, 0xa2,
+    0xf6, 0x27, 0xf6, 0xcc, 0x69, 0x37, 0x51, 0x77, 0x5b, 0x58, 0x6f, 0x06, 0x0e, 0x56, 0x0f, 0xe9,
+    0x4d, 0x7f, 0x52, 0x53, 0x28, 0xdd, 0xc6, 0xd6, 0x88, 0xd9, 0xdd, 0x8e, 0xb6, 0x50, 0x6f, 0x62,
+    0xf6, 0xe8, 0xe2, 0x6c, 0x3c, 0x69, 0xd4, 0x76, 0xc3, 0x3a, 0x5d, 0x1c, 0x11, 0x1b, 0x7f, 0xca,
+    0x4a, 0xcc, 0xce, 0x73, 0xe4, 0x10, 0x95, 0x9d, 0x56, 0x5d, 0xae, 0x91, 0x94, 0x51, 0x18, 0x34,
+    0x4a, 0x93, 0x52, 0x67, 0xda, 0xf2, 0x75, 0xcb, 0xa5, 0x87, 0x7b, 0x17, 0x1f, 0x16, 0x99, 0x32,
+    0xd6, 0xc7, 0x46, 0xba, 0xa6, 0x0f, 0x89, 0x02, 0x4e, 0xe0, 0xfb, 0xb2, 0x53, 0xec, 0x2b, 0x7d,
+    0xd1, 0x5e, 0xe0, 0x1b, 0xbe, 0x3b, 0x26, 0xed, 0xf6, 0xae, 0xe8, 0xe0, 0xdc, 0x48, 0xb6, 0x2b,
+    0x82, 0x16, 0x50, 0xe3, 0x12, 0x47, 0xb5, 0x08, 0xb8, 0x8a, 0x10, 0x70, 0x1d, 0xb6, 0xb6, 0xe6,
+    0x6c, 0xa7, 0x4e, 0x57, 0xb5, 0x76, 0x61, 0x54, 0xf7, 0x08, 0xcb, 0x29, 0x87, 0x8d, 0x36, 0xe6,
+    0x08, 0xa8, 0x03, 0x09, 0xd0, 0xba, 0xe0, 0xba, 0xb3, 0x26, 0x5b, 0x93, 0x07, 0x68, 0x0b, 0xed,
+    0xf9, 0xc5, 0x50, 0xee, 0xcb, 0xeb, 0x71, 0xa3, 0xd0, 0x62, 0x17, 0xe1, 0x72, 0x55, 0x6d, 0x8e,
+    0x05, 0x8f, 0xac, 0x83, 0x25, 0xa2, 0x50, 0xd5, 0x9b, 0x43, 0x34, 0x64, 0xc9, 0x21, 0x39, 0xf5,
+    0xcb, 0xb3, 0xea, 0x3c, 0x90, 0xf9, 0x06, 0x54, 0x0f, 0xf7, 0xb8, 0x36, 0xa1, 0x0c, 0x49, 0x98,
+    0x4c, 0x7d, 0x63, 0x67, 0xec, 0x0b, 0xc1, 0xc0, 0x25, 0x6b, 0x05, 0x76, 0x4b, 0xa8, 0x46, 0xb3,
+    0x86, 0x8d, 0x7c, 0xb4, 0x58, 0xac, 0x0c, 0x18, 0xd9, 0xe9, 0x4d, 0xfb, 0xfd, 0x09, 0xab, 0xa0,
+    0x3b, 0xdc, 0x1c, 0x92, 0xc4, 0x90, 0x10, 0x21, 0x07, 0x72, 0x94, 0x25, 0xc7, 0x54, 0xe8, 0x8d,
+    0x08, 0x17, 0x46, 0xf6, 0xbe, 0x46, 0xb4, 0x06, 0x95, 0x86, 0x3b, 0x62, 0x96, 0x3d, 0xbd, 0xb7,
+    0x28, 0xae, 0xd8, 0xb1, 0x8e, 0x2c, 0x15, 0xac, 0x33, 0x25, 0xad, 0x10, 0x37, 0xed, 0xca, 0x6c,
+    0x0c, 0xa1, 0x0b, 0x9c, 0x19, 0xeb, 0x01, 0xe9, 0xd7, 0x38, 0xb7, 0x1c, 0xb6, 0x58, 0xd1, 0x0a,
+    0x46, 0xf6, 0x64, 0x3b, 0x5f, 0xba, 0x95, 0xce, 0x50, 0x82, 0x77, 0x8c, 0x81, 0xc1, 0x6c, 0xd5,
+    0x32, 0x89, 0xe9, 0x7a, 0x1d, 0x34, 0x04, 0x11, 0x93, 0x10, 0x9f, 0xde, 0xf7, 0x02, 0x17, 0x6f,
+    0x42, 0xfd, 0x59, 0xb0, 0xc4, 0xfd, 0x1e, 0xb7, 0xc4, 0xa7, 0x7a, 0x75, 0xaf, 0x35, 0x82, 0x62,
+    0xb5, 0x38, 0x24, 0x77, 0xfd, 0x4d, 0xad, 0x44, 0x84, 0x14, 0x6f, 0x37, 0x11, 0xb3, 0x67, 0x6c,
+    0xfb, 0xdb, 0x39, 0x67, 0x0c, 0x6c, 0x21, 0x94, 0x47, 0x72, 0x11, 0x97, 0xd6, 0x5a, 0x55, 0xc7,
+    0xdc, 0xfe, 0x82, 0x33, 0x87, 0x8e, 0x30, 0x1e, 0x32, 0x73, 0x4d, 0x56, 0x9a, 0x76, 0xd9, 0xf0,
+    0xb6, 0x15, 0xa9, 0xb5, 0x30, 0xf7, 0xe5, 0xe6, 0xbc, 0xa4, 0xf1, 0x2a, 0xdc, 0x27, 0x96, 0x21,
+    0x8a, 0xb5, 0xa8, 0x95, 0x3a, 0x5a, 0xad, 0x79, 0xbd, 0x1a, 0xc0, 0x61, 0xa3, 0x86, 0x40, 0xa3,
+    0x65, 0x89, 0x53, 0x79, 0x4e, 0x1b, 0x6f, 0x65, 0x65, 0xab, 0x2c, 0xeb, 0xc1, 0x8e, 0xea, 0x4e,
+    0x89, 0x85, 0x23, 0xb4, 0xea, 0x61, 0x87, 0x58, 0x3a, 0x53, 0x5e, 0x69, 0xb6, 0x0a, 0x28, 0xd7,
+    0x29, 0x8c, 0x8a, 0xce, 0x9e, 0xa4, 0x39, 0x97, 0x0e, 0xc5, 0xb6, 0xe0, 0xe1, 0x15, 0x06, 0x9f,
+    0xd7, 0xe9, 0x0e, 0x3e, 0x72, 0x96, 0x8d, 0x72, 0xb3, 0xb5, 0x96, 0x07, 0xe1, 0xac, 0x51, 0x93,
+    0x3a, 0xba, 0xdd, 0xa2, 0x6b, 0x62, 0x13, 0x9e, 0x8e, 0xc9, 0x2a, 0x61, 0x0a, 0x2d, 0x47, 0x34,
+    0x4a, 0x6c, 0xaf, 0xed, 0x4a, 0x86, 0xc1, 0xcb, 0x2a, 0xd3, 0xeb, 0x14, 0x11, 0xbe, 0x61, 0x63,
+    0x15, 0xd2, 0x2c, 0x08, 0xc5, 0xaa, 0x83, 0x4c, 0x76, 0x90, 0xbd, 0xb5, 0x4a, 0x83, 0xa6, 0x3f,
+    0xde, 0x6d, 0x20, 0x12, 0x6a, 0x8c, 0x77, 0x76, 0xdf, 0x63, 0x5a, 0xb3, 0xad, 0x57, 0x0d, 0x0a,
+    0xfc, 0x42, 0xb6, 0x38, 0xae, 0xda, 0x5d, 0xeb, 0xd5, 0x2d, 0xd2, 0x68, 0x75, 0xfb, 0xb0, 0x36,
+    0x15, 0x21, 0x91, 0x25, 0xcd, 0x91, 0x42, 0xd5, 0x14, 0xc9, 0x08, 0xeb, 0xd3, 0x6e, 0x45, 0xa5,
+    0xd7, 0x64, 0xa0, 0xc0, 0xb4, 0xd9, 0x6b, 0x6c, 0x97, 0x1d, 0x55, 0xee, 0xee, 0xd7, 0xa3, 0x21,
+    0x0e, 0x73, 0x13, 0xbc, 0x3a, 0x1d, 0x4c, 0xf5, 0x3d, 0xdf, 0xf7, 0x48, 0xcf, 0xe0, 0xe0, 0x4e,
+    0x1b, 0xd2, 0x38, 0x45, 0x1b, 0xd6, 0xe1, 0x7d, 0x65, 0xde, 0xd3, 0xf7, 0xec, 0x18, 0xa5, 0xa0,
+    0xd5, 0x1e, 0xf5, 0x7a, 0x2a, 0xc7, 0xb9, 0xcb, 0xad, 0x49, 0x80, 0x15, 0xab, 0xef, 0xc2, 0xeb,
+    0x85, 0x5e, 0xf6, 0x16, 0x6c, 0x41, 0x85, 0xbb, 0x6d, 0x96, 0x61, 0x64, 0x04, 0x0e, 0x07, 0xd6,
+    0x4c, 0x5f, 0xf6, 0x47, 0x50, 0xa5, 0x2b, 0xe0, 0x04, 0xef, 0x2f, 0x0b, 0x2c, 0xb6, 0x10, 0xf7,
+    0x85, 0x1a, 0x56, 0x6c, 0x08, 0x05, 0x6f, 0x33, 0xb7, 0x58, 0xa4, 0xb4, 0xa7, 0xa9, 0xb9, 0x68,
+    0x12, 0xae, 0x46, 0x6c, 0x82, 0xa6, 0xb0, 0x1f, 0xcd, 0x70, 0x65, 0xb4, 0x9b, 0x39, 0xf3, 0x45,
+    0x20, 0xd9, 0xa5, 0xa1, 0xbc, 0xa0, 0xe7, 0x8b, 0x82, 0x48, 0x0a, 0xa1, 0x5f, 0x23, 0xdc, 0xa5,
+    0x5c, 0xae, 0xb7, 0xd9, 0xf6, 0x02, 0xda, 0x2b, 0x44, 0x45, 0x81, 0x14, 0xcd, 0xeb, 0x12, 0x38,
+    0x29, 0x74, 0x75, 0x68, 0x8b, 0xb9, 0xe3, 0x42, 0x91, 0xc5, 0xf7, 0x3a, 0xd6, 0x13, 0x58, 0xae,
+    0x50, 0x0d, 0x5b, 0x98, 0xd8, 0xd7, 0xbb, 0x02, 0xab, 0x12, 0x41, 0x07, 0x1b, 0x0a, 0x13, 0xd4,
+    0x9a, 0xf1, 0x7c, 0x05, 0x66, 0x0a, 0x25, 0xcf, 0x28, 0x37, 0x7b, 0xb8, 0xa6, 0x2d, 0x67, 0x5c,
+    0x28, 0x8c, 0x55, 0x6b, 0xd5, 0xa7, 0x7d, 0x63, 0x4d, 0xce, 0x08, 0xdf, 0x1e, 0xd5, 0xd7, 0x4d,
+    0x67, 0x54, 0xaa, 0x2d, 0xda, 0x52, 0x55, 0x95, 0xfa, 0x98, 0x89, 0x0e, 0x4a, 0x36, 0xbd, 0x9d,
+    0x80, 0x81, 0xfa, 0x9b, 0x8e, 0xdd, 0x26, 0x94, 0x1d, 0x86, 0xda, 0x62, 0x8d, 0x37, 0xd9, 0x42,
+    0xe0, 0x5a, 0xfd, 0xd1, 0xa2, 0x48, 0x13, 0xb3, 0x89, 0xb9, 0x6a, 0x77, 0xb1, 0x50, 0x2b, 0x16,
+    0x2a, 0xfb, 0x2a, 0x8c, 0xbb, 0xc5, 0xe2, 0x78, 0x3b, 0xa5, 0x2b, 0x6b, 0xd2, 0x98, 0x3b, 0x2e,
+    0xb6, 0x6b, 0x96, 0x85, 0x85, 0xc6, 0xe9, 0x78, 0x7f, 0xc4, 0xed, 0x3c, 0x91, 0x5d, 0xef, 0x2b,
+    0x0b, 0xbf, 0x52, 0x5b, 0x74, 0x2b, 0x4b, 0xcc, 0x87, 0x47, 0xd2, 0x18, 0xf2, 0xf5, 0x7a, 0xa3,
+    0xcd, 0x15, 0xfa, 0x9e, 0xda, 0xb1, 0x2b, 0xdc, 0x24, 0x2c, 0x6d, 0xfa, 0xfd, 0x86, 0xdb, 0xa3,
+    0x98, 0x35, 0x0a, 0x3b, 0x6b, 0x6b, 0x27, 0xdb, 0xa3, 0x2e, 0x3e, 0x1c, 0xc8, 0xf5, 0x5d, 0x25,
+    0xec, 0x49, 0x2b, 0x0a, 0x67, 0xeb, 0x62, 0x6f, 0xe8, 0x96, 0x4a, 0x7d, 0x9b, 0x85, 0x99, 0xd5,
+    0xd0, 0x59, 0x73, 0x06, 0x3e, 0xae, 0xfb, 0xfc, 0x9e, 0x2c, 0xfa, 0x1a, 0xd1, 0x85, 0x3c, 0x78,
+    0x89, 0x62, 0x9a, 0xba, 0x5e, 0x0e, 0x85, 0xda, 0x76, 0x5b, 0xe9, 0xee, 0x3d, 0x6c, 0x61, 0xad,
+    0xf0, 0x46, 0xa1, 0x6e, 0x57, 0x89, 0x46, 0x99, 0xa1, 0x6c, 0x14, 0x88, 0xe3, 0xd6, 0xe3, 0x2b,
+    0x55, 0xab, 0x01, 0x04, 0x7d, 0xb4, 0x9e, 0xf2, 0x75, 0xa1, 0xb9, 0x72, 0x2a, 0xf5, 0xe1, 0x60,
+    0xd1, 0xf0, 0x2b, 0xad, 0x25, 0x1d, 0x58, 0xa3, 0x5d, 0x00, 0x59, 0xc4, 0xdc, 0x29, 0x6e, 0xe4,
+    0x25, 0x5f, 0x1d, 0x48, 0x15, 0x6f, 0x5e, 0x86, 0x0a, 0x10, 0x52, 0x12, 0x04, 0xaa, 0x81, 0x0c,
+    0x2a, 0x55, 0xb7, 0xd7, 0x80, 0xaa, 0x50, 0x45, 0xe5, 0xab, 0x5e, 0x6b, 0x45, 0x6c, 0xfa, 0x91,
+    0x21, 0x1e, 0xb6, 0xe7, 0xab, 0xe9, 0x62, 0x3d, 0xa0, 0xc7, 0xd5, 0x5d, 0xf4, 0x5c, 0xaf, 0x56,
+    0x6b, 0x12, 0xaa, 0x54, 0x6b, 0xd1, 0x43, 0xb5, 0x19, 0xfd, 0x61, 0xaa, 0xc9, 0x7f, 0x75, 0xa3,
+    0x4a, 0xa6, 0xcb, 0x0d, 0xa3, 0x4a, 0xa5, 0x9f, 0xa5, 0xf8, 0x6b, 0x6b, 0x5c, 0xe8, 0xba, 0x2c,
+    0xf8, 0x32, 0xc2, 0xa7, 0xb3, 0x49, 0x6d, 0xde, 0x12, 0xbb, 0xe5, 0xf5, 0xda, 0xda, 0xd4, 0x26,
+    0xf3, 0x16, 0x25, 0x40, 0x54, 0xd9, 0xdb, 0x70, 0x96, 0xb7, 0x91, 0xa6, 0x25, 0xdf, 0x9c, 0x8c,
+    0x8d, 0xed, 0xa4, 0xdd, 0x95, 0xc7, 0x06, 0xd3, 0xf4, 0x15, 0x6f, 0xb7, 0x50, 0x7a, 0x12, 0x29,
+    0x99, 0xf5, 0x72, 0x6b, 0xbe, 0x93, 0xeb, 0xcd, 0xa6, 0x34, 0xaa, 0x90, 0x83, 0xf9, 0xaa, 0x3a,
+    0x5b, 0x0c, 0xa6, 0xb5, 0xf1, 0xa4, 0x3e, 0x15, 0x25, 0xa1, 0x56, 0xb3, 0x76, 0xec, 0x54, 0x93,
+    0x9a, 0xd5, 0x31, 0xec, 0xf3, 0xed, 0x71, 0x9f, 0xac, 0x18, 0xdb, 0x70, 0x56, 0xaf, 0xce, 0x6d,
+    0x87, 0x5d, 0xa8, 0x4e, 0x7f, 0xbb, 0x41, 0x67, 0xb8, 0xde, 0xd9, 0x8f, 0x5c, 0x8f, 0x96, 0x97,
+    0x7b, 0xbb, 0x6c, 0x0f, 0xec, 0xc6, 0xb4, 0x2c, 0x0a, 0x9a, 0x0f, 0xec, 0x35, 0xe4, 0x72, 0x81,
+    0x80, 0x39, 0x5a, 0x59, 0x1b, 0x17, 0x89, 0xbe, 0x47, 0x6d, 0xf5, 0x66, 0x6f, 0x53, 0xee, 0xc3,
+    0x33, 0x7f, 0x23, 0x34, 0xaa, 0x6c, 0x4b, 0x22, 0x97, 0x96, 0xde, 0xdf, 0xed, 0xb5, 0x89, 0x32,
+    0x71, 0xc9, 0xd0, 0xd6, 0xf8, 0xda, 0xa0, 0xcd, 0x18, 0x40, 0x47, 0x9c, 0xf1, 0x86, 0x64, 0x85,
+    0x2e, 0x3e, 0xf5, 0x8b, 0xbd, 0xf6, 0x78, 0xd4, 0x6b, 0xfb, 0x43, 0x6a, 0x65, 0x11, 0x3b, 0x7f,
+    0x3d, 0xf6, 0xf1, 0xce, 0x82, 0xf1, 0x71, 0x9b, 0x44, 0x8a, 0x6d, 0x79, 0x5d, 0x56, 0x95, 0x6e,
+    0x65, 0x6b, 0x37, 0xd6, 0xcb, 0xc1, 0x40, 0xa4, 0xc4, 0xca, 0x56, 0x70, 0xba, 0xec, 0x58, 0x68,
+    0x79, 0x85, 0xbe, 0x33, 0xf4, 0xb5, 0x00, 0xa1, 0x15, 0xa5, 0x34, 0x6c, 0x90, 0xaa, 0x8c, 0xcd,
+    0xec, 0x99, 0x8b, 0x70, 0x46, 0x9f, 0x2d, 0x32, 0x2c, 0xb0, 0x71, 0x40, 0xf3, 0xc5, 0xa1, 0x3f,
+    0x9b, 0x54, 0xa8, 0x65, 0x4b, 0x41, 0x3b, 0x3e, 0xbe, 0x62, 0xfa, 0x0b, 0xaf, 0x32, 0x6b, 0xd5,
+    0xda, 0xc2, 0x02, 0xdd, 0x4f, 0x64, 0x6a, 0xa8, 0xe3, 0xa5, 0x76, 0xd1, 0xed, 0x9a, 0xf3, 0x21,
+    0x64, 0xb7, 0xf4, 0x86, 0x62, 0xb4, 0xdc, 0xa5, 0xe1, 0x5b, 0x0b, 0x6a, 0x56, 0xa6, 0x04, 0xb4,
+    0xd8, 0xe3, 0x84, 0x42, 0xb1, 0x4c, 0x75, 0xd6, 0xc5, 0x82, 0x30, 0x6f, 0xb6, 0xe0, 0x41, 0x95,
+    0x67, 0x17, 0xfb, 0x4a, 0x7d, 0xe1, 0x04, 0x9b, 0x6a, 0x69, 0x53, 0x33, 0x95, 0x1d, 0xc5, 0x4d,
+    0xc7, 0xbb, 0x1a, 0xd0, 0xbc, 0x19, 0x42, 0x4f, 0xcc, 0xb1, 0xac, 0xa2, 0xbd, 0x72, 0x69, 0xd7,
+    0xdb, 0xb5, 0x99, 0x02, 0x16, 0x6c, 0x96, 0x54, 0x83, 0xb5, 0xa7, 0xa5, 0x85, 0x5b, 0x1a, 0x0d,
+    0xad, 0xf1, 0x68, 0x86, 0xf1, 0x7d, 0xbc, 0x4b, 0x0f, 0x03, 0x60, 0x0a, 0xf4, 0x1a, 0xd0, 0x13,
+    0xb7, 0xc4, 0x6b, 0x9a, 0xd5, 0xc6, 0x2b, 0xe2, 0x62, 0xe6, 0x75, 0x43, 0xaf, 0x3a, 0x0b, 0x15,
+    0x03, 0x77, 0x44, 0x9c, 0x71, 0xf7, 0x14, 0xdd, 0xa7, 0xf7, 0xde, 0xba, 0x58, 0x2c, 0x8f, 0x88,
+    0x66, 0xc7, 0x2b, 0x6b, 0xcd, 0x0a, 0xb5, 0x75, 0x87, 0xfe, 0xaa, 0x80, 0xd4, 0x77, 0xbb, 0x85,
+    0xbe, 0x10, 0x6a, 0x85, 0x60, 0xbe, 0xaf, 0xcc, 0x7a, 0x28, 0x67, 0xec, 0x36, 0x62, 0x47, 0xf2,
+    0xb9, 0xd5, 0x88, 0xe0, 0x77, 0xfb, 0x32, 0x27, 0xed, 0xb1, 0xf9, 0x76, 0x0e, 0x64, 0x4c, 0x28,
+    0x86, 0xce, 0x62, 0xde, 0xf2, 0x59, 0x1c, 0x91, 0xb1, 0x49, 0xc9, 0x30, 0x16, 0x45, 0xb1, 0xe3,
+    0x59, 0xdb, 0x40, 0xaf, 0x37, 0x57, 0xdb, 0x92, 0x37, 0x13, 0xc6, 0xc4, 0xbe, 0x50, 0x6c, 0x55,
+    0x45, 0x4d, 0x33, 0x3c, 0x44, 0xf6, 0x3d, 0xd2, 0x36, 0x42, 0xca, 0x26, 0xbb, 0x0d, 0x6e, 0xc6,
+    0x0f, 0x48, 0x51, 0x9f, 0x73, 0x24, 0xab, 0x00, 0x43, 0x48, 0xc3, 0x43, 0xbf, 0x56, 0xec, 0xc3,
+    0xc3, 0x0a, 0xdb, 0x6c, 0x76, 0x2a, 0x66, 0xb0, 0xd2, 0xf4, 0xd6, 0x88, 0x1a, 0xd4, 0xd6, 0xee,
+    0x5a, 0x35, 0x16, 0x26, 0x6e, 0x2c, 0x5a, 0x54, 0x8b, 0x87, 0xfa, 0xb5, 0x2a, 0x55, 0xa8, 0x2e,
+    0x96, 0xde, 0x7c, 0x40, 0x11, 0x61, 0xd3, 0x05, 0xa6, 0x3a, 0x10, 0x6a, 0x7b, 0xa5, 0x82, 0x14,
+    0x67, 0x1e, 0x82, 0x4f, 0x64, 0xcc, 0x9b, 0x74, 0x07, 0x3d, 0xa8, 0x86, 0xad, 0x7a, 0x0e, 0xb6,
+    0x67, 0x76, 0xcb, 0x76, 0x48, 0x14, 0x08, 0x9e, 0x92, 0x59, 0x5e, 0xdb, 0xce, 0x1c, 0x83, 0x44,
+    0x89, 0x51, 0x67, 0x8f, 0xaf, 0xa0, 0x00, 0xb1, 0x7a, 0x1e, 0xdb, 0x82, 0x85, 0xc6, 0xb6, 0xbe,
+    0x9e, 0xd4, 0xc6, 0x2c, 0xda, 0x0e, 0x26, 0xf2, 0x9c, 0x61, 0x86, 0xe3, 0xe5, 0x90, 0xb6, 0x36,
+    0x8e, 0xb0, 0xac, 0x15, 0xaa, 0xab, 0x72, 0xa5, 0x87, 0x12, 0x08, 0x5e, 0x2f, 0x72, 0xd3, 0xae,
+    0xd3, 0xdb, 0x98, 0xeb, 0xaa, 0xb3, 0x10, 0xe6, 0x61, 0xbf, 0x14, 0x08, 0x9b, 0xc5, 0x18, 0x9a,
+    0xcb, 0x55, 0xb7, 0x08, 0x31, 0x83, 0x70, 0xde, 0xdb, 0xf3, 0xb5, 0xb9, 0x36, 0x43, 0x46, 0xc1,
+    0x86, 0x41, 0x69, 0x77, 0xb1, 0x67, 0x9d, 0x09, 0xaa, 0x4b, 0xeb, 0xa1, 0x05, 0xc1, 0xe1, 0x1c,
+    0xa8, 0xa3, 0x4a, 0x92, 0xe3, 0x82, 0x30, 0xd6, 0x74, 0xc5, 0xc7, 0xb0, 0x51, 0xb7, 0xcc, 0x8a,
+    0x73, 0x40, 0x5a, 0x4b, 0xa9, 0x54, 0x14, 0x03, 0x99, 0xf8, 0xfb, 0xc1, 0xb8, 0x42, 0xed, 0x1b,
+    0x4e, 0x7f, 0x83, 0x23, 0xed, 0x45, 0x05, 0x72, 0x3b, 0x58, 0xa9, 0x1f, 0x2a, 0x52, 0x48, 0x01,
+    0x81, 0x6c, 0xf7, 0x2b, 0x52, 0xa5, 0x01, 0x41, 0x4a, 0x58, 0x23, 0xbb, 0x12, 0xea, 0xee, 0xd1,
+    0x46, 0x91, 0x6b, 0xd5, 0x56, 0x90, 0xc0, 0x69, 0x83, 0x95, 0x2d, 0x49, 0xd5, 0x22, 0x5c, 0x99,
+    0x84, 0x4d, 0x99, 0x1d, 0x6f, 0x4d, 0xa7, 0xd7, 0xf5, 0xf6, 0x5d, 0xca, 0x2b, 0x14, 0x84, 0xc9,
+    0xdc, 0x6a, 0x05, 0x82, 0x18, 0xd8, 0x4e, 0x67, 0x16, 0xf6, 0x07, 0xdb, 0x6d, 0x47, 0xaa, 0x2e,
+    0x7a, 0xdd, 0x29, 0xba, 0x29, 0x2d, 0x28, 0x7e, 0xcf, 0x2e, 0x6b, 0x9b, 0xa9, 0xed, 0x6f, 0xf4,
+    0xb1, 0x06, 0x17, 0xc8, 0xf5, 0xd2, 0x2a, 0x34, 0xd1, 0x99, 0x8b, 0x1a, 0x43, 0x8c, 0x45, 0xd6,
+    0x92, 0xe9, 0x35, 0x66, 0xad, 0xc2, 0x78, 0x3e, 0x32, 0x96, 0xeb, 0xed, 0x90, 0xb5, 0x71, 0xe0,
+    0xf6, 0x08, 0xfc, 0x10, 0xe3, 0x30, 0x5e, 0x2e, 0xb0, 0x06, 0x62, 0xc2, 0xab, 0x4d, 0xb1, 0x1c,
+    0xe8, 0x44, 0x17, 0x83, 0x3a, 0xe5, 0x12, 0xba, 0xb2, 0x31, 0xb2, 0x3c, 0xdc, 0xee, 0x08, 0x58,
+    0x50, 0x4a, 0x58, 0x50, 0x58, 0xc3, 0xbd, 0x60, 0xe9, 0x19, 0x62, 0x7f, 0x52, 0xb4, 0xc8, 0x6e,
+    0xd7, 0x66, 0x68, 0x77, 0xd4, 0x72, 0x30, 0x81, 0xee, 0xd8, 0xc2, 0xc8, 0x69, 0x77, 0x4d, 0x84,
+    0xe6, 0x82, 0x22, 0x47, 0x0f, 0xb8, 0xda, 0x60, 0x56, 0x2d, 0x95, 0xba, 0xc3, 0x4d, 0x6d, 0x45,
+    0xf7, 0x4c, 0xcb, 0xad, 0xef, 0x42, 0xd1, 0x28, 0xf6, 0x85, 0x40, 0x6f, 0x6f, 0x9b, 0xe3, 0xc2,
+    0x68, 0xbc, 0x5c, 0xf3, 0x0c, 0x25, 0xd5, 0x6b, 0xbd, 0x8a, 0x35, 0x29, 0x6d, 0x5b, 0x24, 0xd2,
+    0xee, 0x4a, 0xdb, 0x7d, 0x9b, 0x1e, 0x97, 0x66, 0xc0, 0x86, 0xbb, 0x58, 0x43, 0xc1, 0xc4, 0x06,
+    0x23, 0xa0, 0x6e, 0xd9, 0xa8, 0x58, 0xe5, 0x8a, 0x54, 0xaa, 0x90, 0x45, 0xb2, 0xa6, 0x98, 0x94,
+    0x30, 0x1b, 0x55, 0x61, 0x32, 0xa4, 0xb9, 0xf6, 0xb0, 0x06, 0x35, 0x3a, 0xf8, 0xaa, 0xa2, 0xa2,
+    0xcd, 0x52, 0x03, 0xee, 0x2f, 0xa5, 0x35, 0xb1, 0x24, 0x21, 0x9d, 0x6a, 0xf6, 0x6a, 0x65, 0xbb,
+    0xad, 0xcb, 0xfd, 0xe6, 0x56, 0x14, 0x46, 0x02, 0xd7, 0xa4, 0x26, 0xd0, 0x24, 0x24, 0x82, 0x65,
+    0xd7, 0x6b, 0x14, 0xf8, 0x32, 0x27, 0x6e, 0xa5, 0x22, 0x05, 0xaf, 0xba, 0x2b, 0x4a, 0x9f, 0x96,
+    0xf1, 0x7e, 0x83, 0x2c, 0xdb, 0xa1, 0x52, 0x0a, 0x48, 0x6f, 0xed, 0x73, 0x9e, 0xb2, 0xac, 0x71,
+    0xfd, 0xf1, 0xc8, 0xdc, 0x2c, 0xd4, 0x5a, 0xbd, 0x19, 0x0e, 0xe9, 0x99, 0x22, 0xf8, 0x9d, 0xdd,
+    0x3c, 0xa0, 0x6a, 0x56, 0xe0, 0xd9, 0xc1, 0x2c, 0x36, 0xb3, 0xd3, 0xd9, 0x7c, 0x38, 0xe9, 0xe1,
+    0xf5, 0x15, 0x49, 0x7e, 0xbe, 0x0e, 0x48, 0xe2, 0x70, 0x37, 0xda, 0x6f, 0xda, 0xc8, 0xaa, 0xec,
+    0x84, 0x2f, 0x39, 0x49, 0xe6, 0x38, 0x5e, 0x7f, 0x77, 0x7c, 0xf2, 0xdf, 0x14, 0xa5, 0xb1, 0x7f,
+    0x59, 0x94, 0x86, 0xfd, 0x65, 0x51, 0x9a, 0x9c, 0x8d, 0xd2, 0xe4, 0x28, 0x4a, 0x23, 0xff, 0x84,
+    0x28, 0x4d, 0x3e, 0x46, 0x69, 0xd5, 0x3f, 0x18, 0xa5, 0xb1, 0x7f, 0x5e, 0x94, 0x26, 0x27, 0x51,
+    0x5a, 0xd5, 0x59, 0xaf, 0xed, 0xfe, 0xcf, 0x28, 0xed, 0x67, 0x94, 0xf6, 0x33, 0x4a, 0xfb, 0x19,
+    0xa5, 0xfd, 0x8c, 0xd2, 0xfe, 0x47, 0x47, 0x69, 0x72, 0xfc, 0xb5, 0x36, 0xe4, 0x97, 0x8d, 0x28,
+    0x4a, 0x1b, 0xf2, 0xa7, 0x28, 0x6d, 0x2e, 0xad, 0x99, 0xda, 0xa0, 0xd6, 0x1e, 0xe1, 0xa8, 0x82,
+    0x8a, 0x53, 0x0d, 0x1a, 0xd7, 0x81, 0xcd, 0x6a, 0xcf, 0x94, 0xa6, 0x29, 0x1b, 0xb2, 0x28, 0x8a,
+    0x2c, 0xdf, 0x28, 0xf4, 0x1a, 0x4c, 0x0f, 0x5e, 0xf6, 0xfa, 0x25, 0xb2, 0x36, 0xc6, 0xa6, 0x0b,
+    0xc3, 0x06, 0x46, 0x74, 0x69, 0x4d, 0x97, 0xb0, 0x61, 0xb1, 0x8b, 0xba, 0xa1, 0x8b, 0x95, 0x7a,
+    0x97, 0xd9, 0xed, 0x9a, 0x52, 0x0b, 0xb8, 0xa3, 0x3b, 0x91, 0x47, 0x81, 0xa7, 0xe6, 0xcd, 0x0c,
+    0x75, 0xe2, 0x4c, 0xe7, 0x1b, 0xba, 0xdb, 0x46, 0x50, 0x0e, 0x0f, 0x38, 0xd7, 0x1c, 0x12, 0xb6,
+    0x66, 0xb5, 0x5c, 0xb1, 0xc2, 0x2d, 0x86, 0x1b, 0xc8, 0xf3, 0x74, 0x48, 0x28, 0x43, 0x95, 0xe1,
+    0x9e, 0x2a, 0x2f, 0xd8, 0x86, 0xba, 0xe5, 0x46, 0xd6, 0xa2, 0x62, 0x96, 0xa7, 0x2b, 0x99, 0x26,
+    0xb8, 0x29, 0x89, 0x06, 0x84, 0xda, 0xd1, 0x90, 0xe6, 0xba, 0xbf, 0x5b, 0xd9, 0xab, 0x3d, 0xa6,
+    0x54, 0x6d, 0xbc, 0xa9, 0x74, 0xd9, 0x15, 0x35, 0x69, 0x95, 0x16, 0x50, 0x71, 0xac, 0xec, 0xe4,
+    0x9d, 0x53, 0xe8, 0x23, 0x30, 0x25, 0xf3, 0x8b, 0xb9, 0x5f, 0x9b, 0x2c, 0x97, 0xa5, 0x6a, 0x37,
+    0x90, 0xcd, 0x0d, 0xae, 0x8b, 0xb5, 0x61, 0x6d, 0xba, 0xa4, 0x70, 0xa0, 0x09, 0x3e, 0x17, 0xf4,
+    0x7a, 0xbb, 0xa2, 0x3b, 0x81, 0x57, 0x35, 0x1c, 0xe1, 0x7d, 0x06, 0xd9, 0x59, 0x1a, 0xd5, 0x03,
+    0xbe, 0xae, 0xc0, 0xfa, 0x41, 0x38, 0x6e, 0xee, 0x2c, 0x66, 0xcb, 0x20, 0x12, 0x55, 0x5d, 0x22,
+    0xcd, 0x8d, 0x33, 0xd1, 0x7b, 0x9b, 0x2e, 0x31, 0xee, 0x11, 0x9a, 0xda, 0xdd, 0xef, 0x4b, 0x04,
+    0xd3, 0x08, 0x8b, 0xd8, 0xa6, 0xc7, 0x0c, 0xf8, 0x56, 0xbd, 0x89, 0x74, 0xf6, 0xad, 0x70, 0xa8,
+    0x4c, 0xea, 0x6c, 0x8d, 0x76, 0x15, 0x7d, 0x84, 0x0e, 0xac, 0x10, 0xf5, 0x4b, 0x63, 0x42, 0xe3,
+    0xd1, 0x55, 0x79, 0x55, 0x1f, 0x2d, 0x6c, 0x94, 0x54, 0x03, 0xa8, 0xa5, 0x07, 0x35, 0x71, 0x81,
+    0x8e, 0x27, 0x66, 0x77, 0x56, 0x17, 0xfb, 0xa3, 0x31, 0xba, 0x2b, 0x59, 0xad, 0xf6, 0x5a, 0x37,
+    0xac, 0xfd, 0x64, 0x4a, 0x92, 0x48, 0xb0, 0x1f, 0xb2, 0x2d, 0xcd, 0xf6, 0xd7, 0xbc, 0xd7, 0x24,
+    0x89, 0xd9, 0x0c, 0x6f, 0x8d, 0xac, 0x5a, 0xb9, 0x47, 0xba, 0xfa, 0xa0, 0xb1, 0xa9, 0x5a, 0xae,
+    0xae, 0x74, 0x9a, 0x1b, 0xa2, 0x40, 0x96, 0xa1, 0x0d, 0xde, 0x11, 0x21, 0x99, 0x2f, 0xb3, 0xc0,
+    0x8c, 0xcc, 0x97, 0xc3, 0x66, 0x9d, 0x94, 0x7c, 0x9c, 0xb0, 0x6c, 0x73, 0xde, 0x2f, 0xd4, 0x10,
+    0x89, 0x57, 0x36, 0x15, 0x75, 0x37, 0xc6, 0xcb, 0xdb, 0xea, 0x0a, 0x5f, 0xcd, 0xf5, 0x4e, 0x91,
+    0x99, 0x3a, 0x15, 0x16, 0x65, 0xf6, 0xcb, 0xb0, 0x37, 0x9b, 0xc0, 0x8d, 0x92, 0xe2, 0x87, 0x56,
+    0x6d, 0x87, 0x30, 0x98, 0x31, 0xdf, 0x6f, 0xbb, 0x83, 0x92, 0x27, 0x57, 0x51, 0xc6, 0xdf, 0x34,
+    0x48, 0x72, 0x66, 0xb4, 0xfa, 0xc6, 0xba, 0xb5, 0xb5, 0x21, 0xb2, 0x85, 0xef, 0x15, 0xad, 0x33,
+    0xa8, 0x50, 0xbe, 0x3b, 0x01, 0x6c, 0x1d, 0x1b, 0x43, 0x12, 0xd9, 0xcf, 0xc5, 0xe2, 0xa0, 0x56,
+    0x90, 0xcc, 0xf9, 0x7c, 0x33, 0x72, 0xc9, 0xc1, 0x98, 0x90, 0x00, 0x43, 0x48, 0x24, 0xc4, 0xa7,
+    0xbd, 0xb6, 0x31, 0x2b, 0xa1, 0xc3, 0xa9, 0xd4, 0x0f, 0xfa, 0x78, 0xa0, 0x0f, 0xd7, 0x86, 0xc4,
+    0x2d, 0x05, 0x39, 0xe0, 0x03, 0x48, 0xc1, 0x43, 0x78, 0xd1, 0x2a, 0x29, 0x66, 0x67, 0x4f, 0x28,
+    0xa2, 0x5a, 0x43, 0xcc, 0xc5, 0x9c, 0x22, 0x03, 0xbf, 0x25, 0xab, 0xbc, 0x07, 0x97, 0x30, 0xb6,
+    0xa7, 0x14, 0xbb, 0x40, 0xec, 0x3a, 0x56, 0x3b, 0xa8, 0xee, 0x99, 0x11, 0x15, 0x2c, 0x82, 0x41,
+    0xc1, 0x09, 0xb6, 0x3d, 0xb8, 0x8c, 0xe0, 0x25, 0x72, 0x35, 0xea, 0x28, 0x6d, 0x7b, 0xce, 0x39,
+    0x3d, 0x93, 0x16, 0x38, 0xd5, 0x9a, 0x0e, 0xab, 0x3b, 0x98, 0xef, 0xda, 0x64, 0x49, 0x28, 0x0e,
+    0x9a, 0x7b, 0x8a, 0x9a, 0x36, 0x67, 0x25, 0x7c, 0xd9, 0x21, 0x46, 0x5b, 0x71, 0xc7, 0xd6, 0xc4,
+    0x11, 0x36, 0xa9, 0x86, 0x0b, 0xa5, 0xd5, 0x18, 0xae, 0x56, 0xb5, 0x65, 0x0b, 0xaa, 0x79, 0x84,
+    0x04, 0xf4, 0x50, 0x1a, 0x21, 0x25, 0x03, 0x21, 0xd9, 0x2e, 0xd6, 0xa8, 0x85, 0x4e, 0x47, 0x59,
+    0x13, 0x0c, 0x29, 0x41, 0x43, 0xcf, 0xd7, 0x77, 0x0e, 0xbd, 0xe2, 0x28, 0x67, 0x3b, 0xed, 0x08,
+    0x06, 0xb6, 0x73, 0xac, 0xad, 0x34, 0xa3, 0x06, 0x83, 0x55, 0x23, 0xe8, 0x71, 0xfb, 0x3d, 0x2e,
+    0xd7, 0x50, 0x85, 0xa1, 0xd0, 0xf2, 0x9c, 0xf6, 0xc6, 0xdd, 0x4d, 0xb8, 0x25, 0x1b, 0x5d, 0xdb,
+    0x59, 0x2e, 0xab, 0x13, 0xa1, 0x30, 0x6e, 0xd2, 0x43, 0x9f, 0xee, 0xd0, 0xd4, 0xb0, 0xd8, 0x2b,
+    0xcf, 0xec, 0x2d, 0x26, 0x04, 0x63, 0xc3, 0x15, 0x56, 0xfe, 0xa2, 0x61, 0x4e, 0xec, 0x6a, 0xc1,
+    0xc1, 0x5b, 0x43, 0x0d, 0xa6, 0xf0, 0x86, 0xd8, 0x0c, 0xe1, 0xdd, 0x60, 0x59, 0x63, 0x14, 0x9d,
+    0x94, 0xc2, 0x9e, 0x3c, 0x20, 0xd5, 0x05, 0xcd, 0x97, 0x71, 0xc3, 0x1a, 0xa1, 0xcd, 0x3a, 0x44,
+    0xb9, 0x4b, 0xc6, 0xa9, 0xa3, 0x4e, 0xe0, 0x03, 0xb2, 0xf9, 0x26, 0x46, 0xf1, 0x58, 0xb1, 0x0b,
+    0x97, 0x10, 0x7a, 0x53, 0xa5, 0xa9, 0x5d, 0x5d, 0x1c, 0x6e, 0x2b, 0xf8, 0xac, 0xe1, 0xb5, 0x09,
+    0x74, 0xdc, 0x82, 0xc2, 0xfa, 0x9a, 0x95, 0x20, 0xb8, 0xb7, 0xdf, 0xea, 0x14, 0xa6, 0x94, 0x37,
+    0x0e, 0x09, 0x5c, 0xa7, 0xfe, 0xb2, 0x84, 0x0a, 0x1a, 0x33, 0x22, 0x14, 0x1a, 0x42, 0x3b, 0x76,
+    0x4f, 0x76, 0xd6, 0xd5, 0xc2, 0x7a, 0x12, 0xac, 0x25, 0x4a, 0x13, 0x27, 0x21, 0xd2, 0xc4, 0x89,
+    0x66, 0xaf, 0x4d, 0x8d, 0x4d, 0x5a, 0xee, 0x2b, 0x88, 0xc2, 0x93, 0x96, 0x1a, 0xe8, 0xb2, 0x55,
+    0xef, 0x84, 0xb4, 0x87, 0x29, 0x03, 0x69, 0xd7, 0xea, 0x71, 0xf8, 0x42, 0x76, 0x8d, 0xed, 0x98,
+    0x36, 0x2b, 0x0b, 0xcd, 0x86, 0x84, 0x3d, 0xbd, 0xac, 0x37, 0xe8, 0x11, 0xa4, 0xd6, 0x6b, 0xc5,
+    0xc1, 0x42, 0xac, 0x94, 0x44, 0xa8, 0xab, 0x2e, 0x50, 0x7b, 0x0f, 0x0b, 0x0c, 0x47, 0xef, 0x58,
+    0x81, 0xf2, 0x3d, 0xad, 0xa8, 0x0a, 0x62, 0xb5, 0x5b, 0xf7, 0x03, 0x01, 0xde, 0x8e, 0x15, 0xa4,
+    0x01, 0x63, 0x0c, 0xb1, 0xed, 0x00, 0xdd, 0xf7, 0x89, 0xba, 0x57, 0x29, 0x96, 0x9a, 0x12, 0x64,
+    0xb7, 0x36, 0x06, 0x51, 0x86, 0xeb, 0x33, 0x7d, 0x02, 0xe6, 0x52, 0xc0, 0xa6, 0x23, 0xad, 0xa0,
+    0x28, 0x7b, 0x79, 0x82, 0xb3, 0x4d, 0x6b, 0x36, 0xe9, 0x6c, 0x49, 0x6c, 0x5d, 0x6f, 0xf6, 0x36,
+    0x7e, 0xd9, 0xdb, 0x56, 0xe1, 0xd9, 0xb2, 0xd9, 0x29, 0x2d, 0xf8, 0xd1, 0x48, 0x91, 0xe0, 0x20,
+    0x40, 0x76, 0xc5, 0x4a, 0x9b, 0x56, 0xcd, 0x3a, 0x35, 0x15, 0x88, 0xf5, 0xba, 0x43, 0x95, 0xa4,
+    0x95, 0xd1, 0x6c, 0x60, 0xd6, 0x70, 0x6e, 0xcd, 0x02, 0x71, 0x65, 0x0d, 0xf9, 0xf5, 0x50, 0x6f,
+    0x52, 0xdc, 0x52, 0x86, 0xd6, 0x16, 0xa4, 0xb5, 0x05, 0xc3, 0xb0, 0x18, 0xb7, 0xec, 0xae, 0x2d,
+    0xb3, 0x30, 0x90, 0x8a, 0xb6, 0x5a, 0x99, 0xb5, 0xab, 0xed, 0xd8, 0x8d, 0xad, 0x75, 0x27, 0x33,
+    0xbc, 0x69, 0x29, 0x5d, 0x60, 0xc3, 0x3e, 0xff, 0x1f, 0x88, 0x96, 0xa2, 0xbd, 0xf2, 0xe8, 0x10,
+    0xd1, 0xe7, 0x3c, 0x9a, 0xbf, 0xf0, 0xe1, 0x93, 0xed, 0xc3, 0xe3, 0x16, 0x1e, 0x1c, 0x6d, 0xd3,
+    0x1d, 0x02, 0x84, 0xd3, 0x81, 0xa3, 0x8b, 0x26, 0x57, 0x1d, 0x9c, 0xbb, 0x39, 0x8c, 0xe4, 0x7a,
+    0x7f, 0xfa, 0xd6, 0xd6, 0x73, 0xfe, 0x1a, 0x07, 0xc0, 0x12, 0x45, 0x1e, 0x55, 0xe9, 0xe5, 0x53,
+    0x44, 0x6e, 0x14, 0x4e, 0xfc, 0x27, 0x23, 0xfd, 0xe7, 0x17, 0x50, 0x01, 0xe2, 0x26, 0x18, 0xfe,
+    0x04, 0x45, 0xc5, 0x5f, 0x72, 0x55, 0xe9, 0xd3, 0xc6, 0xfa, 0xb2, 0x48, 0x83, 0xf9, 0x37, 0xc0,
+    0x16, 0x52, 0x12, 0xc9, 0x5c, 0xd3, 0x0a, 0x5d, 0xc6, 0x32, 0xc7, 0x11, 0xa4, 0xf6, 0x32, 0xef,
+    0x0d, 0xe6, 0x3e, 0xdd, 0x00, 0x32, 0x45, 0x11, 0x78, 0xfa, 0x1d, 0x44, 0x98, 0xff, 0xf9, 0xe5,
+    0x09, 0xb0, 0xf5, 0xf9, 0x48, 0xd4, 0x3f, 0x39, 0x5e, 0xfc, 0x58, 0x8f, 0xc8, 0x97, 0xf5, 0x34,
+    0x34, 0x78, 0x4a, 0xa0, 0x93, 0x41, 0x5c, 0x41, 0x6f, 0x18, 0x27, 0x0d, 0x1e, 0x3d, 0xfe, 0xee,
+    0x45, 0xd0, 0xd1, 0x88, 0x8f, 0x03, 0x9e, 0x7f, 0xc7, 0x78, 0xb3, 0x32, 0x73, 0x28, 0x89, 0x84,
+    0xe1, 0x8d, 0x70, 0xf4, 0x28, 0x1e, 0xf1, 0xb1, 0x99, 0x4b, 0x69, 0x4a, 0x45, 0xaa, 0x8e, 0x21,
+    0x8a, 0x2a, 0x9f, 0x8a, 0x55, 0x93, 0x82, 0x28, 0x5a, 0x1d, 0x0e, 0xa0, 0x61, 0xab, 0x75, 0x8a,
+    0x54, 0xdf, 0x08, 0x7f, 0xdf, 0x13, 0x73, 0x46, 0xec, 0xf8, 0x53, 0xa2, 0x4e, 0x25, 0xb5, 0x37,
+    0x58, 0x6b, 0x52, 0xc5, 0xde, 0xe6, 0x67, 0xd4, 0xf9, 0x33, 0xea, 0xfc, 0x19, 0x75, 0xfe, 0x8c,
+    0x3a, 0x7f, 0x46, 0x9d, 0xff, 0xa3, 0xa2, 0x4e, 0xf3, 0xe6, 0xde, 0xe0, 0x60, 0xb8, 0x2a, 0x33,
+    0xe3, 0xa8, 0x2c, 0x3c, 0xef, 0x0d, 0x4a, 0xb5, 0xba, 0x4d, 0xfa, 0xcd, 0xe6, 0x1c, 0x32, 0x8c,
+    0xee, 0x8a, 0xab, 0x53, 0xb3, 0x12, 0xd1, 0x1b, 0xf4, 0x60, 0x42, 0xde, 0x22, 0x9e, 0x57, 0x64,
+    0x8d, 0x6d, 0xaf, 0x33, 0x56, 0x6b, 0xb3, 0x85, 0xdf, 0x96, 0x86, 0xea, 0x6a, 0x32, 0x31, 0x99,
+    0x49, 0xd7, 0xf6, 0xa9, 0x50, 0xa3, 0x50, 0x38, 0xe4, 0x05, 0x78, 0xbf, 0x59, 0x28, 0x2b, 0x99,
+    0xc4, 0x6a, 0xc1, 0x78, 0x47, 0xe9, 0x43, 0xbd, 0x8d, 0xcd, 0xb4, 0x36, 0x09, 0x1b, 0x03, 0x43,
+    0x82, 0x5b, 0xed, 0xf6, 0xa2, 0xb1, 0xd9, 0xc9, 0x05, 0xab, 0x63, 0x76, 0x37, 0x81, 0x05, 0xd7,
+    0x41, 0x90, 0xb4, 0xa2, 0xe6, 0xac, 0x48, 0x77, 0x85, 0xea, 0xd4, 0x1b, 0xcf, 0x30, 0xa3, 0xb5,
+    0x25, 0xea, 0xd6, 0x4a, 0x2e, 0x8c, 0x66, 0x58, 0x03, 0x5e, 0xae, 0x49, 0x0e, 0x44, 0x52, 0x5c,
+    0xdf, 0x51, 0x28, 0x67, 0x01, 0x59, 0x43, 0x72, 0x30, 0x13, 0x6b, 0xb4, 0x4d, 0x95, 0x41, 0xc4,
+    0x48, 0x33, 0xb4, 0xb0, 0x5f, 0x2c, 0xf7, 0x74, 0x75, 0x1c, 0x52, 0xc1, 0x8a, 0x59, 0x6a, 0x1b,
+    0x11, 0x18, 0x42, 0x7a, 0x31, 0x32, 0x09, 0xa6, 0x55, 0x69, 0x4d, 0xb4, 0xa5, 0x8b, 0xc2, 0x38,
+    0x5a, 0x2c, 0xe9, 0x46, 0x7b, 0x35, 0x85, 0x45, 0x1f, 0xaa, 0x90, 0xe8, 0xdc, 0x6c, 0x07, 0xc8,
+    0x9a, 0x66, 0x1d, 0xaa, 0x82, 0x41, 0x23, 0x78, 0x57, 0x9a, 0x91, 0xf6, 0x8e, 0x28, 0x00, 0x41,
+    0xc7, 0x7b, 0x52, 0x17, 0x5d, 0x3a, 0x3a, 0xbd, 0xe7, 0x8c, 0x29, 0xc7, 0xf5, 0x26, 0x6a, 0x09,
+    0x36, 0x17, 0xd3, 0x8b, 0xef, 0x8e, 0xda, 0xa2, 0x77, 0x88, 0xb0, 0x90, 0xf7, 0x23, 0x44, 0x1b,
+    0x68, 0xe6, 0x46, 0x98, 0xac, 0x9d, 0x96, 0x5e, 0x2a, 0x8b, 0x45, 0xa6, 0xda, 0x0a, 0xe5, 0x49,
+    0xd8, 0xad, 0x70, 0x1d, 0x14, 0x9d, 0xa8, 0xb6, 0x14, 0xf0, 0x28, 0x2a, 0x6d, 0xd9, 0x46, 0x73,
+    0xe6, 0xe2, 0x4a, 0xa7, 0xd1, 0x85, 0xb8, 0x2d, 0x35, 0x2b, 0xd6, 0xd6, 0x98, 0x5e, 0x6f, 0xaf,
+    0x30, 0x75, 0xb9, 0xaf, 0xaf, 0xc7, 0xf5, 0x9d, 0x68, 0x5a, 0xd3, 0xda, 0x92, 0x2a, 0x82, 0x40,
+    0x57, 0x1a, 0xf5, 0x4a, 0xce, 0xac, 0x3b, 0x2d, 0x0b, 0x03, 0x16, 0x38, 0xf8, 0x55, 0xb4, 0x63,
+    0x32, 0xb4, 0x67, 0xa9, 0xd5, 0x09, 0xf5, 0xde, 0x7d, 0x86, 0xd3, 0x9b, 0x08, 0xba, 0xa1, 0xf3,
+    0xaf, 0x38, 0xcd, 0x77, 0xdd, 0x07, 0xdd, 0xf8, 0xe9, 0x40, 0xfc, 0x74, 0x20, 0x7e, 0x3a, 0x10,
+    0x3f, 0x1d, 0x88, 0x9f, 0x0e, 0xc4, 0x4f, 0x07, 0xe2, 0x5d, 0x0e, 0x44, 0xb7, 0x72, 0x74, 0x20,
+    0xf0, 0xb5, 0x3c, 0xda, 0xe2, 0x86, 0xdf, 0xa2, 0x58, 0x41, 0xc4, 0xf7, 0xe1, 0xd8, 0x9f, 0xe1,
+    0x34, 0xbe, 0xdf, 0xe8, 0x7d, 0x01, 0x82, 0xf6, 0xc4, 0xba, 0x6f, 0x0a, 0x7d, 0xd6, 0xd1, 0x16,
+    0xfd, 0xce, 0x6e, 0x59, 0x1e, 0x32, 0x32, 0x29, 0x57, 0xf5, 0xa9, 0xd2, 0x68, 0x93, 0xc5, 0xa1,
+    0x14, 0x2e, 0x87, 0xca, 0x80, 0xeb, 0x34, 0xdb, 0x4a, 0x7f, 0xb3, 0x21, 0x3c, 0xac, 0xb2, 0x41,
+    0xa6, 0x0b, 0x71, 0x6c, 0x74, 0xe7, 0xda, 0xa2, 0x09, 0xcf, 0x27, 0xd3, 0xed, 0x42, 0x0f, 0x19,
+    0x7c, 0xd1, 0xf3, 0xe5, 0xfa, 0x98, 0x02, 0xa6, 0x3b, 0x50, 0x9a, 0x83, 0xce, 0xb8, 0xc1, 0x5b,
+    0x08, 0x6f, 0x99, 0x98, 0x3d, 0xf2, 0x14, 0xa2, 0xca, 0xb9, 0x68, 0x9d, 0xa8, 0x62, 0xd3, 0x56,
+    0xcf, 0x43, 0x82, 0x51, 0x63, 0x58, 0x25, 0xaa, 0x78, 0xbf, 0x5d, 0x6a, 0x59, 0xf4, 0x66, 0x33,
+    0x6b, 0x74, 0x56, 0x73, 0xb5, 0x3a, 0xee, 0xed, 0x8d, 0x05, 0x23, 0x60, 0x64, 0xb5, 0x37, 0x9f,
+    0x15, 0xf0, 0xc9, 0x74, 0x42, 0xb7, 0x0c, 0xbf, 0xba, 0xdb, 0x89, 0xfd, 0xc1, 0x7c, 0xe7, 0xfa,
+    0xc5, 0xa5, 0xcd, 0x17, 0x46, 0xb8, 0x35, 0x5b, 0x6c, 0xba, 0x46, 0x93, 0x27, 0xb8, 0x5a, 0xd8,
+    0x35, 0x85, 0x41, 0xa1, 0xe3, 0x8f, 0x59, 0xa1, 0x16, 0x54, 0xf1, 0xd2, 0x9a, 0x9e, 0x8e, 0x46,
+    0xeb, 0x4e, 0x17, 0x6f, 0xaf, 0x50, 0x7c, 0xdc, 0x19, 0x55, 0x0d, 0x85, 0x42, 0x34, 0xca, 0x1f,
+    0xc0, 0xcb, 0x09, 0xcb, 0xa2, 0xc5, 0xf6, 0x02, 0x48, 0xf8, 0x1e, 0x15, 0xe9, 0x25, 0x3b, 0xab,
+    0xf4, 0x77, 0x53, 0x71, 0xd7, 0xee, 0x31, 0x3c, 0xcf, 0x94, 0xc1, 0xd4, 0xec, 0xbb, 0x03, 0xa3,
+    0x69, 0x6c, 0xb5, 0x7a, 0x19, 0x5b, 0x6c, 0x10, 0x77, 0xd7, 0x6a, 0x28, 0x5e, 0xd1, 0x77, 0xc7,
+    0x6e, 0xa7, 0xbd, 0xde, 0x76, 0x15, 0x5f, 0x2c, 0xb6, 0x3b, 0xe5, 0x55, 0x7d, 0x5a, 0xa8, 0x93,
+    0xb5, 0x09, 0xcf, 0x2f, 0x76, 0x9b, 0x0d, 0x5b, 0xed, 0x37, 0x61, 0xa8, 0xa8, 0x4d, 0x6b, 0x73,
+    0x9a, 0x55, 0xaa, 0x23, 0x8e, 0x6f, 0x94, 0x96, 0x53, 0x86, 0xc2, 0x5b, 0x18, 0xbc, 0x9f, 0xee,
+    0x2b, 0x75, 0xca, 0x08, 0x2b, 0xc3, 0x99, 0xb5, 0x1e, 0x29, 0xa5, 0x51, 0x05, 0x38, 0x1e, 0xc0,
+    0x47, 0x51, 0xd6, 0x5d, 0x95, 0xac, 0x97, 0x2a, 0x24, 0x24, 0x2e, 0x87, 0xf3, 0x2e, 0xdd, 0x2d,
+    0x02, 0x15, 0x19, 0x33, 0x5b, 0x9a, 0x86, 0x45, 0xac, 0x3f, 0xa7, 0xb7, 0xa5, 0x9e, 0x61, 0xc2,
+    0xe1, 0xb4, 0xd8, 0xe9, 0x2b, 0xa1, 0xdf, 0x5e, 0x08, 0xa6, 0xcf, 0x13, 0x5d, 0x64, 0x34, 0xda,
+    0xa2, 0x04, 0xed, 0x00, 0x1f, 0x49, 0x40, 0x4a, 0x44, 0xbf, 0x34, 0xa5, 0x57, 0x15, 0xb2, 0x53,
+    0x6b, 0x4c, 0x4d, 0x92, 0xd4, 0x76, 0xbb, 0x69, 0xd7, 0x59, 0xd7, 0xc6, 0x6d, 0x73, 0x5e, 0x5b,
+    0xe0, 0xe4, 0x7c, 0x3e, 0x94, 0xa0, 0x32, 0x3e, 0x42, 0x55, 0xd7, 0x43, 0x4a, 0x93, 0xc5, 0x7c,
+    0x23, 0x53, 0xc3, 0x8d, 0xba, 0xea, 0x0f, 0x1b, 0x41, 0x18, 0x8e, 0x4c, 0xb5, 0xc5, 0x41, 0x35,
+    0x5a, 0x58, 0x78, 0x18, 0x5b, 0x42, 0x85, 0x7a, 0xd5, 0xaf, 0x61, 0xee, 0x62, 0x87, 0x2e, 0xfa,
+    0xdc, 0x74, 0xb6, 0xa5, 0xe5, 0x61, 0x8f, 0x51, 0xc3, 0x11, 0x18, 0x50, 0x67, 0xcb, 0x97, 0xe6,
+    0x26, 0x0b, 0x97, 0xea, 0x04, 0x31, 0xdb, 0xd9, 0xbb, 0x25, 0xc5, 0xb0, 0xce, 0x10, 0x6e, 0x8d,
+    0x06, 0x3e, 0xa4, 0x34, 0x8b, 0x5d, 0x71, 0x3b, 0x5f, 0x8d, 0x38, 0x8b, 0x5e, 0x53, 0xfc, 0x94,
+    0x25, 0x27, 0x7e, 0x48, 0xd4, 0xa2, 0xf3, 0x1b, 0x35, 0x05, 0x29, 0xd0, 0xca, 0x56, 0x43, 0xfb,
+    0x0d, 0x4e, 0xe1, 0x95, 0x55, 0xa9, 0x30, 0xac, 0x16, 0x4b, 0x74, 0x69, 0x3a, 0x40, 0xb0, 0xb6,
+    0xde, 0xdd, 0x4b, 0x1d, 0xaf, 0xb3, 0xef, 0xf0, 0x9a, 0xbd, 0x9f, 0x32, 0x4d, 0x07, 0x43, 0x0b,
+    0x4a, 0x28, 0x2d, 0xdd, 0x86, 0xcb, 0x35, 0x34, 0x99, 0x99, 0x88, 0x7d, 0x6d, 0xac, 0xa0, 0x2e,
+    0x8e, 0x68, 0xda, 0x30, 0xa0, 0x14, 0x41, 0x85, 0x57, 0xd0, 0x64, 0x5b, 0xab, 0x0c, 0xa8, 0xb1,
+    0xa5, 0x99, 0x4b, 0x75, 0xec, 0x03, 0x87, 0x90, 0x90, 0x06, 0x26, 0x32, 0x67, 0x2c, 0x4f, 0x90,
+    0xab, 0x4a, 0xb8, 0xd5, 0xba, 0xc5, 0x82, 0xa0, 0x4d, 0x75, 0xd5, 0xb3, 0x21, 0xa1, 0x43, 0xb2,
+    0x92, 0xe4, 0x8a, 0x9d, 0x59, 0xa3, 0xdf, 0x94, 0xa7, 0x6a, 0x83, 0x9e, 0x62, 0xc2, 0xd2, 0xa9,
+    0x74, 0x57, 0x30, 0x5b, 0x37, 0x25, 0x60, 0xf6, 0xdb, 0xa3, 0x5e, 0x57, 0xe9, 0x94, 0xf6, 0xc3,
+    0x26, 0x3d, 0xee, 0x34, 0xa8, 0xc1, 0xb8, 0xd7, 0x2f, 0xed, 0xf4, 0xc9, 0xc0, 0x68, 0x4f, 0xea,
+    0xdb, 0x05, 0xb5, 0xef, 0x72, 0xfd, 0x22, 0xc9, 0x70, 0x22, 0x1d, 0x14, 0xe6, 0x82, 0xd0, 0xd1,
+    0xf4, 0x00, 0xf3, 0x0b, 0x7d, 0x3c, 0xec, 0xac, 0x20, 0xb8, 0x26, 0x97, 0x31, 0x65, 0x1d, 0xd0,
+    0x0a, 0x81, 0xb3, 0xdf, 0xed, 0xf8, 0x25, 0xaf, 0xa0, 0xfe, 0x88, 0xeb, 0x67, 0xb0, 0xe6, 0xcf,
+    0xe3, 0x0a, 0x3f, 0xfd, 0xbe, 0x9f, 0x7e, 0xdf, 0x4f, 0xbf, 0xef, 0xa7, 0xdf, 0xf7, 0xd3, 0xef,
+    0x7b, 0xf3, 0xb8, 0x02, 0xdd, 0x48, 0x1d, 0x57, 0x20, 0xe8, 0xee, 0x7c, 0xde, 0x1e, 0x15, 0x88,
+    0x0e, 0xce, 0x95, 0xfb, 0x58, 0x15, 0x81, 0x44, 0xb9, 0xe5, 0xb7, 0x67, 0x42, 0x55, 0x5c, 0xd5,
+    0x50, 0x6e, 0xb5, 0x68, 0xef, 0x64, 0x5f, 0xb5, 0x94, 0xc2, 0x5a, 0xdb, 0x32, 0x8c, 0x34, 0xd9,
+    0x43, 0x4e, 0x87, 0x29, 0x58, 0x3d, 0x04, 0x75, 0xf6, 0xec, 0x4a, 0x1b, 0xec, 0x59, 0x62, 0x6e,
+    0x23, 0x0b, 0x4b, 0x13, 0xa5, 0xb1, 0xef, 0x23, 0xf3, 0xdd, 0x70, 0x39, 0xb6, 0x0c, 0xb8, 0xd2,
+    0x0d, 0x18, 0xc4, 0xdb, 0x4e, 0xab, 0x46, 0x73, 0xd0, 0x2a, 0x17, 0x97, 0x7d, 0xaf, 0x80, 0x29,
+    0x25, 0x1c, 0xd9, 0xbb, 0x95, 0x4d, 0x71, 0x59, 0xaf, 0x6a, 0x4a, 0xa1, 0x28, 0x8c, 0x08, 0xa7,
+    0x5c, 0x16, 0x46, 0x21, 0x8f, 0x43, 0x28, 0x47, 0x60, 0xfa, 0xb0, 0xb8, 0x81, 0xab, 0xf5, 0x29,
+    0x0e, 0x2c, 0x21, 0x31, 0x5d, 0x4c, 0x67, 0x85, 0x70, 0x05, 0x5a, 0x6c, 0x2c, 0x7e, 0xcd, 0x7a,
+    0x06, 0xd9, 0xdb, 0x88, 0xdd, 0xf5, 0x38, 0x5c, 0x4c, 0x3b, 0x9e, 0xd9, 0xb2, 0xfc, 0x29, 0x87,
+    0xaf, 0xbb, 0xc1, 0xbc, 0xec, 0xef, 0x57, 0x96, 0x34, 0xe4, 0xeb, 0x3d, 0xa5, 0x34, 0x54, 0xcc,
+    0xc9, 0x9a, 0xad, 0xce, 0x54, 0x02, 0x5b, 0xd5, 0x95, 0xf6, 0x80, 0x55, 0x65, 0x89, 0x47, 0xea,
+    0xeb, 0x4d, 0xaf, 0xdb, 0x9d, 0xf9, 0x5a, 0x68, 0xea, 0xdd, 0xae, 0x55, 0xa9, 0xcf, 0x82, 0x11,
+    0xdf, 0x56, 0x48, 0xad, 0x56, 0x15, 0x8c, 0x76, 0x48, 0xcf, 0x27, 0xb8, 0xdf, 0x1e, 0xd6, 0x9c,
+    0xbd, 0x34, 0xa9, 0xd3, 0x5d, 0x7e, 0xee, 0x4b, 0x43, 0x67, 0xef, 0x41, 0x90, 0x38, 0x9e, 0xaf,
+    0x81, 0x93, 0xaa, 0xa0, 0x6b, 0xd4, 0x2f, 0xe9, 0x5b, 0x6a, 0x59, 0x85, 0x1c, 0xa9, 0xe3, 0x12,
+    0x13, 0x57, 0x6c, 0x49, 0xd3, 0x3a, 0x53, 0xdb, 0xd9, 0x1d, 0xac, 0x50, 0x05, 0xba, 0xd7, 0x47,
+    0x75, 0x07, 0x29, 0x56, 0xda, 0x52, 0xab, 0xb6, 0xa9, 0x15, 0x88, 0xe9, 0x7e, 0x46, 0xba, 0x3d,
+    0x63, 0x1e, 0x96, 0x95, 0xa1, 0xb0, 0xc2, 0xe6, 0xb0, 0xbf, 0xd5, 0xd1, 0x36, 0x4c, 0xe2, 0xcb,
+    0xd5, 0x1a, 0x2a, 0xd0, 0xfc, 0x54, 0xdd, 0x0c, 0xec, 0xa1, 0xc4, 0xf7, 0x9a, 0x12, 0xd5, 0xf3,
+    0x87, 0x7a, 0xa1, 0x23, 0x78, 0xb5, 0x6d, 0xbb, 0x5b, 0x61, 0x5b, 0xed, 0x92, 0xd4, 0x69, 0xc2,
+    0x2d, 0xe0, 0x53, 0x5a, 0xad, 0x39, 0xe7, 0x2f, 0x42, 0x74, 0x3d, 0x25, 0xbb, 0x1b, 0xc7, 0x97,
+    0xd8, 0x41, 0x5d, 0xf0, 0xe1, 0x86, 0x29, 0xd7, 0x8a, 0x14, 0x6d, 0xae, 0x1b, 0xe2, 0x14, 0xb1,
+    0xb9, 0xe1, 0x6c, 0x5d, 0x46, 0x8b, 0xf4, 0x8a, 0x1d, 0x51, 0x85, 0x5a, 0x79, 0xd3, 0xee, 0x05,
+    0x9d, 0x66, 0x53, 0xf2, 0xed, 0x65, 0x33, 0xb0, 0xd1, 0xc2, 0xaa, 0xb5, 0xed, 0x6f, 0xbc, 0x70,
+    0xa4, 0xa9, 0x0e, 0xd4, 0xee, 0x97, 0x66, 0x81, 0x0d, 0x3c, 0xc7, 0x06, 0x4f, 0xf3, 0x24, 0xe9,
+    0xf2, 0x21, 0x6c, 0xe8, 0x2a, 0x01, 0x0d, 0x57, 0x08, 0x47, 0x74, 0xa0, 0x9a, 0xb7, 0x50, 0xf4,
+    0x61, 0xbf, 0x65, 0x92, 0xfd, 0x5d, 0x68, 0x92, 0x76, 0x9f, 0x69, 0x33, 0x75, 0xb4, 0x13, 0x2e,
+    0x6a, 0xb5, 0xad, 0x5d, 0xdf, 0x4f, 0x66, 0xb3, 0xee, 0xd6, 0xda, 0x07, 0x6d, 0x4b, 0xf5, 0xe7,
+    0x7b, 0x55, 0x6a, 0x54, 0x68, 0xbb, 0x3c, 0x1c, 0x23, 0x68, 0x53, 0x10, 0xe1, 0x15, 0xdb, 0xd2,
+    0xa5, 0x16, 0xec, 0x0c, 0x24, 0x7a, 0x3e, 0x46, 0xba, 0x8a, 0x52, 0x6b, 0x4f, 0xa4, 0x5a, 0xd1,
+    0xae, 0xf5, 0x80, 0x8b, 0x5c, 0x81, 0x4a, 0x6c, 0x83, 0x19, 0xcc, 0xc4, 0x32, 0x31, 0xa1, 0x14,
+    0x2b, 0x10, 0xdc, 0x49, 0xc9, 0x18, 0xef, 0x76, 0x98, 0x24, 0xec, 0x36, 0x7d, 0xb6, 0xc0, 0x54,
+    0x2d, 0x71, 0x57, 0x73, 0x0b, 0x85, 0x26, 0xc1, 0x7a, 0x23, 0xac, 0x0d, 0xa1, 0xd0, 0x18, 0xdd,
+    0x13, 0x63, 0x6f, 0x62, 0x0a, 0xcd, 0xd9, 0x60, 0xbb, 0xd1, 0xd4, 0x12, 0x56, 0x81, 0xf5, 0xcd,
+    0xb2, 0x58, 0xda, 0xa1, 0x0d, 0x1d, 0xf7, 0x10, 0xa8, 0x37, 0x87, 0x1b, 0x44, 0x71, 0x59, 0x1a,
+    0x17, 0x07, 0x86, 0x66, 0x6d, 0x1a, 0xca, 0xa8, 0x04, 0x68, 0xad, 0xd1, 0xba, 0x46, 0x56, 0x07,
+    0xfa, 0x6a, 0x12, 0x38, 0x45, 0xba, 0xb5, 0x64, 0xc6, 0x74, 0x63, 0xdb, 0xa3, 0xe7, 0x04, 0x46,
+    0x0a, 0x32, 0xbc, 0xec, 0xb2, 0x2c, 0x3b, 0x1b, 0x15, 0xfc, 0xbd, 0x09, 0x77, 0x86, 0x84, 0x47,
+    0xd9, 0x21, 0x8f, 0xa0, 0xeb, 0x86, 0x4d, 0x86, 0xde, 0x48, 0xaf, 0x94, 0x6a, 0x78, 0xb9, 0x43,
+    0x75, 0xe4, 0x9a, 0xde, 0x9e, 0x97, 0x30, 0xb6, 0x8b, 0x72, 0x8a, 0xdc, 0x95, 0x2a, 0xf4, 0x64,
+    0xb3, 0xdc, 0x4e, 0xa9, 0x49, 0x45, 0x26, 0xfd, 0xc9, 0x6c, 0xce, 0x71, 0xa2, 0xa0, 0x10, 0x1d,
+    0xa5, 0xd2, 0xc3, 0x4a, 0x52, 0x0b, 0xb1, 0xed, 0x10, 0xaf, 0xbb, 0xb4, 0xcb, 0x8a, 0x3c, 0x36,
+    0x46, 0x6c, 0x81, 0x95, 0xaa, 0xfe, 0x88, 0x55, 0x87, 0x5c, 0xab, 0xa5, 0x74, 0xca, 0x55, 0x5a,
+    0xd9, 0x53, 0x45, 0x52, 0x00, 0xc1, 0xcb, 0x0a, 0x6a, 0x4f, 0x4b, 0x52, 0xb1, 0xd4, 0x59, 0x58,
+    0x7e, 0xd3, 0x72, 0x9c, 0xbe, 0x31, 0x08, 0x8b, 0x32, 0x35, 0xe8, 0x52, 0x55, 0xd1, 0x31, 0x2d,
+    0x8c, 0xea, 0x8d, 0xa5, 0x5e, 0x6f, 0xaa, 0x8d, 0x27, 0x76, 0x85, 0xa8, 0x19, 0xfe, 0x72, 0x60,
+    0x72, 0x14, 0x5a, 0x0b, 0xeb, 0xc5, 0x1d, 0xad, 0xac, 0x9b, 0xd2, 0xae, 0xdb, 0x85, 0xa9, 0x46,
+    0x45, 0x68, 0x74, 0xcb, 0xcb, 0xf9, 0x02, 0x2d, 0xb6, 0xdc, 0x52, 0x57, 0x26, 0x84, 0xb0, 0x5b,
+    0xec, 0x0e, 0x46, 0x62, 0x7f, 0x56, 0x9e, 0x8b, 0x93, 0x1a, 0xb5, 0x1d, 0x37, 0x57, 0x92, 0x3c,
+    0x5e, 0xd6, 0x71, 0x92, 0x1b, 0x35, 0xb6, 0x13, 0xa1, 0x8f, 0xbb, 0x94, 0x3d, 0xac, 0x55, 0x1b,
+    0xfd, 0xaa, 0xcd, 0x77, 0x7c, 0xbc, 0x5a, 0xe9, 0xd8, 0x92, 0xc9, 0x08, 0x1d, 0x7f, 0xba, 0xc0,
+    0x80, 0xef, 0xd3, 0x31, 0x36, 0x8d, 0x31, 0xcc, 0x8b, 0xf8, 0x74, 0xa6, 0x81, 0x70, 0x65, 0xd5,
+    0x58, 0xc8, 0x01, 0x57, 0x53, 0xaa, 0x4b, 0xdb, 0xdb, 0x16, 0x8d, 0xc5, 0x5c, 0x23, 0xf7, 0x1a,
+    0x69, 0x0f, 0x1b, 0xc6, 0x56, 0x1a, 0x96, 0xc7, 0xbb, 0x81, 0x4c, 0x8c, 0xe6, 0x75, 0xd7, 0x0d,
+    0xca, 0x93, 0xc5, 0x6a, 0x5f, 0xea, 0x17, 0xe6, 0x1b, 0x08, 0x1a, 0x8f, 0x9d, 0x16, 0x5c, 0xee,
+    0x16, 0x67, 0xa5, 0x81, 0xa1, 0x13, 0x73, 0x9f, 0x18, 0xb1, 0x3d, 0xd4, 0x6e, 0x77, 0x47, 0xa4,
+    0xb3, 0xad, 0xd0, 0x6e, 0x99, 0x5b, 0x06, 0xc3, 0xd0, 0xed, 0xef, 0x8a, 0x3a, 0xb6, 0x21, 0xda,
+    0x85, 0xf6, 0x9a, 0x61, 0x27, 0x8d, 0x59, 0x03, 0xdb, 0x37, 0x4b, 0x65, 0x77, 0xa1, 0xce, 0xfa,
+    0xdd, 0xfd, 0x64, 0x84, 0xcd, 0x3c, 0x72, 0x31, 0x0e, 0x91, 0x75, 0xe8, 0xc2, 0x86, 0x24, 0xa9,
+    0x0c, 0x1c, 0x94, 0xdd, 0x19, 0x44, 0xf5, 0x95, 0x0e, 0x3d, 0x12, 0xe6, 0xe1, 0x08, 0xe2, 0x6b,
+    0xdb, 0xe6, 0x92, 0xb3, 0x03, 0x6a, 0xe5, 0x4d, 0x96, 0xec, 0x18, 0x19, 0x5a, 0xd6, 0xb8, 0x33,
+    0xe5, 0xf6, 0xa5, 0xb6, 0xb7, 0x9b, 0xe8, 0x95, 0x0d, 0xd6, 0x9d, 0x0f, 0x96, 0x41, 0x99, 0x80,
+    0xa8, 0xc1, 0xa4, 0x49, 0x4a, 0x0c, 0x89, 0x96, 0x27, 0x73, 0xd4, 0xd9, 0x8d, 0x9b, 0x8b, 0x0d,
+    0x3d, 0xa4, 0x91, 0x2e, 0xe6, 0xf9, 0x9e, 0x27, 0xb7, 0x2c, 0x69, 0xa1, 0x52, 0x43, 0x84, 0xd9,
+    0xce, 0xa7, 0x4b, 0xa7, 0x54, 0x73, 0x5a, 0x40, 0xcd, 0x47, 0x82, 0xb9, 0x1f, 0xf7, 0xa1, 0x65,
+    0x40, 0x77, 0x1a, 0x7d, 0xb2, 0xc1, 0x0b, 0xdb, 0x80, 0x9e, 0x49, 0x04, 0x34, 0x85, 0x8d, 0x7a,
+    0xb0, 0x12, 0x39, 0xc1, 0xb6, 0x0c, 0x79, 0xb5, 0x1d, 0x59, 0xa1, 0xd9, 0xb6, 0x69, 0xaf, 0xb5,
+    0x2f, 0xad, 0xba, 0xc6, 0x66, 0x31, 0xaf, 0x74, 0xc1, 0xb2, 0x23, 0xaa, 0xc3, 0xc0, 0xeb, 0x6a,
+    0x78, 0x01, 0x6a, 0xd7, 0xbc, 0x39, 0xd2, 0xf5, 0xc2, 0x00, 0x92, 0xb5, 0xa2, 0x5e, 0x1d, 0xaf,
+    0x49, 0xbd, 0x84, 0x29, 0xab, 0x66, 0xa9, 0x35, 0x08, 0xe6, 0x60, 0x85, 0xe9, 0x54, 0x87, 0x4d,
+    0xbf, 0xb1, 0x2f, 0xf4, 0x17, 0x88, 0x5e, 0xad, 0x04, 0x9e, 0x27, 0xe1, 0x34, 0xba, 0x37, 0xf1,
+    0xaa, 0x57, 0x0a, 0x9b, 0xba, 0xbc, 0x1b, 0xc0, 0x3d, 0x75, 0xb3, 0x9f, 0xf7, 0x68, 0xb9, 0xcc,
+    0x15, 0xc7, 0xed, 0x12, 0x55, 0x29, 0x54, 0xb7, 0xab, 0x11, 0xef, 0x51, 0x85, 0x89, 0xb1, 0x5f,
+    0xda, 0xe2, 0x52, 0x93, 0x3b, 0x8b, 0x4d, 0x99, 0xf0, 0xcb, 0xd0, 0x84, 0xdc, 0x34, 0x97, 0xd2,
+    0xda, 0x35, 0xad, 0x82, 0xd2, 0x54, 0x3b, 0x3c, 0x42, 0x0d, 0x96, 0x4b, 0x4f, 0xd3, 0xb1, 0xc9,
+    0xb6, 0xd3, 0x37, 0x71, 0xd4, 0x61, 0x9d, 0x31, 0x39, 0x6c, 0x76, 0xa7, 0xa6, 0x3a, 0x9e, 0x52,
+    0x02, 0x6b, 0x52, 0xae, 0x0f, 0x1c, 0x83, 0xe5, 0x7e, 0xb4, 0xb4, 0x94, 0x8e, 0x23, 0x4d, 0x05,
+    0x75, 0x56, 0xda, 0xac, 0x1b, 0x70, 0xa9, 0x52, 0x1c, 0x07, 0x4b, 0xb4, 0x1d, 0x76, 0x94, 0x59,
+    0xb3, 0xd8, 0x50, 0xbb, 0x5e, 0xb1, 0x8c, 0xac, 0x4a, 0xeb, 0x4e, 0xbf, 0xb9, 0x0e, 0x07, 0x0d,
+    0x48, 0x2f, 0x8c, 0xf4, 0x6a, 0x61, 0x40, 0x75, 0x8b, 0x6b, 0x65, 0xd9, 0xe6, 0x15, 0x6d, 0x64,
+    0xb5, 0xc6, 0xd3, 0xf5, 0x6c, 0x1d, 0xce, 0xcb, 0x42, 0x38, 0xf1, 0xcd, 0x70, 0xdf, 0x6f, 0x77,
+    0x7a, 0xa5, 0xd6, 0x04, 0x73, 0x0a, 0x0d, 0xa4, 0x51, 0x92, 0xa9, 0xe5, 0x7c, 0x50, 0x6a, 0x36,
+    0xb8, 0x64, 0x65, 0x6a, 0xaa, 0x2d, 0x5a, 0x99, 0xba, 0x63, 0xad, 0x5e, 0xff, 0xab, 0x12, 0xdf,
+    0x86, 0xf7, 0x33, 0xfa, 0xf9, 0x19, 0xfd, 0xfc, 0x8c, 0x7e, 0x7e, 0x46, 0x3f, 0x3f, 0xa3, 0x9f,
+    0x9f, 0xd1, 0xcf, 0x3b, 0xa2, 0x1f, 0x3a, 0x15, 0xfd, 0x24, 0xaf, 0xd4, 0x8e, 0xca, 0xda, 0xde,
+    0x0d, 0x5c, 0x15, 0x5b, 0x49, 0xbd, 0xda, 0x84, 0x59, 0x94, 0xc8, 0x09, 0x3f, 0x11, 0x05, 0x60,
+    0x9e, 0xb7, 0x41, 0x6b, 0x27, 0x12, 0x22, 0x51, 0x1b, 0x57, 0x27, 0x02, 0x35, 0x37, 0x54, 0x49,
+    0x82, 0x0a, 0xdd, 0x7a, 0x27, 0x68, 0x4e, 0xc8, 0xe9, 0x76, 0x26, 0x23, 0x95, 0x49, 0x6b, 0x40,
+    0xd5, 0xcd, 0x41, 0x69, 0x37, 0xac, 0xa2, 0x22, 0x47, 0xec, 0x7a, 0x2d, 0x03, 0xee, 0x19, 0xe3,
+    0xa9, 0x35, 0x53, 0x0c, 0x99, 0xa9, 0x2f, 0x5a, 0xb6, 0x81, 0xad, 0xb6, 0x9c, 0xed, 0xa0, 0x1c,
+    0x0e, 0x2d, 0x79, 0x17, 0xc7, 0x36, 0xda, 0xa6, 0x44, 0x2d, 0x98, 0x6d, 0x59, 0xc4, 0x47, 0xd4,
+    0xbe, 0xa3, 0x56, 0xf8, 0x02, 0xb3, 0xe1, 0x2b, 0x25, 0x9c, 0x0a, 0xd1, 0x71, 0x91, 0xe9, 0x16,
+    0x0b, 0xeb, 0x19, 0xc0, 0xbd, 0x9a, 0x05, 0x05, 0x97, 0x61, 0x3d, 0x30, 0xb5, 0xa5, 0x7a, 0x7f,
+    0x61, 0xf6, 0x96, 0xf3, 0xd6, 0x6a, 0xac, 0xf2, 0xe5, 0xae, 0x3d, 0x69, 0x4d, 0x7c, 0x75, 0x30,
+    0x0c, 0x75, 0xaf, 0xd1, 0xd8, 0xba, 0xb5, 0xcd, 0xb2, 0x39, 0x18, 0xf9, 0x25, 0xba, 0xdb, 0x00,
+    0x5e, 0xa5, 0xd9, 0x2a, 0x77, 0xfd, 0x11, 0xc9, 0x4e, 0xf1, 0x3e, 0x42, 0xd7, 0x50, 0xda, 0x1a,
+    0x4c, 0xcc, 0xb6, 0x3c, 0x43, 0x2b, 0x16, 0xb7, 0x6d, 0x05, 0x4e, 0x97, 0xda, 0x22, 0xdb, 0xee,
+    0x28, 0x04, 0x86, 0x0b, 0x58, 0xf9, 0xe1, 0x66, 0xb7, 0x21, 0x83, 0xb0, 0xb8, 0x32, 0x58, 0x66,
+    0x05, 0x5a, 0x84, 0x6e, 0xb3, 0x19, 0x62, 0x43, 0x73, 0xe8, 0x19, 0xbd, 0x9d, 0xa6, 0x81, 0x58,
+    0x0f, 0x43, 0xbd, 0xed, 0x7a, 0x2c, 0x12, 0x95, 0xe9, 0xa4, 0xde, 0xd8, 0xc3, 0x54, 0x99, 0x5f,
+    0x6f, 0xc6, 0x40, 0xe2, 0x09, 0x5b, 0x13, 0x8c, 0x01, 0x07, 0x8c, 0x6e, 0x41, 0x9c, 0xd8, 0xfd,
+    0xc6, 0x1e, 0xc5, 0x3b, 0x2b, 0x6a, 0xde, 0xd3, 0xba, 0x05, 0x84, 0xf4, 0x3a, 0xbd, 0xbe, 0x0b,
+    0x34, 0xc8, 0x6d, 0xeb, 0x3a, 0x3c, 0x10, 0xe7, 0x13, 0x9d, 0x42, 0xa4, 0x95, 0xb2, 0x03, 0xc4,
+    0x81, 0x8a, 0xb0, 0xae, 0x99, 0x93, 0xca, 0x58, 0xb4, 0x95, 0x15, 0x4d, 0x14, 0x50, 0x65, 0xd5,
+    0x9f, 0xc1, 0xf6, 0xbc, 0xe2, 0x92, 0x18, 0x31, 0x1b, 0xe2, 0x60, 0x19, 0x5a, 0x17, 0x69, 0xb5,
+    0xc9, 0x40, 0xec, 0x74, 0xca, 0x4f, 0x0b, 0x64, 0xd9, 0x69, 0x6e, 0x05, 0xa0, 0x0d, 0x76, 0x7d,
+    0xed, 0x09, 0x28, 0x30, 0x38, 0x18, 0x8d, 0x4d, 0xb4, 0x81, 0xb5, 0xd8, 0x42, 0x63, 0x92, 0xc6,
+    0x20, 0xe0, 0xb4, 0x76, 0x65, 0xae, 0x33, 0x19, 0xaa, 0x66, 0x45, 0x2b, 0xd1, 0xe1, 0x74, 0x88,
+    0x63, 0x86, 0x64, 0xb5, 0x6a, 0x82, 0xcc, 0x6a, 0x08, 0x12, 0xb6, 0x2b, 0xdc, 0xda, 0x13, 0x37,
+    0x12, 0x0c, 0x49, 0x16, 0xd1, 0xdf, 0x48, 0x6c, 0x07, 0x29, 0xeb, 0xfe, 0x7c, 0x3a, 0xc2, 0x11,
+    0x7f, 0xcb, 0x31, 0x3d, 0x91, 0x9e, 0xe3, 0xbd, 0x65, 0x03, 0xc5, 0xd6, 0x9b, 0x59, 0x1f, 0xd3,
+    0xad, 0x71, 0x59, 0x35, 0x06, 0xec, 0x68, 0xea, 0xb6, 0x36, 0xcc, 0x1e, 0x93, 0x8c, 0x29, 0x8f,
+    0x8e, 0xe0, 0x45, 0x4d, 0x65, 0x96, 0xab, 0xc2, 0x56, 0x55, 0xd1, 0xba, 0x30, 0x9c, 0x0e, 0x2a,
+    0x86, 0x30, 0xdb, 0x34, 0x07, 0xa1, 0x0f, 0xaf, 0x04, 0xa4, 0xc9, 0x86, 0x3b, 0xb4, 0x1a, 0x80,
+    0x95, 0xbf, 0xde, 0x91, 0xa4, 0x5a, 0x99, 0xad, 0x8d, 0xc0, 0x72, 0x81, 0xc9, 0xf2, 0x00, 0x81,
+    0x3a, 0xa8, 0x28, 0x57, 0x57, 0x4b, 0x64, 0x3d, 0xdc, 0x4e, 0xea, 0x26, 0xf0, 0x01, 0x75, 0xa3,
+    0xb9, 0xb7, 0xb4, 0xfd, 0x58, 0x2c, 0xb8, 0x0b, 0xde, 0xe9, 0x87, 0x22, 0xb6, 0x5c, 0xe3, 0x95,
+    0x42, 0x77, 0xd9, 0xa3, 0x6a, 0x5e, 0x1d, 0xb5, 0x37, 0xb8, 0x33, 0x29, 0xf4, 0x01, 0x33, 0xb7,
+    0xc0, 0x56, 0xac, 0xed, 0xc5, 0x78, 0xa6, 0xd8, 0xfd, 0x3e, 0x55, 0x83, 0x66, 0x13, 0xbc, 0x81,
+    0xb5, 0x02, 0x7a, 0x5b, 0xac, 0xf1, 0x5b, 0x7c, 0x24, 0x6a, 0x0a, 0xbc, 0x2c, 0xad, 0x24, 0xbf,
+    0xd8, 0x1b, 0x22, 0x75, 0xc6, 0xb7, 0xea, 0x14, 0x55, 0x2d, 0xc2, 0xf5, 0x16, 0x30, 0x03, 0x5e,
+    0x93, 0xb4, 0x24, 0x2a, 0x30, 0xd0, 0x8e, 0x5d, 0xb2, 0xf5, 0xa6, 0x5f, 0x34, 0xf7, 0xa5, 0xad,
+    0x30, 0x86, 0xbc, 0x51, 0x7d, 0xa6, 0x90, 0xd2, 0x92, 0x90, 0x3a, 0x0a, 0x15, 0x72, 0xbd, 0x22,
+    0xf0, 0x45, 0x8b, 0x1c, 0x41, 0xb6, 0x4b, 0x2b, 0xac, 0x3c, 0xeb, 0x77, 0x2a, 0x7a, 0x5f, 0xd9,
+    0xb7, 0x08, 0x97, 0xda, 0xef, 0x08, 0x61, 0x28, 0xf5, 0x55, 0xc3, 0x86, 0x16, 0xd6, 0xa4, 0xb9,
+    0x13, 0x5b, 0x35, 0x10, 0x13, 0x51, 0x34, 0x59, 0xdc, 0xee, 0x7a, 0x73, 0xac, 0xba, 0x98, 0x0e,
+    0x61, 0xae, 0x59, 0x6e, 0x11, 0x50, 0x65, 0xda, 0x6a, 0x9b, 0xa6, 0x38, 0xee, 0xf5, 0x07, 0xfb,
+    0x09, 0x57, 0x5d, 0x0b, 0x92, 0xe1, 0x29, 0x0a, 0xb3, 0xf5, 0xe5, 0xc9, 0x7e, 0x26, 0x42, 0xb5,
+    0xc6, 0xbc, 0x28, 0x4b, 0x25, 0xd8, 0xd5, 0xe8, 0xf9, 0x46, 0x6d, 0xd0, 0x41, 0x05, 0xd6, 0x6a,
+    0x75, 0x06, 0x1f, 0x58, 0xeb, 0x32, 0x87, 0x8d, 0xd1, 0xb2, 0x0d, 0x8f, 0x8a, 0x13, 0xb3, 0x10,
+    0x2e, 0x7a, 0x8e, 0x11, 0xcc, 0xec, 0xc9, 0xaa, 0x8f, 0xee, 0x30, 0xab, 0x56, 0x95, 0xda, 0x4a,
+    0xa5, 0xe1, 0x61, 0xf4, 0x16, 0x43, 0xc6, 0xee, 0xaa, 0xdb, 0xe3, 0xac, 0x8d, 0x41, 0x4d, 0xca,
+    0xaa, 0x3f, 0xe8, 0xd4, 0x0b, 0x78, 0xaf, 0xdf, 0xd4, 0x18, 0x61, 0x55, 0x28, 0x17, 0x4a, 0x0d,
+    0xd1, 0xd7, 0xa4, 0x5d, 0x0b, 0x2b, 0xc0, 0xf8, 0xc6, 0x98, 0xb6, 0x79, 0xa2, 0x6b, 0xd0, 0x55,
+    0x74, 0x5a, 0x25, 0xfd, 0x12, 0x33, 0x73, 0x17, 0x24, 0xef, 0x06, 0x41, 0x38, 0xc3, 0xdd, 0x02,
+    0x88, 0x89, 0x5a, 0xab, 0x4a, 0x55, 0xc5, 0x5d, 0xab, 0x22, 0xce, 0x4d, 0x12, 0xc4, 0x35, 0xbd,
+    0x55, 0xb7, 0x3b, 0xa9, 0x57, 0x29, 0x1d, 0x2d, 0xb5, 0xc2, 0x01, 0xdc, 0x9d, 0x90, 0x93, 0x79,
+    0xc8, 0x2e, 0xaa, 0x85, 0x70, 0xd2, 0xf0, 0xf7, 0xfc, 0x0a, 0x0b, 0x8b, 0x83, 0x3e, 0x83, 0x29,
+    0x6c, 0xb7, 0x4e, 0x88, 0x0d, 0xda, 0xa8, 0xe3, 0xab, 0x5e, 0x1f, 0x68, 0xcd, 0x60, 0x64, 0x75,
+    0xb7, 0x6b, 0x46, 0x03, 0x41, 0xbd, 0xbd, 0x29, 0x2f, 0x50, 0xba, 0x4c, 0x4e, 0x5b, 0x0a, 0xb7,
+    0xe9, 0x71, 0x64, 0xd7, 0x41, 0x7d, 0xaf, 0xb9, 0xab, 0x63, 0xc3, 0x11, 0x4c, 0xac, 0x74, 0x9e,
+    0x5d, 0x3a, 0x13, 0xc3, 0xdc, 0xca, 0x84, 0xb8, 0x75, 0x86, 0x05, 0x0e, 0xf1, 0xf7, 0xfb, 0x4a,
+    0x6b, 0xed, 0xf7, 0x85, 0x62, 0x87, 0xf2, 0xc8, 0xdd, 0x9c, 0x9f, 0x23, 0x3b, 0x69, 0xa9, 0xb8,
+    0x03, 0xb7, 0xb3, 0x50, 0x78, 0x82, 0x58, 0xf4, 0x08, 0x49, 0x18, 0x14, 0x7b, 0x9e, 0x60, 0x10,
+    0x16, 0xf0, 0xe3, 0x97, 0x6b, 0x66, 0x35, 0xc1, 0xd1, 0xfd, 0x68, 0x4c, 0xce, 0x7a, 0x75, 0x5b,
+    0xa8, 0x62, 0x9b, 0x0e, 0x56, 0xd0, 0x1d, 0x82, 0x15, 0x56, 0x8c, 0x64, 0x0d, 0x68, 0xb6, 0xdf,
+    0x09, 0x0b, 0x7b, 0x54, 0xdf, 0x7b, 0x92, 0xe0, 0xd5, 0x80, 0xc2, 0xfa, 0xcd, 0x2d, 0xbf, 0x6a,
+    0x90, 0xca, 0x50, 0x34, 0x07, 0x63, 0x48, 0x5d, 0x39, 0x9e, 0xd4, 0xdf, 0x54, 0x68, 0xa9, 0xb5,
+    0xa7, 0x38, 0x7c, 0xe3, 0x32, 0x33, 0x8a, 0x22, 0xf7, 0xed, 0xae, 0x29, 0xf7, 0x47, 0x8a, 0x8a,
+    0x7b, 0x1b, 0x88, 0x18, 0x10, 0x48, 0x67, 0xd6, 0x29, 0x40, 0x35, 0x67, 0xec, 0x4f, 0x6a, 0x44,
+    0x9b, 0x70, 0xe6, 0x35, 0xaf, 0x3b, 0x58, 0x0b, 0xc0, 0xfc, 0x23, 0x20, 0x8e, 0x2f, 0x9a, 0x2e,
+    0xe2, 0x79, 0x42, 0x83, 0xa2, 0xf5, 0x41, 0x9f, 0xf0, 0xc4, 0x46, 0x35, 0x20, 0x47, 0x38, 0x61,
+    0xef, 0x20, 0x78, 0xc3, 0x30, 0xfc, 0x16, 0xc4, 0x29, 0x61, 0x43, 0xd0, 0xe5, 0x19, 0xe2, 0x54,
+    0xfb, 0x63, 0x6f, 0xe7, 0x75, 0x74, 0x72, 0xb7, 0x34, 0x06, 0x43, 0xa6, 0x50, 0x20, 0x85, 0xdd,
+    0xb4, 0x59, 0x2e, 0x14, 0xd7, 0xf4, 0xd0, 0x90, 0x8a, 0x72, 0x85, 0x9a, 0xd8, 0x6e, 0xb9, 0xe8,
+    0xf1, 0x4c, 0xbb, 0x37, 0x5f, 0xd5, 0x06, 0x85, 0x1e, 0x3b, 0xc6, 0x80, 0xdd, 0x92, 0xec, 0x65,
+    0xc5, 0x5b, 0x59, 0x30, 0x51, 0x6f, 0x23, 0xa5, 0x6a, 0xc7, 0xb7, 0x8a, 0xed, 0x0a, 0x55, 0x22,
+    0xa4, 0x49, 0x69, 0xe4, 0xec, 0xba, 0x28, 0x56, 0xc2, 0xfb, 0x8e, 0x67, 0x13, 0x9c, 0x14, 0xb9,
+    0x8a, 0x73, 0xb7, 0xb0, 0x56, 0xba, 0x0e, 0x5f, 0x08, 0xda, 0x76, 0x67, 0x6f, 0x4a, 0xdc, 0xa4,
+    0x24, 0x34, 0x87, 0xd4, 0xa0, 0x37, 0x0a, 0x2c, 0x5c, 0xda, 0xa0, 0x2a, 0x32, 0xd6, 0xc0, 0x2a,
+    0xba, 0xe5, 0xf9, 0x05, 0x3d, 0x2a, 0x60, 0xf5, 0x02, 0xb9, 0x52, 0xca, 0xc0, 0x5d, 0x25, 0x67,
+    0x9d, 0x76, 0x13, 0xa1, 0x43, 0x83, 0x03, 0x96, 0x89, 0xed, 0xf4, 0x2b, 0xc3, 0xbd, 0x69, 0x22,
+    0x40, 0x85, 0xc9, 0x06, 0xec, 0xab, 0x6b, 0x17, 0x58, 0x28, 0x4c, 0x81, 0x45, 0xa8, 0x18, 0x2e,
+    0x7b, 0xb3, 0x76, 0x45, 0xb3, 0xbb, 0xb5, 0x40, 0xde, 0x76, 0xdd, 0x8a, 0x45, 0x6c, 0xdc, 0x69,
+    0x1d, 0xee, 0xf3, 0xa4, 0xb8, 0x85, 0x42, 0x68, 0x01, 0x97, 0xb6, 0x1a, 0x4b, 0x2f, 0xc8, 0x15,
+    0xd9, 0xdf, 0xd6, 0x02, 0x68, 0xa9, 0x68, 0xe3, 0x76, 0x65, 0xd6, 0x92, 0x96, 0x34, 0xb5, 0xb7,
+    0xe1, 0xc6, 0x2c, 0x94, 0xba, 0x81, 0x2b, 0x35, 0xb9, 0xb2, 0xa0, 0x10, 0x63, 0xc2, 0x6b, 0x04,
+    0xae, 0xdf, 0xa4, 0xc9, 0xd9, 0xd4, 0x7f, 0xf7, 0x41, 0xfa, 0xf7, 0x46, 0x45, 0xf7, 0xcf, 0xd0,
+    0x83, 0xef, 0xa9, 0xbb, 0xc5, 0xce, 0xc7, 0xa2, 0x3f, 0x41, 0xf1, 0xbd, 0x5b, 0xc7, 0x8f, 0x5b,
+    0x77, 0x7d, 0xbd, 0x72, 0x1d, 0xd7, 0xd5, 0xe5, 0x5b, 0xf7, 0x2f, 0xc8, 0xba, 0x7b, 0xaf, 0xd6,
+    0xbb, 0x2a, 0xd2, 0xb8, 0x2e, 0x2f, 0xda, 0x4a, 0x9d, 0xdd, 0x8f, 0xdf, 0x08, 0x4e, 0xf1, 0x20,
+    0x7e, 0x8e, 0xc6, 0x14, 0x45, 0x86, 0xa2, 0xc5, 0x98, 0x52, 0x3e, 0x17, 0x1f, 0x7c, 0x07, 0x03,
+    0x89, 0x6f, 0x7b, 0xcc, 0x7f, 0x49, 0x46, 0x7e, 0xd1, 0xe8, 0x38, 0xda, 0xd3, 0xfd, 0x70, 0xa9,
+    0x53, 0xe1, 0x99, 0x13, 0xe1, 0xa0, 0x1e, 0x4e, 0x1f, 0x08, 0x3f, 0xc2, 0x3f, 0xc0, 0x8f, 0x1f,
+    0x4f, 0xaf, 0x1d, 0x24, 0x17, 0x04, 0xe6, 0xbf, 0x54, 0x55, 0xf5, 0xfc, 0x2e, 0xf3, 0xc6, 0xca,
+    0x5c, 0x1e, 0x76, 0x81, 0x14, 0xb9, 0x89, 0x14, 0x01, 0x48, 0xbf, 0x20, 0xd2, 0x7b, 0x91, 0xa0,
+    0x37, 0x91, 0xa0, 0x11, 0x12, 0x5c, 0x7b, 0x2f, 0x12, 0xec, 0x26, 0x12, 0x2c, 0x42, 0x82, 0xc1,
+    0xf6, 0x7b, 0xb1, 0x14, 0x6f, 0x62, 0x29, 0x46, 0x58, 0xea, 0x2a, 0xcf, 0x58, 0xb7, 0xf1, 0x5c,
+    0x4d, 0xe5, 0xe9, 0xf9, 0x28, 0xda, 0x27, 0x49, 0x3e, 0x0a, 0xb0, 0xcd, 0x5a, 0xb2, 0xe9, 0x1c,
+    0xde, 0x94, 0xd7, 0x0c, 0xce, 0x3d, 0xcc, 0x5d, 0x72, 0xdb, 0x61, 0xee, 0xbf, 0x72, 0x8c, 0x9d,
+    0xe3, 0xb0, 0x9c, 0x60, 0x19, 0x5a, 0x2e, 0x2f, 0x39, 0x8e, 0x69, 0xbf, 0x40, 0x10, 0xcb, 0xe9,
+    0xcf, 0x5b, 0x9b, 0xe3, 0x55, 0xd9, 0xb3, 0x9e, 0x75, 0xde, 0x81, 0x74, 0x53, 0x83, 0x38, 0xec,
+    0xff, 0x03, 0x7e, 0x29, 0x6f, 0x6b, 0xf9, 0xe8, 0x9e, 0xbd, 0x78, 0x2a, 0x73, 0x34, 0x20, 0x7d,
+    0xca, 0x5b, 0x32, 0x6f, 0xd7, 0x25, 0xc6, 0x3a, 0xde, 0x5b, 0x0b, 0x74, 0xc2, 0x76, 0x2c, 0x97,
+    0x75, 0x0c, 0xeb, 0xe1, 0x78, 0x25, 0x60, 0x94, 0x6e, 0x38, 0x5e, 0xa1, 0x1a, 0xcb, 0x70, 0xee,
+    0x73, 0x0e, 0x87, 0xe1, 0x63, 0x91, 0x14, 0xdf, 0x70, 0x0b, 0xca, 0x10, 0xa2, 0x74, 0xba, 0x69,
+    0x35, 0xba, 0x3d, 0xfd, 0xf8, 0x10, 0x52, 0xb2, 0x7e, 0xfe, 0xce, 0x04, 0xc7, 0xef, 0xd1, 0x8d,
+    0xc5, 0x4c, 0xd4, 0x30, 0xff, 0x5c, 0xfc, 0xff, 0xed, 0xfc, 0xb1, 0x58, 0xe5, 0x45, 0x5e, 0xe7,
+    0xe6, 0xd1, 0x3b, 0xfd, 0x36, 0xa8, 0xfc, 0xed, 0xeb, 0xb1, 0x22, 0x7e, 0xbf, 0xa3, 0x65, 0x18,
+    0xce, 0xf9, 0x56, 0x6d, 0x9b, 0x57, 0x79, 0x20, 0x91, 0x86, 0xde, 0x61, 0x74, 0x10, 0x6f, 0xa6,
+    0xca, 0xa3, 0x81, 0xa5, 0x5a, 0x7f, 0x03, 0xdf, 0xff, 0xfd, 0xed, 0x7c, 0xfd, 0xaa, 0x23, 0xc9,
+    0xf6, 0xf3, 0xef, 0xd1, 0xc8, 0x40, 0x45, 0xf4, 0xf1, 0x31, 0x53, 0x61, 0x1b, 0xae, 0xc5, 0xf2,
+    0x77, 0xab, 0x8f, 0x5c, 0x88, 0x3f, 0xb3, 0x55, 0x27, 0x6e, 0x24, 0x5f, 0xb2, 0x95, 0x31, 0x5b,
+    0x40, 0x5d, 0xfc, 0x99, 0xad, 0x8a, 0x98, 0x04, 0x6a, 0xa2, 0x8f, 0xcb, 0x0a, 0x26, 0x88, 0x2b,
+    0x98, 0x20, 0x5b, 0x71, 0x62, 0x5f, 0xf2, 0x25, 0x5b, 0x79, 0xc1, 0xc4, 0xf4, 0x63, 0x16, 0x30,
+    0xc5, 0x54, 0x00, 0x97, 0x7a, 0xba, 0x60, 0xc8, 0x05, 0xa3, 0x01, 0xec, 0x65, 0xd1, 0x65, 0x83,
+    0xc3, 0x0c, 0x24, 0x5f, 0xb2, 0x95, 0xc1, 0xd4, 0x89, 0x44, 0xee, 0xf3, 0xf9, 0x5e, 0xf1, 0x43,
+    0x79, 0x53, 0xe7, 0xce, 0xa5, 0xc9, 0xe5, 0x92, 0x22, 0xef, 0x44, 0x17, 0x54, 0x3e, 0x9c, 0xe7,
+    0x4e, 0x16, 0x72, 0x0f, 0x87, 0x4e, 0x3c, 0x31, 0xf7, 0xf9, 0xf3, 0xe7, 0x9c, 0xab, 0x73, 0xbc,
+    0x20, 0xeb, 0x3c, 0x97, 0xb9, 0x5f, 0x37, 0x19, 0x1f, 0x18, 0x37, 0x6f, 0x3d, 0x3c, 0x5e, 0xde,
+    0x79, 0x69, 0xf1, 0x8e, 0x6b, 0xe9, 0xb9, 0x13, 0x9e, 0x67, 0xdd, 0xe0, 0xf8, 0x23, 0xd8, 0xb9,
+    0xe7, 0x68, 0xee, 0x53, 0x5d, 0x67, 0x5a, 0x9d, 0xe5, 0x22, 0x81, 0xb7, 0x8f, 0xf0, 0xd1, 0x9f,
+    0x4b, 0x51, 0x7b, 0x5d, 0xa2, 0x2c, 0x5e, 0xb0, 0x78, 0x5b, 0x6a, 0xc4, 0xbd, 0xa5, 0x71, 0x32,
+    0xa6, 0x09, 0x06, 0x40, 0x1b, 0x0f, 0x09, 0xb7, 0x0d, 0xeb, 0x8c, 0x97, 0xc3, 0x9e, 0x93, 0xc2,
+    0x73, 0xdd, 0x73, 0x02, 0xfe, 0x00, 0x28, 0xfe, 0xfc, 0x25, 0xc1, 0x0c, 0x86, 0x76, 0x03, 0x61,
+    0xdc, 0x91, 0xce, 0xfb, 0xaf, 0x53, 0xfa, 0x6c, 0xba, 0xb6, 0x74, 0x02, 0xfb, 0x98, 0x62, 0xff,
+    0x2f, 0xe9, 0x6b, 0x3c, 0x0c, 0x21, 0x3b, 0xad, 0x7f, 0x03, 0x33, 0x72, 0xbc, 0xd9, 0x23, 0xf7,
+    0xcf, 0x7f, 0xde, 0x81, 0x8d, 0xa6, 0x3a, 0x0d, 0x79, 0x00, 0x7b, 0x3c, 0x81, 0x27, 0xbc, 0x7e,
+    0x1f, 0x9b, 0xd8, 0xc8, 0xf0, 0x36, 0xb2, 0x73, 0x75, 0x83, 0xef, 0xbf, 0x7d, 0xfd, 0x11, 0x39,
+    0x7c, 0xab, 0x73, 0x30, 0xef, 0xcb, 0xbe, 0xac, 0xc9, 0x8e, 0xfd, 0x60, 0x47, 0xf8, 0x86, 0x82,
+    0x00, 0x8a, 0x3e, 0xe4, 0x00, 0x9f, 0x93, 0xaf, 0x97, 0x34, 0x9d, 0xba, 0x4d, 0x81, 0xdf, 0x24,
+    0xe0, 0x84, 0xe1, 0x7d, 0x84, 0x64, 0x2a, 0x4e, 0x7d, 0xaa, 0x40, 0x2c, 0x0f, 0x73, 0x18, 0x99,
+    0x9e, 0x0b, 0xae, 0x7c, 0xbc, 0x52, 0xaa, 0x84, 0xba, 0xb4, 0x26, 0x45, 0x18, 0x4e, 0x34, 0xa7,
+    0x81, 0xce, 0xf7, 0xd3, 0xc6, 0xcd, 0x6f, 0xc8, 0xc2, 0xe7, 0xd4, 0x0c, 0xa7, 0x51, 0xe6, 0xce,
+    0x08, 0x01, 0x6d, 0x39, 0x40, 0x32, 0xff, 0x10, 0xfd, 0x01, 0x6a, 0xe8, 0x03, 0xda, 0x9f, 0x32,
+    0x58, 0x1e, 0xcf, 0xfd, 0x7c, 0x3b, 0x7d, 0x3b, 0x0f, 0xe9, 0xf0, 0xed, 0x59, 0x90, 0x55, 0x60,
+    0xb7, 0x1e, 0x1e, 0xb8, 0x58, 0xfa, 0xb9, 0x67, 0x50, 0xc8, 0xe7, 0xbe, 0x7c, 0xce, 0x5d, 0x20,
+    0xf9, 0x76, 0x3d, 0x62, 0xc0, 0xed, 0xab, 0xf1, 0x26, 0x33, 0x70, 0x06, 0x78, 0x6d, 0xac, 0x31,
+    0xec, 0xfd, 0x91, 0x26, 0xa8, 0x5e, 0x1d, 0x67, 0x44, 0xc1, 0x1f, 0x18, 0xe5, 0xa7, 0xcf, 0xb9,
+    0x0c, 0x8a, 0x6f, 0xb7, 0x96, 0xb9, 0x03, 0x86, 0x8f, 0xdf, 0x67, 0x46, 0xb3, 0x6a, 0x78, 0x44,
+    0x1c, 0xfb, 0x09, 0x39, 0xc7, 0x62, 0x74, 0x5b, 0x8e, 0xd6, 0x80, 0x86, 0x6b, 0x31, 0xd1, 0x67,
+    0x5a, 0x6b, 0x12, 0x98, 0xdf, 0xc2, 0x86, 0xa1, 0x31, 0xc0, 0x03, 0x38, 0x2c, 0x42, 0x4d, 0xe0,
+    0x74, 0x83, 0x05, 0xe1, 0xeb, 0x89, 0xb9, 0xa6, 0xc5, 0x9b, 0x8c, 0xc5, 0x3f, 0x9c, 0x69, 0x7d,
+    0xbc, 0xd4, 0xd2, 0xc8, 0xc3, 0x7a, 0xe6, 0x62, 0x34, 0x0f, 0xc0, 0xec, 0xf1, 0x81, 0x03, 0x3c,
+    0xde, 0x54, 0x83, 0x0f, 0xb9, 0x0c, 0x3b, 0x1e, 0x2f, 0x10, 0x84, 0x19, 0x04, 0x07, 0x7a, 0x1e,
+    0x9f, 0x75, 0x99, 0xe5, 0x1f, 0x2e, 0x40, 0x01, 0x2b, 0x4e, 0x23, 0x3f, 0x9a, 0xd7, 0xfc, 0x73,
+    0xf0, 0xc4, 0x04, 0xb2, 0x9d, 0x3f, 0xdb, 0xa6, 0xe7, 0xf3, 0xc8, 0x1f, 0x52, 0xa5, 0xdc, 0x81,
+    0x0b, 0x0f, 0xd7, 0x8c, 0x49, 0x41, 0xf1, 0x8c, 0xcd, 0xc7, 0xc3, 0x00, 0x9f, 0xcd, 0xc0, 0x4c,
+    0xd5, 0x00, 0x32, 0xd5, 0xa3, 0x4c, 0x56, 0x41, 0x8f, 0x0f, 0x69, 0x06, 0x3c, 0xbe, 0x8b, 0xd4,
+    0xf0, 0xbf, 0x9f, 0xd4, 0x30, 0x45, 0x6a, 0x78, 0x41, 0x6a, 0x22, 0x03, 0x26, 0xe3, 0x48, 0x2d,
+    0xfd, 0x3c, 0xe3, 0xf1, 0xe3, 0xd5, 0x68, 0x0e, 0x83, 0x00, 0xa1, 0x05, 0x18, 0x47, 0x04, 0x93,
+    0x7f, 0x04, 0x1d, 0xb3, 0xd2, 0x83, 0xe0, 0xea, 0xb1, 0xa3, 0x91, 0x7b, 0x48, 0x0b, 0xe6, 0x79,
+    0xfd, 0x8b, 0x30, 0x3c, 0xa6, 0x14, 0xee, 0xf6, 0x90, 0x5f, 0x1f, 0x74, 0x0e, 0xca, 0xa1, 0x19,
+    0xd8, 0xf4, 0xd0, 0xfb, 0x40, 0x29, 0x18, 0x2b, 0x53, 0xcd, 0x38, 0x8e, 0xf5, 0x90, 0x37, 0x4c,
+    0x86, 0x95, 0x9d, 0x30, 0xff, 0x21, 0x7a, 0xd1, 0x37, 0x53, 0x0f, 0x3a, 0xc9, 0x03, 0x69, 0x07,
+    0x35, 0xb7, 0xa9, 0x7f, 0x7d, 0x04, 0xa9, 0x2e, 0x22, 0x14, 0x09, 0xc3, 0x7e, 0x8b, 0x39, 0x15,
+    0xc9, 0x3b, 0x58, 0x11, 0x9e, 0x05, 0xfd, 0xeb, 0x69, 0x69, 0xbe, 0x6a, 0x7a, 0x87, 0x01, 0xdf,
+    0xcb, 0x84, 0xd7, 0x65, 0xe0, 0x0e, 0x27, 0x10, 0xc0, 0x89, 0x8f, 0x29, 0xa0, 0x6f, 0x67, 0xab,
+    0xf4, 0xb6, 0x04, 0x27, 0x93, 0x9f, 0x58, 0x8a, 0xa7, 0xf8, 0xf5, 0xf6, 0xb4, 0xcc, 0x46, 0x0b,
+    0x5b, 0xc6, 0x8a, 0xa4, 0xc5, 0x1c, 0x00, 0x9f, 0xad, 0x62, 0xf4, 0x94, 0x59, 0x1b, 0x4f, 0x8e,
+    0xe0, 0x69, 0x0e, 0x12, 0xd1, 0x4c, 0xee, 0x46, 0x8f, 0xa2, 0x83, 0x5c, 0x72, 0xb7, 0x7a, 0xf1,
+    0x43, 0xee, 0xf0, 0x23, 0x15, 0xf0, 0x87, 0xdc, 0xe9, 0x27, 0x90, 0x2a, 0x1f, 0x72, 0xc9, 0xcf,
+    0x5a, 0xe0, 0x70, 0xee, 0x5b, 0x56, 0xb8, 0x13, 0x82, 0x5a, 0x86, 0xee, 0x4c, 0xe5, 0x7d, 0xe4,
+    0xdd, 0x23, 0x48, 0x16, 0x20, 0xf1, 0xcf, 0xab, 0x76, 0x64, 0xf7, 0x23, 0xe7, 0x0f, 0x8b, 0xef,
+    0x6a, 0x6f, 0xc5, 0xa5, 0x0f, 0xf9, 0x7f, 0x3c, 0x69, 0xd0, 0x3f, 0x9e, 0xb8, 0xfc, 0xe3, 0xed,
+    0x46, 0x51, 0x98, 0x76, 0xab, 0x51, 0xe7, 0xe5, 0x1f, 0xd4, 0xcb, 0x3f, 0xa6, 0xf7, 0x9a, 0x45,
+    0x7d, 0xdd, 0x69, 0xba, 0x7a, 0xfa, 0x87, 0xf6, 0xf4, 0x0f, 0x2e, 0xf7, 0x8f, 0x3b, 0x28, 0x02,
+    0x1a, 0x84, 0xb6, 0x09, 0x74, 0x12, 0x14, 0x24, 0x4c, 0x3d, 0xeb, 0xdd, 0x33, 0x70, 0x8c, 0x3b,
+    0xc0, 0x81, 0xb0, 0x23, 0x37, 0x13, 0x2c, 0x1b, 0x30, 0x70, 0xf2, 0x92, 0x52, 0x10, 0xbc, 0xb8,
+    0x0e, 0x7f, 0x2a, 0x4f, 0x09, 0xc1, 0xaf, 0x19, 0xca, 0x00, 0xc6, 0x54, 0xdd, 0x4b, 0x66, 0xb0,
+    0x0f, 0xdc, 0x05, 0x3d, 0xe1, 0x05, 0x3d, 0xb7, 0xfd, 0xc9, 0x63, 0x34, 0x14, 0xad, 0xc2, 0x47,
+    0x8d, 0xcb, 0x67, 0x08, 0x48, 0xc3, 0x3d, 0xe4, 0x2f, 0xac, 0x64, 0x44, 0x05, 0x60, 0xd4, 0xa1,
+    0x36, 0x0d, 0x7a, 0x49, 0x4d, 0x1c, 0x44, 0xfd, 0xe9, 0xe4, 0xc4, 0x57, 0xd8, 0xfd, 0x08, 0x3d,
+    0x9b, 0xe8, 0xa2, 0x7e, 0xe6, 0x10, 0x6b, 0xa5, 0x5d, 0x98, 0x48, 0x58, 0x13, 0xe1, 0x7e, 0x8e,
+    0x1e, 0x3e, 0x9c, 0x17, 0xf4, 0x44, 0xba, 0xd3, 0x91, 0xec, 0xd3, 0x11, 0x32, 0xae, 0x3b, 0x83,
+    0xc6, 0x1a, 0x71, 0xa8, 0x02, 0xdf, 0x3f, 0xa4, 0x7e, 0x8b, 0x22, 0xd1, 0x8b, 0x4c, 0xcc, 0x7b,
+    0xc2, 0x92, 0xd4, 0x1e, 0xa1, 0x2f, 0xd4, 0x25, 0x62, 0xfc, 0x34, 0x4a, 0x05, 0xc6, 0xa2, 0x25,
+    0xc6, 0xfa, 0x7a, 0xa6, 0x3b, 0xb3, 0x08, 0xc4, 0xa7, 0xc6, 0x6f, 0x58, 0x5d, 0xdb, 0xb1, 0x0c,
+    0x85, 0x07, 0xa6, 0x06, 0x40, 0x80, 0x8e, 0x45, 0x8b, 0x0f, 0xef, 0x83, 0x3d, 0xa5, 0x6d, 0x74,
+    0xf9, 0x16, 0x98, 0xc4, 0x98, 0xfc, 0x53, 0x62, 0x1e, 0x64, 0x5d, 0x8c, 0xd0, 0x8a, 0xbc, 0xa1,
+    0xf1, 0xc0, 0xc0, 0xb0, 0x23, 0x8b, 0x67, 0x65, 0x3b, 0x9a, 0xbb, 0xc7, 0xac, 0xff, 0x77, 0x8c,
+    0x17, 0x9f, 0xe3, 0x64, 0x4a, 0x5f, 0xb6, 0x9d, 0xf8, 0xa7, 0x26, 0x80, 0x5f, 0x61, 0x3f, 0xe4,
+    0x8f, 0x6b, 0x70, 0xd6, 0xde, 0x8b, 0xe7, 0x45, 0x3a, 0xf1, 0x44, 0xc0, 0xf2, 0x76, 0x6b, 0x15,
+    0x49, 0xb9, 0x81, 0x39, 0x5e, 0xb5, 0xf9, 0x77, 0x22, 0x39, 0x33, 0x25, 0xe1, 0xc7, 0xb5, 0x37,
+    0xf9, 0xed, 0xcf, 0x73, 0xcc, 0x8e, 0xc6, 0x26, 0x4a, 0x14, 0x4c, 0x0c, 0xdf, 0x4e, 0xa9, 0x41,
+    0x06, 0x19, 0x10, 0x3d, 0x5d, 0x8c, 0x52, 0x25, 0x47, 0x33, 0x71, 0x9d, 0x74, 0xf8, 0x5b, 0xda,
+    0xf1, 0xcc, 0x68, 0x08, 0x92, 0xd1, 0x86, 0x5b, 0x78, 0xb3, 0xe4, 0xc4, 0x6e, 0x2c, 0xd0, 0x9a,
+    0x94, 0x93, 0x62, 0xf1, 0x91, 0xb5, 0xc9, 0x83, 0x9a, 0xf4, 0x3a, 0x92, 0x30, 0x2c, 0x16, 0x7d,
+    0xc0, 0xaf, 0x94, 0x22, 0x5c, 0xc1, 0x24, 0x92, 0x7d, 0x02, 0x3a, 0x08, 0x7a, 0x21, 0x3d, 0xf2,
+    0xff, 0xca, 0x3d, 0x5c, 0xac, 0x00, 0x85, 0x1c, 0x76, 0xe9, 0x00, 0x25, 0x1e, 0xdc, 0x05, 0x75,
+    0x71, 0xe2, 0x30, 0x36, 0x79, 0xe9, 0x35, 0xee, 0x3b, 0xbc, 0xdc, 0x73, 0x2b, 0x2b, 0xfa, 0x11,
+    0xb9, 0x87, 0xdf, 0xce, 0xc6, 0x20, 0xd1, 0xf9, 0x94, 0x75, 0x48, 0x54, 0xfb, 0xeb, 0x25, 0x5d,
+    0x91, 0xeb, 0x16, 0xe9, 0x61, 0x4c, 0xcb, 0x85, 0x2e, 0x1e, 0x92, 0x1d, 0x89, 0x8e, 0xa6, 0x65,
+    0xf0, 0x97, 0x1b, 0xeb, 0x7f, 0xac, 0x07, 0x91, 0xf4, 0x5d, 0xf9, 0xca, 0x29, 0xa0, 0xd8, 0xe3,
+    0x88, 0xcc, 0x18, 0x00, 0xfc, 0x57, 0xfc, 0xa0, 0x46, 0xf3, 0x03, 0x16, 0xda, 0xff, 0xf8, 0x77,
+    0x8a, 0xd4, 0xc4, 0x7e, 0x7c, 0x7b, 0xfc, 0xd7, 0x05, 0x92, 0xd8, 0xe7, 0xbc, 0x70, 0x3f, 0x52,
+    0x0c, 0x3d, 0x77, 0x06, 0x08, 0xa8, 0xc5, 0x38, 0x0e, 0xe3, 0xba, 0x06, 0x71, 0xc0, 0x9a, 0x62,
+    0x3f, 0x94, 0xee, 0xd4, 0x8c, 0x92, 0x5f, 0x5b, 0x79, 0xa8, 0xdc, 0xa9, 0x8f, 0xa6, 0x99, 0xd4,
+    0x75, 0xe0, 0x4e, 0xa4, 0xa8, 0x06, 0x06, 0x12, 0x98, 0xc0, 0xab, 0x61, 0xbc, 0x82, 0x62, 0xe8,
+    0x46, 0x91, 0x1c, 0x7c, 0x07, 0xe2, 0xb0, 0x60, 0x67, 0x97, 0xe3, 0x2c, 0xec, 0x2d, 0xfe, 0x9c,
+    0xed, 0xeb, 0xd9, 0xef, 0xba, 0x58, 0xc2, 0xee, 0x0a, 0x63, 0xe2, 0xe7, 0xde, 0x10, 0xc7, 0x63,
+    0xcc, 0xf4, 0x9a, 0xc4, 0x1d, 0xac, 0x7e, 0x2e, 0xcb, 0x92, 0xaf, 0xa9, 0x36, 0xd9, 0x80, 0xeb,
+    0x40, 0xcc, 0x9f, 0x2f, 0x81, 0xe1, 0xf7, 0x4b, 0x60, 0x46, 0xfc, 0x22, 0xd5, 0xf9, 0x06, 0x6c,
+    0xf1, 0x1f, 0x92, 0xbf, 0x3e, 0x40, 0xf2, 0x86, 0xf4, 0xe1, 0x7f, 0xa6, 0xf4, 0x45, 0x44, 0x67,
+    0xc5, 0x2f, 0x56, 0xf8, 0x3f, 0x2a, 0x7d, 0xe1, 0x9f, 0x28, 0x7d, 0x51, 0x88, 0x77, 0x48, 0x50,
+    0xe6, 0x81, 0x3d, 0x4e, 0x1a, 0x24, 0xc1, 0xe3, 0x65, 0xd8, 0x78, 0x13, 0x34, 0x09, 0x89, 0x2f,
+    0x83, 0xe1, 0x68, 0x35, 0xfe, 0x9b, 0x2f, 0xeb, 0x9c, 0xe1, 0x3f, 0x4b, 0x8c, 0x3d, 0xf4, 0xf5,
+    0x91, 0x65, 0x98, 0xbc, 0xe5, 0x84, 0x0f, 0xf9, 0x8b, 0x3d, 0x8e, 0x3a, 0x60, 0x4e, 0xb4, 0x51,
+    0x96, 0x59, 0x98, 0x0f, 0x4d, 0x6f, 0x83, 0xa6, 0xd3, 0x19, 0xd9, 0xd4, 0x07, 0xab, 0xca, 0x26,
+    0x19, 0xa5, 0x75, 0xfe, 0x15, 0xef, 0x01, 0xc5, 0x2d, 0xd9, 0xa8, 0xe5, 0x53, 0x54, 0xf3, 0xf4,
+    0x1f, 0xff, 0x2e, 0x14, 0x5e, 0xc5, 0xfc, 0xed, 0x5f, 0xa9, 0xb1, 0xa6, 0x96, 0x9d, 0xc3, 0xa0,
+    0xc1, 0x7a, 0x98, 0x09, 0xe2, 0x8f, 0xe5, 0x11, 0xf2, 0x51, 0x1c, 0x1a, 0x5f, 0x2e, 0x55, 0x72,
+    0x14, 0x28, 0x26, 0x54, 0xdd, 0x68, 0x07, 0xfc, 0x18, 0xe7, 0xba, 0x4d, 0x90, 0xcf, 0xa8, 0x6b,
+    0x24, 0x43, 0x57, 0x30, 0x61, 0xfe, 0x52, 0xa5, 0x81, 0x98, 0x21, 0x77, 0x57, 0xd3, 0x4b, 0x01,
+    0xcc, 0xca, 0xe4, 0xcd, 0x1e, 0x4e, 0x8b, 0xec, 0x95, 0x31, 0xc9, 0x36, 0x8e, 0xba, 0x2e, 0x80,
+    0x00, 0xf5, 0x63, 0x2a, 0xb1, 0x19, 0x45, 0xc6, 0x75, 0xdd, 0xb9, 0x4e, 0x3b, 0x9d, 0x52, 0x0e,
+    0xff, 0xbe, 0xb0, 0x7e, 0x8e, 0x61, 0xa8, 0x8e, 0x6c, 0x52, 0xb1, 0x7f, 0x67, 0x67, 0x92, 0xc2,
+    0xc0, 0x2e, 0xe4, 0x1e, 0x0e, 0xce, 0x91, 0xfc, 0x21, 0x07, 0x5c, 0xa1, 0x93, 0x3f, 0x9f, 0x4c,
+    0xf0, 0x33, 0x9f, 0xb8, 0x1f, 0x0f, 0x19, 0x09, 0x3a, 0x18, 0xb2, 0x51, 0xe2, 0x2e, 0x71, 0x29,
+    0x5f, 0x08, 0x4c, 0xee, 0x95, 0x4c, 0xea, 0xbc, 0xc8, 0x44, 0x7b, 0xa8, 0xab, 0xfc, 0x63, 0xe4,
+    0x10, 0xd9, 0xcf, 0xa7, 0x82, 0x8c, 0x3a, 0xfd, 0x7a, 0x5c, 0xec, 0x13, 0xd5, 0x78, 0x78, 0xe2,
+    0x7e, 0xb3, 0x9f, 0x13, 0xa7, 0xf4, 0x6b, 0x56, 0xf1, 0x5e, 0x2e, 0x20, 0xd3, 0x80, 0x59, 0xa7,
+    0xf5, 0x9a, 0x98, 0xc8, 0xc3, 0xae, 0x47, 0x3f, 0xf2, 0x75, 0xe9, 0xac, 0x1e, 0xf8, 0x5a, 0x28,
+    0xa4, 0x23, 0xf9, 0x43, 0xbc, 0x0b, 0xda, 0x64, 0x17, 0x8f, 0x78, 0x2e, 0xa3, 0xe2, 0x8b, 0x64,
+    0xc3, 0xf3, 0xc1, 0xab, 0x3b, 0x85, 0xe5, 0x67, 0xca, 0x62, 0xb7, 0x4f, 0x77, 0x55, 0xf5, 0xa2,
+    0x45, 0x70, 0x84, 0x0d, 0x0e, 0x83, 0xb9, 0x74, 0x75, 0x62, 0xa8, 0xf0, 0xe1, 0xc4, 0xed, 0x4c,
+    0xaa, 0x21, 0xad, 0x4a, 0x19, 0xf1, 0x37, 0xb3, 0x2a, 0x73, 0xcc, 0x26, 0xb8, 0x5a, 0xda, 0xb9,
+    0xbd, 0xb5, 0x5e, 0x44, 0x15, 0x4f, 0x82, 0x1e, 0xad, 0x16, 0x11, 0x0e, 0xa0, 0xd7, 0x07, 0xce,
+    0x7c, 0xfb, 0xd7, 0xe3, 0xab, 0x8b, 0xd0, 0xad, 0x1e, 0x8f, 0x20, 0xc0, 0x3e, 0xc4, 0xd5, 0x00,
+    0xa9, 0x6b, 0xa9, 0x0f, 0x7f, 0xff, 0x8f, 0x7f, 0x27, 0x7a, 0x7b, 0xed, 0xf1, 0x5c, 0xb8, 0xf6,
+    0xf6, 0xf3, 0x69, 0xc2, 0x6e, 0x02, 0x0a, 0xb2, 0xaa, 0x46, 0x9d, 0xc7, 0x47, 0x2b, 0x5e, 0x41,
+    0xf5, 0x74, 0xd4, 0x56, 0xe4, 0x19, 0xbe, 0x09, 0x96, 0xcd, 0xe6, 0xfc, 0x72, 0x27, 0x2d, 0x15,
+    0x11, 0x73, 0x51, 0x19, 0x1f, 0xf2, 0x78, 0xc8, 0x3f, 0xf9, 0xfc, 0x46, 0x91, 0x0f, 0xb6, 0xf0,
+    0xee, 0x58, 0x3f, 0x5e, 0x08, 0x5c, 0x4b, 0xff, 0xed, 0x8a, 0xcb, 0x51, 0x38, 0x92, 0xfe, 0x01,
+    0xdb, 0x74, 0x72, 0xfc, 0xb6, 0x4c, 0x47, 0x4c, 0xb8, 0x29, 0xd3, 0x91, 0xbd, 0x88, 0xce, 0xca,
+    0x67, 0xd1, 0x25, 0xe5, 0x07, 0x49, 0xfd, 0xf8, 0x96, 0x0a, 0xdc, 0xef, 0x92, 0x36, 0x12, 0x93,
+    0x72, 0x54, 0xeb, 0x74, 0xd9, 0x65, 0xe2, 0xef, 0x48, 0x45, 0xc6, 0x54, 0xfc, 0x21, 0x73, 0x71,
+    0xd7, 0x64, 0xa4, 0xc9, 0xf8, 0x7a, 0xbd, 0xd6, 0xdf, 0x32, 0x1e, 0xd9, 0x26, 0x1f, 0xb3, 0x29,
+    0xcb, 0x84, 0x4f, 0xd7, 0x59, 0xa1, 0x43, 0xf5, 0x0d, 0x0d, 0x8f, 0xb3, 0x43, 0xa9, 0xf2, 0x2f,
+    0x9f, 0x73, 0x57, 0xbd, 0x64, 0xf2, 0x85, 0x49, 0xd4, 0xfb, 0x1a, 0xa7, 0xd7, 0xbc, 0x65, 0x64,
+    0xf9, 0x1c, 0x95, 0xdc, 0xe7, 0xf2, 0xc5, 0x20, 0xe1, 0x37, 0x06, 0xf5, 0xde, 0x61, 0xc0, 0x37,
+    0xc8, 0xfe, 0x3f, 0x31, 0xd1, 0xd9, 0xfd, 0x8d, 0xc7, 0xdf, 0x90, 0x77, 0x4c, 0xf4, 0x65, 0x1b,
+    0xf8, 0xeb, 0x8f, 0x30, 0x25, 0xc3, 0x80, 0xab, 0x95, 0xe2, 0xb7, 0x10, 0x44, 0x76, 0x21, 0xf2,
+    0xf5, 0x62, 0xf4, 0x7f, 0x60, 0xec, 0xbf, 0x02, 0x9c, 0x47, 0xcb, 0xff, 0xe1, 0xc4, 0xdd, 0xaf,
+    0xbf, 0x5c, 0x8e, 0xf5, 0xb7, 0x63, 0xd5, 0x87, 0xf3, 0xba, 0xfc, 0xf5, 0x7a, 0x29, 0x03, 0xc5,
+    0xcc, 0x8d, 0xa5, 0x2c, 0x2a, 0xbe, 0xb7, 0x94, 0x1d, 0x77, 0xc8, 0x7e, 0x68, 0xd9, 0x82, 0x1f,
+    0xc2, 0x4b, 0x6b, 0x1a, 0x22, 0x0f, 0x21, 0xf2, 0xff, 0xd4, 0x22, 0xf6, 0xca, 0xea, 0x74, 0x58,
+    0xbf, 0x12, 0xa5, 0xbe, 0xbf, 0xcc, 0xbd, 0x6f, 0x75, 0x8a, 0x66, 0xf1, 0xbf, 0x63, 0x75, 0x8a,
+    0xfa, 0x79, 0xff, 0xea, 0x74, 0x70, 0x3f, 0x8f, 0x82, 0x7e, 0x78, 0xcc, 0x9a, 0xae, 0xac, 0x8b,
+    0x9a, 0x9c, 0xc2, 0xf8, 0x77, 0x2e, 0xd1, 0xbd, 0x97, 0xdc, 0x51, 0x0b, 0xc1, 0xfa, 0xcb, 0x6c,
+    0x78, 0x35, 0x2a, 0x88, 0xbf, 0xa4, 0xb6, 0x57, 0x52, 0x39, 0xbf, 0x9b, 0x87, 0x36, 0x6e, 0x1f,
+    0xe9, 0xc9, 0x64, 0xe2, 0x72, 0xff, 0xeb, 0x7f, 0xfd, 0x72, 0x87, 0x9e, 0x43, 0x4e, 0xef, 0xcb,
+    0x29, 0xc1, 0x7f, 0xed, 0x0c, 0x47, 0xb9, 0xd0, 0xe8, 0xc7, 0xd0, 0xe3, 0xdd, 0x87, 0x54, 0x16,
+    0xee, 0x45, 0x4c, 0x27, 0x26, 0xe3, 0x05, 0xd9, 0x02, 0xa3, 0xbb, 0xd8, 0x5b, 0x7f, 0x07, 0x79,
+    0x59, 0x86, 0xc5, 0x48, 0x6e, 0x28, 0x72, 0x5c, 0xbe, 0xbc, 0x54, 0xe5, 0x43, 0x62, 0xed, 0xb7,
+    0x0b, 0xab, 0xf1, 0x6a, 0xf6, 0x2c, 0xca, 0x64, 0x7c, 0x78, 0xa5, 0x41, 0x92, 0x38, 0xbf, 0x8e,
+    0x60, 0x2e, 0x1a, 0x5d, 0x18, 0xe6, 0x78, 0x97, 0x30, 0x3e, 0x04, 0x92, 0x4b, 0xf6, 0x0a, 0xc1,
+    0x34, 0x83, 0x27, 0x31, 0x3a, 0x3d, 0x12, 0x6d, 0x27, 0x7c, 0x38, 0x1f, 0xb2, 0x02, 0xb3, 0x9b,
+    0xcd, 0x8d, 0x9c, 0x03, 0xe5, 0xf4, 0xce, 0x59, 0xfc, 0x2b, 0xcf, 0x87, 0x43, 0x9a, 0x8f, 0x47,
+    0x79, 0x3f, 0x1c, 0xb9, 0x3d, 0xeb, 0xde, 0xc7, 0xcb, 0x97, 0x0d, 0x0f, 0x27, 0x1a, 0x92, 0xfd,
+    0x8a, 0x88, 0x94, 0x58, 0x3a, 0x4f, 0x7d, 0x9f, 0x9c, 0xf5, 0xab, 0xfe, 0xef, 0x09, 0xd3, 0xc3,
+    0x8d, 0x5b, 0x98, 0x23, 0xc8, 0x0f, 0x37, 0xca, 0x9f, 0x9f, 0x9f, 0x4f, 0xcd, 0x9f, 0x35, 0xc6,
+    0x3c, 0x84, 0xf8, 0x60, 0x2c, 0xd1, 0xbd, 0xd4, 0xd7, 0x4b, 0xd9, 0x15, 0xf9, 0x69, 0x36, 0x00,
+    0x1e, 0xc4, 0xb3, 0x7e, 0x4c, 0x1a, 0x24, 0xec, 0x7c, 0xd6, 0x0c, 0x0f, 0x70, 0x33, 0x1e, 0xc3,
+    0x65, 0xeb, 0x6f, 0x99, 0xe7, 0x6f, 0x8f, 0x17, 0xcb, 0x44, 0x24, 0xc7, 0x97, 0x76, 0xf1, 0xd0,
+    0xc3, 0x2d, 0xc8, 0xb8, 0xd3, 0xb8, 0xfe, 0xd2, 0xa8, 0x1f, 0x91, 0xc4, 0xbf, 0xc8, 0x1d, 0x61,
+    0x61, 0x2d, 0xc3, 0xb6, 0x25, 0x46, 0xb6, 0xf2, 0xaf, 0xe7, 0xfc, 0x0f, 0xa8, 0x6f, 0x2f, 0x0a,
+    0x17, 0x81, 0xfd, 0x7b, 0x83, 0xfb, 0x57, 0x03, 0xfc, 0x9b, 0x60, 0x3f, 0x12, 0xe0, 0xff, 0x58,
+    0x90, 0xff, 0x83, 0xa1, 0xcd, 0xe1, 0x27, 0xce, 0x9f, 0x78, 0x0f, 0x68, 0x77, 0x3c, 0x4d, 0x60,
+    0x2a, 0xf2, 0x8f, 0xf7, 0x4c, 0xf3, 0x5d, 0xa3, 0xf6, 0x78, 0xc9, 0xfc, 0x73, 0xd2, 0xa0, 0x73,
+    0x38, 0xdc, 0x99, 0xe9, 0x1e, 0x85, 0x73, 0x85, 0x3b, 0x26, 0xf2, 0xf6, 0xde, 0xc0, 0xc7, 0x7b,
+    0xe8, 0x6f, 0x58, 0xb0, 0x0b, 0xdb, 0xf9, 0xea, 0x6a, 0x9d, 0xd1, 0xfd, 0x9b, 0x3c, 0x3c, 0xff,
+    0xca, 0x79, 0x04, 0x7f, 0xfa, 0x55, 0xf3, 0x57, 0xa0, 0xa3, 0x5f, 0xdc, 0xca, 0x7f, 0xc8, 0x5d,
+    0x8d, 0x22, 0x6f, 0x06, 0xaf, 0xb4, 0xf2, 0x8f, 0x93, 0x0d, 0xa6, 0xcb, 0xd2, 0x18, 0xf5, 0xd5,
+    0xd5, 0x3e, 0x1f, 0xff, 0x46, 0x7c, 0xfe, 0x87, 0x9d, 0x86, 0xf4, 0xee, 0x59, 0xe5, 0xf6, 0x82,
+    0xff, 0xaa, 0x01, 0x3c, 0x30, 0xff, 0x47, 0xd4, 0x0b, 0xbe, 0xab, 0x50, 0xf0, 0xab, 0x3a, 0x84,
+    0x14, 0xe1, 0xd7, 0x95, 0x24, 0x23, 0x6f, 0xaf, 0x32, 0xcf, 0x97, 0x64, 0x87, 0x7f, 0x8b, 0x79,
+    0x6f, 0x72, 0x38, 0xb3, 0x49, 0x8a, 0xdf, 0x06, 0xbc, 0xde, 0x26, 0x65, 0x2d, 0xc0, 0xd7, 0x26,
+    0x27, 0xf2, 0xf6, 0x77, 0x70, 0xf4, 0xe2, 0x50, 0xc7, 0x2d, 0x41, 0x3e, 0xb4, 0x7f, 0x0a, 0x9e,
+    0xae, 0xb7, 0xc5, 0x33, 0xfc, 0x2f, 0xdf, 0x9f, 0x00, 0x04, 0xbd, 0x9d, 0xff, 0x8f, 0x7f, 0x2f,
+    0x40, 0x67, 0xa5, 0xc4, 0x04, 0x6b, 0x32, 0x07, 0x56, 0xab, 0x2c, 0xf5, 0x91, 0x57, 0x62, 0xc4,
+    0xa7, 0x2e, 0x81, 0x3e, 0xa2, 0x78, 0xba, 0x2a, 0x95, 0x20, 0xf4, 0xe2, 0xdc, 0x60, 0x46, 0xeb,
+    0x2f, 0x57, 0xc7, 0x5b, 0x6c, 0x78, 0x9d, 0x11, 0x99, 0xc1, 0x21, 0xf0, 0x9d, 0xca, 0x68, 0x78,
+    0x09, 0x81, 0x77, 0x00, 0x2e, 0x06, 0x19, 0x3b, 0x18, 0xd7, 0x3d, 0xc5, 0x07, 0x66, 0xbc, 0xc4,
+    0x77, 0xbc, 0x58, 0x14, 0xff, 0x00, 0xe5, 0x57, 0x93, 0x18, 0xde, 0x9c, 0xc4, 0xec, 0x48, 0xb1,
+    0x3f, 0x6b, 0xa8, 0x91, 0xeb, 0x72, 0x31, 0x96, 0xc3, 0x54, 0x16, 0x3e, 0x5f, 0x1b, 0x31, 0xec,
+    0xf5, 0xf0, 0x55, 0x30, 0x58, 0x37, 0x3e, 0xc1, 0x7e, 0x2f, 0x20, 0xbb, 0x3a, 0x9f, 0xf0, 0x03,
+    0x36, 0x39, 0x40, 0xee, 0x5a, 0x8b, 0x00, 0xbd, 0x6f, 0x62, 0x90, 0xf7, 0x2d, 0xda, 0x21, 0x7a,
+    0x6b, 0xc5, 0x7d, 0xc3, 0x5a, 0x80, 0x58, 0xf9, 0x6d, 0x4b, 0x8b, 0xff, 0x80, 0xa5, 0x3d, 0x9c,
+    0x58, 0x91, 0x6d, 0x60, 0x54, 0x93, 0xd0, 0x20, 0xf9, 0x6e, 0x5c, 0x1c, 0x67, 0x7d, 0x8c, 0xdd,
+    0x88, 0xeb, 0x96, 0x02, 0x88, 0xcd, 0xea, 0x86, 0x61, 0x71, 0xb2, 0x0e, 0xa0, 0xe2, 0xdc, 0x7d,
+    0x36, 0xdb, 0x72, 0xed, 0x9a, 0x20, 0x38, 0xfe, 0xe1, 0x1e, 0xcc, 0xc9, 0xfd, 0xc8, 0xae, 0xee,
+    0xa0, 0x11, 0x9c, 0x6e, 0x73, 0x23, 0x6f, 0xa0, 0x19, 0xae, 0xcd, 0x53, 0xc0, 0xa5, 0x8c, 0xd3,
+    0x23, 0xff, 0x3e, 0xc8, 0xd8, 0xf2, 0x25, 0x17, 0x1c, 0xc5, 0x75, 0xf5, 0x92, 0x0b, 0x6f, 0xba,
+    0xec, 0x99, 0x40, 0xec, 0x70, 0x3e, 0x38, 0xf7, 0xe9, 0xd2, 0x85, 0x4a, 0x47, 0x5f, 0x47, 0xa0,
+    0x2f, 0xd7, 0xe3, 0xbb, 0x82, 0x0a, 0xb3, 0xa8, 0xa2, 0x1d, 0x93, 0x1b, 0x30, 0x5f, 0xae, 0xb9,
+    0x90, 0xdd, 0xd8, 0xbb, 0x72, 0xf3, 0xb3, 0x87, 0x80, 0x6f, 0xf9, 0xcd, 0xd1, 0xb8, 0x62, 0x85,
+    0xb9, 0x94, 0x84, 0xc7, 0xe4, 0x94, 0xff, 0x46, 0x35, 0xa2, 0x25, 0xe8, 0x0a, 0xf3, 0xcd, 0x36,
+    0x1f, 0x4e, 0xf0, 0x6f, 0x75, 0x79, 0x98, 0xba, 0xef, 0xec, 0xf4, 0x4e, 0xab, 0xf7, 0x75, 0x9b,
+    0x88, 0x00, 0x97, 0x1c, 0xe6, 0xcb, 0x84, 0x2a, 0x0f, 0xc1, 0x45, 0xc3, 0x04, 0x54, 0x06, 0x4b,
+    0x66, 0xf4, 0x0a, 0x4f, 0x22, 0xec, 0x99, 0x03, 0x1d, 0x11, 0x16, 0x60, 0xff, 0x6e, 0x36, 0xb3,
+    0x0c, 0xff, 0x2a, 0x6d, 0x18, 0xf7, 0xfa, 0x94, 0x3a, 0xd6, 0xfd, 0x5b, 0x82, 0x1c, 0xc8, 0xec,
+    0xd7, 0xc3, 0x79, 0xf7, 0x5f, 0x6e, 0x85, 0x67, 0x67, 0xd0, 0x03, 0xd8, 0x53, 0x8c, 0xea, 0x46,
+    0x66, 0xf1, 0x0a, 0xfe, 0x46, 0x26, 0xf1, 0x66, 0xf7, 0xb7, 0x86, 0x10, 0x4f, 0xee, 0xf2, 0xc4,
+    0xa6, 0x07, 0x30, 0xa4, 0x44, 0xc1, 0x6f, 0x01, 0x1f, 0x26, 0x65, 0x79, 0x35, 0xe8, 0x03, 0x96,
+    0x4f, 0x97, 0xfa, 0xff, 0x1b, 0xfc, 0x35, 0x3e, 0x57, 0x18, 0xd7, 0x16, 0x80, 0xaa, 0xc7, 0x27,
+    0x09, 0xe3, 0xa7, 0x58, 0xf1, 0x5f, 0xe9, 0x64, 0x75, 0xd5, 0x49, 0x78, 0x03, 0x3f, 0x12, 0xe1,
+    0x0f, 0x23, 0xd4, 0x70, 0x2e, 0xd2, 0xe7, 0x5b, 0x96, 0x22, 0xdb, 0x49, 0x22, 0xcd, 0x6f, 0x1c,
+    0x35, 0x48, 0x68, 0x3c, 0x9c, 0x30, 0xb8, 0xb9, 0xf0, 0x26, 0x18, 0x2e, 0x28, 0x4c, 0x23, 0xbc,
+    0xa8, 0xca, 0xa0, 0x3f, 0xf2, 0xf1, 0x5b, 0x74, 0xaa, 0xe6, 0x38, 0xde, 0x6f, 0x8f, 0xff, 0xfa,
+    0xe5, 0x95, 0x18, 0xfa, 0xce, 0x82, 0x7f, 0x0a, 0xa9, 0x5f, 0xf7, 0xc8, 0x8e, 0xce, 0xc4, 0xe5,
+    0xe1, 0xd3, 0xf3, 0x7c, 0x7f, 0x4f, 0x77, 0x49, 0x22, 0xe3, 0x4d, 0xf7, 0x21, 0x3e, 0x0c, 0x7c,
+    0xe1, 0x80, 0xdd, 0xa4, 0xea, 0xe6, 0x46, 0x45, 0x2e, 0x52, 0xaf, 0xdf, 0xb8, 0xab, 0x84, 0xf6,
+    0x8d, 0xf4, 0xc4, 0xaf, 0x97, 0x67, 0x3e, 0x1f, 0x32, 0x4d, 0x1f, 0x6f, 0x34, 0x79, 0x01, 0xab,
+    0x1f, 0xc4, 0x5c, 0xbe, 0x00, 0x9d, 0x3d, 0x15, 0x7d, 0xb9, 0xab, 0x94, 0xe4, 0xb0, 0x5e, 0x49,
+    0x72, 0x1d, 0xd2, 0x5c, 0x71, 0xce, 0x28, 0x49, 0x40, 0xc4, 0xf9, 0xa2, 0xe4, 0x55, 0x9e, 0x66,
+    0x14, 0xf4, 0xde, 0xc9, 0x11, 0xdd, 0x58, 0x72, 0x72, 0x99, 0x66, 0xd9, 0xc4, 0x5f, 0xea, 0x8d,
+    0xad, 0x1b, 0xc0, 0xcf, 0xe7, 0x3c, 0x51, 0xbc, 0x0a, 0x46, 0x89, 0x95, 0xab, 0x81, 0xde, 0x48,
+    0x13, 0x9d, 0x97, 0xcc, 0x87, 0x14, 0xb6, 0xef, 0x4a, 0xc6, 0x7c, 0x7b, 0x2b, 0x27, 0x12, 0x71,
+    0xc6, 0x31, 0x5c, 0x56, 0x02, 0xde, 0x59, 0xd2, 0xa1, 0xca, 0x33, 0x5e, 0xe4, 0xd3, 0x3c, 0xfc,
+    0x65, 0xc9, 0xb3, 0x6f, 0x8f, 0x77, 0x68, 0x88, 0x18, 0x93, 0x3b, 0xb3, 0xe8, 0x43, 0x8a, 0x03,
+    0xd7, 0x99, 0xa1, 0xc3, 0x6b, 0x7b, 0x89, 0x13, 0x74, 0x4c, 0x25, 0x25, 0x27, 0x4c, 0xdf, 0x00,
+    0x3e, 0x5a, 0x8c, 0x2b, 0xe0, 0x1b, 0x89, 0xa4, 0xef, 0xe8, 0xea, 0x56, 0xfe, 0x38, 0x75, 0xe8,
+    0xf1, 0x22, 0x4d, 0x92, 0x3e, 0x0e, 0x7a, 0xe5, 0x30, 0xa7, 0x0f, 0xf2, 0xfc, 0xf2, 0x5d, 0x47,
+    0x02, 0xd3, 0x87, 0x2e, 0x2f, 0xb6, 0x15, 0xbe, 0x27, 0xa3, 0xf1, 0x23, 0xf9, 0x8c, 0xd7, 0xb3,
+    0x19, 0xd9, 0x14, 0xf6, 0x29, 0x58, 0xbc, 0x95, 0xec, 0x89, 0x5e, 0xa9, 0xb8, 0x95, 0xde, 0xbe,
+    0x7b, 0x04, 0x36, 0xab, 0x3c, 0x09, 0x4f, 0xbf, 0x37, 0x92, 0x0e, 0x6e, 0xe7, 0xe9, 0xf0, 0xbb,
+    0xd1, 0xf2, 0xad, 0x18, 0xeb, 0x95, 0x08, 0xeb, 0xe6, 0x96, 0x8b, 0xa1, 0x81, 0x65, 0x13, 0xb0,
+    0xeb, 0xb8, 0xf5, 0x96, 0x8e, 0xaf, 0x6f, 0xc6, 0x0a, 0x71, 0xea, 0xe2, 0x29, 0x99, 0xaf, 0x68,
+    0xb3, 0xc9, 0xba, 0x02, 0x8c, 0xed, 0xf7, 0x15, 0xbf, 0x6e, 0xa6, 0xf4, 0x2e, 0x43, 0xf3, 0xec,
+    0x6b, 0x22, 0xef, 0xe6, 0xe9, 0xfd, 0x7c, 0xcf, 0x29, 0x77, 0x83, 0xbe, 0x9e, 0xba, 0x29, 0xde,
+    0x9d, 0x91, 0xd4, 0x69, 0xfc, 0x48, 0x2a, 0x80, 0x78, 0x14, 0xdf, 0x98, 0x10, 0x30, 0x67, 0xb7,
+    0x7b, 0xb3, 0x22, 0x7c, 0x77, 0xaa, 0xc2, 0xbb, 0x55, 0x87, 0x9c, 0x91, 0xf7, 0xcc, 0xc6, 0x5b,
+    0x6b, 0x1f, 0xff, 0xb0, 0x9c, 0x9d, 0xc2, 0xdc, 0xdb, 0x2f, 0xec, 0xbc, 0x39, 0x7e, 0x14, 0xfe,
+    0x11, 0x89, 0xfc, 0xcb, 0x24, 0xcd, 0x4b, 0xbf, 0x36, 0xf4, 0x3d, 0xd9, 0x83, 0x6f, 0x77, 0x5f,
+    0x2d, 0x4d, 0xde, 0xf8, 0xbf, 0xab, 0xe0, 0x77, 0x2c, 0xe5, 0x15, 0x1f, 0x53, 0x5c, 0x4c, 0xbf,
+    0xb7, 0x71, 0xf9, 0xce, 0xda, 0x99, 0x7d, 0xe7, 0x97, 0x36, 0xee, 0x00, 0x5d, 0x58, 0x4e, 0x1b,
+    0x18, 0xde, 0xa7, 0xe8, 0x90, 0x9b, 0xf0, 0x96, 0xe9, 0xcc, 0x23, 0xe8, 0xbb, 0x6c, 0xe5, 0xc6,
+    0x50, 0xb9, 0x9b, 0x06, 0xff, 0x76, 0x06, 0xee, 0x97, 0xdb, 0x6a, 0x1f, 0xf3, 0xef, 0xce, 0x6b,
+    0xad, 0xa7, 0x43, 0xf5, 0xc9, 0x97, 0x5b, 0xef, 0x7c, 0x46, 0x17, 0x27, 0xdc, 0xa8, 0x3c, 0x1e,
+    0x7b, 0x8f, 0x3f, 0x2f, 0xda, 0x1d, 0xaa, 0xc2, 0xeb, 0xaa, 0xd3, 0x91, 0xc2, 0x3b, 0xef, 0x2f,
+    0x26, 0x2b, 0x5f, 0xe6, 0xa5, 0xb3, 0xe3, 0x2b, 0x14, 0xd9, 0xf7, 0xec, 0x0f, 0x07, 0x06, 0x93,
+    0x33, 0xd5, 0x99, 0x2c, 0x46, 0xea, 0x2e, 0x88, 0xac, 0x53, 0xf6, 0x6b, 0xba, 0xea, 0x25, 0x47,
+    0xea, 0xa0, 0x58, 0x76, 0xc2, 0x0f, 0x57, 0x2d, 0x99, 0xe0, 0x6e, 0x4b, 0x50, 0xf5, 0x92, 0x7b,
+    0xba, 0x6c, 0xfa, 0xf5, 0xff, 0xee, 0xf7, 0x9b, 0x84, 0xf4, 0x8b, 0x68, 0x5e, 0xc6, 0x93, 0xf7,
+    0x32, 0x67, 0x73, 0xbc, 0x57, 0xde, 0x24, 0xb9, 0x74, 0xe0, 0xbd, 0xc7, 0x67, 0x93, 0x01, 0x8b,
+    0x03, 0xf7, 0x40, 0x00, 0x11, 0xcc, 0x5d, 0xd0, 0x15, 0xf9, 0xee, 0x87, 0x90, 0xeb, 0xd6, 0x9b,
+    0x7e, 0xe7, 0x9b, 0x49, 0x7e, 0x49, 0xed, 0x60, 0x46, 0x6f, 0x77, 0x4f, 0x79, 0x27, 0xed, 0x68,
+    0x5f, 0xdf, 0xc4, 0x71, 0x7a, 0x79, 0xdb, 0xbb, 0x0a, 0x49, 0x7e, 0xcb, 0x83, 0x99, 0x8d, 0x14,
+    0x02, 0x4c, 0x53, 0xf4, 0x51, 0xf5, 0xe2, 0x14, 0x7b, 0x9f, 0xb1, 0x9d, 0xfc, 0x57, 0xe0, 0x99,
+    0xb2, 0xaa, 0xcb, 0xf1, 0x36, 0x68, 0xf8, 0xcb, 0xad, 0x03, 0xd8, 0x8f, 0x77, 0x66, 0x33, 0xb3,
+    0x0a, 0xde, 0x3b, 0xeb, 0x6a, 0x5f, 0x1e, 0x73, 0xbd, 0x76, 0xed, 0x18, 0x51, 0xb4, 0x33, 0x67,
+    0x69, 0xef, 0x1e, 0x28, 0x8d, 0x3b, 0x3c, 0x9e, 0x6e, 0x48, 0x9e, 0xb2, 0xab, 0x6f, 0xd4, 0x2e,
+    0xc3, 0x93, 0xd3, 0xd8, 0x62, 0x0e, 0x3c, 0x5e, 0x06, 0x0f, 0x51, 0xd7, 0xcf, 0x5a, 0xac, 0x27,
+    0x40, 0x60, 0xb4, 0xe8, 0xdd, 0x98, 0xcc, 0xbb, 0x30, 0x37, 0x4f, 0xbb, 0x66, 0x83, 0x85, 0xd7,
+    0xba, 0x04, 0xdc, 0xbe, 0xd3, 0x65, 0x7c, 0xed, 0x4a, 0xd4, 0x25, 0x13, 0xfc, 0xa9, 0x5d, 0x46,
+    0x33, 0x7b, 0xbb, 0x4b, 0xe6, 0xf0, 0x02, 0x13, 0xc0, 0xce, 0xfc, 0xb9, 0xc3, 0x8c, 0xc5, 0xe8,
+    0xaa, 0xd3, 0xa8, 0x41, 0x7c, 0xa7, 0x40, 0xfa, 0x2d, 0xad, 0xeb, 0xe0, 0x2d, 0xa6, 0x0d, 0xac,
+    0xf4, 0xf1, 0x65, 0x0d, 0x17, 0x87, 0xbe, 0xee, 0x9c, 0x7b, 0xcb, 0x36, 0x8a, 0x33, 0x45, 0xe9,
+    0x8e, 0xa2, 0x7c, 0xd1, 0x79, 0x40, 0xf7, 0x93, 0x6d, 0xdf, 0x32, 0xdb, 0x32, 0xe9, 0xf7, 0xbf,
+    0x92, 0x33, 0x31, 0x17, 0x09, 0x1e, 0xe0, 0xd4, 0xbc, 0xa4, 0xcf, 0xc8, 0xe6, 0x7e, 0xfd, 0x35,
+    0x7d, 0x96, 0x28, 0x7a, 0x3c, 0xec, 0x97, 0x65, 0x13, 0x28, 0xd1, 0x7a, 0xf3, 0x72, 0x75, 0x40,
+    0x2f, 0xde, 0x18, 0x39, 0xda, 0x09, 0x04, 0x4f, 0x0c, 0x45, 0xae, 0x70, 0x01, 0x97, 0x66, 0xf8,
+    0xf5, 0x9b, 0x14, 0xd1, 0x69, 0x86, 0x44, 0xd9, 0x73, 0xff, 0xfa, 0x8f, 0x7f, 0x7b, 0xdf, 0x5e,
+    0x72, 0x51, 0xfa, 0xe7, 0x68, 0x86, 0x22, 0x1e, 0xfd, 0x06, 0x9c, 0x0e, 0xa3, 0x6f, 0xf8, 0xbc,
+    0x55, 0x8f, 0xde, 0xb3, 0x7e, 0xfc, 0xfa, 0x78, 0x79, 0x28, 0x2b, 0x46, 0xb4, 0x35, 0x80, 0xe0,
+    0xe7, 0xf3, 0x8f, 0x1f, 0x7e, 0xb9, 0x1d, 0x1d, 0x7f, 0xbb, 0x11, 0x62, 0x24, 0x57, 0x0a, 0xdd,
+    0x8f, 0x2d, 0x6e, 0x6b, 0xf0, 0xfd, 0xb3, 0x78, 0x97, 0x92, 0x71, 0x58, 0xc0, 0xa2, 0x34, 0xdc,
+    0xe7, 0x64, 0xbe, 0x2f, 0x71, 0x69, 0x4c, 0x70, 0x95, 0xb8, 0xf9, 0x35, 0x47, 0x81, 0xe5, 0x33,
+    0x56, 0xe4, 0x33, 0x82, 0x0f, 0xb9, 0xa7, 0xa3, 0xd2, 0x3d, 0x5e, 0x1d, 0xe6, 0xbb, 0x0d, 0xff,
+    0x96, 0x66, 0x3e, 0xbe, 0x79, 0x38, 0xf3, 0x1d, 0xf4, 0x47, 0x06, 0xe9, 0x7d, 0xf4, 0x1f, 0xcd,
+    0xd4, 0x2b, 0xe4, 0xdf, 0x48, 0x14, 0xa5, 0x30, 0xdc, 0xa8, 0x7d, 0xcb, 0xde, 0xbd, 0x7e, 0x32,
+    0xe6, 0xdb, 0x1b, 0xc2, 0x11, 0xd9, 0xb7, 0xbf, 0x5e, 0x38, 0x90, 0x1f, 0x62, 0x2e, 0x98, 0xd8,
+    0x33, 0x82, 0x93, 0x70, 0xdc, 0xe7, 0xee, 0x25, 0xfc, 0x5b, 0x9c, 0x7b, 0xbf, 0x70, 0x20, 0x3f,
+    0x24, 0xdc, 0x17, 0xf4, 0xbc, 0x25, 0xdb, 0x00, 0xfc, 0x15, 0xe1, 0x40, 0xee, 0x0a, 0xc7, 0x6b,
+    0xf2, 0xff, 0xbd, 0xc2, 0x91, 0x8e, 0x5d, 0xd2, 0x9a, 0x01, 0x44, 0xe4, 0x4c, 0x48, 0x7a, 0x96,
+    0x2f, 0x64, 0xe9, 0x95, 0x24, 0xc6, 0x19, 0xdd, 0xd3, 0xd3, 0xab, 0x09, 0xaa, 0x73, 0x47, 0xe9,
+    0x53, 0xf7, 0xdf, 0x6e, 0x5f, 0xdd, 0x75, 0xef, 0xfd, 0xe5, 0xb3, 0x03, 0x1e, 0xfd, 0x7f, 0xba,
+    0x7d, 0xe3, 0xea, 0x84, 0x5a, 0x74, 0x52, 0x8b, 0xb7, 0x3e, 0x24, 0x97, 0x30, 0xc5, 0xb7, 0x35,
+    0x1d, 0xa9, 0x4e, 0x6a, 0x9e, 0x2f, 0xef, 0x75, 0x4a, 0x60, 0x12, 0xf4, 0xe7, 0x8b, 0xff, 0x9e,
+    0x92, 0xdd, 0x9b, 0xa8, 0xaf, 0xc3, 0xd9, 0x47, 0xe9, 0x7c, 0xaf, 0xd1, 0xc5, 0xbb, 0x5f, 0x87,
+    0x15, 0x2b, 0xbe, 0xbf, 0xff, 0x74, 0x35, 0x5d, 0x1c, 0xca, 0xbd, 0xe4, 0x4a, 0xc7, 0x1b, 0xf5,
+    0x92, 0x4c, 0xc2, 0x4b, 0x0e, 0x3b, 0x16, 0x44, 0x76, 0x3c, 0xba, 0x8d, 0xe2, 0x97, 0x83, 0xdf,
+    0x06, 0x56, 0x0f, 0xe0, 0xa4, 0x3e, 0xa3, 0xc2, 0x61, 0x19, 0x4b, 0x2f, 0x41, 0x2f, 0xaf, 0x3b,
+    0x92, 0x1f, 0x0e, 0x17, 0x56, 0x65, 0x59, 0xf1, 0x72, 0xe7, 0x1e, 0xbd, 0xc4, 0x1b, 0x7c, 0x39,
+    0x39, 0xba, 0xe7, 0xa9, 0x3a, 0x9e, 0x45, 0xcd, 0x1b, 0xae, 0xf3, 0xbb, 0x97, 0x5a, 0x4e, 0x0f,
+    0x47, 0x52, 0xf3, 0x73, 0x43, 0x75, 0x18, 0x91, 0xcf, 0x3d, 0xcc, 0x1f, 0xd3, 0xb5, 0xc7, 0x95,
+    0x19, 0x40, 0xfc, 0x1d, 0x11, 0xca, 0xe5, 0x4d, 0x31, 0x5d, 0x1b, 0x8f, 0xe3, 0x25, 0xe7, 0x58,
+    0x2e, 0xff, 0xe1, 0xf2, 0xf0, 0x69, 0xb6, 0xf8, 0xdb, 0x87, 0xd7, 0x49, 0x62, 0x6f, 0x90, 0x54,
+    0x77, 0x2d, 0x2b, 0xca, 0x76, 0x3f, 0x54, 0xef, 0x92, 0x24, 0x08, 0x65, 0x01, 0xe6, 0xff, 0x10,
+    0x49, 0x31, 0x8b, 0x93, 0x95, 0x39, 0x16, 0x84, 0xe7, 0xd3, 0x0d, 0x6e, 0xf9, 0xbf, 0x27, 0xb7,
+    0x76, 0xc6, 0x75, 0x80, 0xe1, 0xc2, 0xf3, 0x51, 0x52, 0xe2, 0xcf, 0x8f, 0xbf, 0x7c, 0x82, 0x92,
+    0x1b, 0x1f, 0x4f, 0x57, 0x3f, 0x7e, 0xc9, 0xca, 0xaf, 0xf3, 0xfb, 0xe9, 0x76, 0xb9, 0xe8, 0x56,
+    0x19, 0x55, 0xfd, 0x3d, 0x49, 0x3b, 0x0a, 0x0c, 0xd0, 0xa3, 0xa3, 0xec, 0x1e, 0x7d, 0xba, 0x24,
+    0x34, 0xcb, 0x5f, 0x5e, 0x5d, 0x77, 0x71, 0x6f, 0xd9, 0xef, 0x40, 0xb0, 0x1d, 0xd7, 0x7e, 0xe8,
+    0x4e, 0x87, 0x03, 0xe0, 0xea, 0x58, 0xf6, 0x21, 0x54, 0x3d, 0xe3, 0x3f, 0x09, 0x77, 0x86, 0x90,
+    0x43, 0x33, 0x63, 0xb3, 0xbd, 0x4f, 0x49, 0x3c, 0xc4, 0x58, 0x3e, 0x80, 0x23, 0xaa, 0xf3, 0x56,
+    0x87, 0xa6, 0xfa, 0x00, 0x06, 0xb4, 0x39, 0x94, 0x3a, 0x46, 0x4b, 0x0e, 0x78, 0xee, 0x01, 0x8d,
+    0xa3, 0xb1, 0xf8, 0x92, 0xae, 0x87, 0xd2, 0xd1, 0xcd, 0x02, 0x1f, 0xf3, 0x43, 0xf8, 0x75, 0x42,
+    0x24, 0xdf, 0x44, 0xc4, 0xbe, 0x89, 0xa8, 0x7a, 0x40, 0x14, 0x27, 0xb1, 0x8f, 0xe3, 0x3a, 0x31,
+    0x26, 0x46, 0x1f, 0x0d, 0xca, 0x7b, 0x8e, 0xa3, 0xd4, 0x03, 0xea, 0xa4, 0xe4, 0x8c, 0xfa, 0xe3,
+    0x25, 0x38, 0x7b, 0x05, 0xce, 0x5e, 0x81, 0x27, 0x8c, 0xe6, 0x0c, 0xd6, 0xd5, 0x80, 0xe8, 0x1d,
+    0x30, 0x44, 0x37, 0xa5, 0x34, 0x55, 0x3e, 0x2a, 0xa9, 0x85, 0x24, 0xf7, 0x90, 0x8f, 0xbb, 0x3a,
+    0xad, 0x25, 0x11, 0xaa, 0xaa, 0x03, 0x84, 0x79, 0xe3, 0x46, 0x27, 0xff, 0xb4, 0x58, 0x8d, 0xa3,
+    0x2e, 0xc0, 0xb7, 0x0c, 0x45, 0x87, 0x3e, 0xde, 0x83, 0x9d, 0x7d, 0x1f, 0x76, 0xf6, 0x1a, 0x7b,
+    0xc4, 0xb3, 0x23, 0xa7, 0x0d, 0x3d, 0x75, 0xfb, 0xe0, 0xa1, 0xd7, 0xab, 0xee, 0x1c, 0x43, 0x14,
+    0xa3, 0x84, 0x4e, 0xea, 0x66, 0x0c, 0x86, 0x03, 0xe5, 0xb2, 0xfd, 0xfb, 0xf9, 0x1a, 0x8d, 0x0b,
+    0xdb, 0xff, 0x3d, 0xc8, 0xac, 0x78, 0x3f, 0xe5, 0x12, 0x5f, 0x86, 0x56, 0xd6, 0xd3, 0x0c, 0x8e,
+    0x7f, 0x07, 0xad, 0xac, 0x77, 0xdc, 0xe7, 0x79, 0xf6, 0x64, 0x5b, 0xde, 0xc8, 0xaa, 0xec, 0x84,
+    0xd1, 0x85, 0xa4, 0xf1, 0x13, 0xe8, 0xf8, 0xe3, 0x9b, 0x18, 0xd8, 0x3b, 0x18, 0x24, 0x99, 0xe3,
+    0x78, 0x3d, 0xff, 0x7d, 0xc3, 0xbd, 0x4b, 0x4f, 0x06, 0xdb, 0x8f, 0x90, 0x93, 0x1d, 0x50, 0x96,
+    0x5d, 0x20, 0xfa, 0xf9, 0x1d, 0x88, 0x48, 0x6c, 0x31, 0xb2, 0xa7, 0xbc, 0x63, 0x59, 0x3f, 0x54,
+    0x67, 0x74, 0x2f, 0x9f, 0xcb, 0x3d, 0x3d, 0x3d, 0x3f, 0xdd, 0x1e, 0xde, 0xdd, 0x56, 0xa9, 0xce,
+    0x4e, 0x82, 0x86, 0x5c, 0xeb, 0x6c, 0xd6, 0x46, 0x01, 0x5c, 0xb2, 0x7e, 0x1b, 0xd7, 0xb1, 0xfc,
+    0x4d, 0x5c, 0x31, 0x96, 0xe8, 0x47, 0xe4, 0x6f, 0xd8, 0xa2, 0x43, 0xf1, 0x2b, 0x36, 0x24, 0x85,
+    0x83, 0x91, 0xae, 0xda, 0x83, 0xa2, 0x63, 0x5b, 0x2c, 0xd5, 0xb6, 0x72, 0xd5, 0xd6, 0xbf, 0x6e,
+    0xeb, 0xbf, 0xa3, 0x6d, 0xb4, 0xc3, 0x24, 0x6b, 0x51, 0x62, 0x20, 0xaf, 0x1b, 0x11, 0xb1, 0xf9,
+    0xac, 0x62, 0x9a, 0x96, 0x71, 0xc8, 0xc3, 0x0d, 0xe7, 0xa3, 0x94, 0xbd, 0x3f, 0xb4, 0x89, 0x7e,
+    0x43, 0x28, 0x33, 0x4b, 0x37, 0xda, 0xd5, 0x6f, 0xb5, 0x63, 0xef, 0xb4, 0x8b, 0xf9, 0x95, 0xd5,
+    0xaf, 0x43, 0x93, 0x14, 0x71, 0x59, 0xbb, 0x77, 0x25, 0xa6, 0x31, 0xe4, 0x51, 0x50, 0x0f, 0x1b,
+    0xac, 0xc9, 0x00, 0xf5, 0xa3, 0x88, 0xde, 0x6d, 0x7b, 0x60, 0xc2, 0x0f, 0xb6, 0x8e, 0xd8, 0xf1,
+    0xa3, 0x4d, 0xd9, 0x1f, 0x6d, 0x0a, 0xf8, 0x73, 0xa3, 0xe1, 0xe1, 0x57, 0x71, 0xcf, 0xb3, 0x79,
+    0xf6, 0x09, 0x2e, 0x34, 0x30, 0xed, 0x48, 0xc4, 0x97, 0x7b, 0xa6, 0x2e, 0xc1, 0x63, 0x1c, 0xfe,
+    0xe5, 0x7c, 0xb5, 0x64, 0x2a, 0x3f, 0x10, 0xaf, 0xb1, 0x2f, 0xe7, 0xe5, 0x36, 0x5b, 0xc3, 0x9e,
+    0x6b, 0xd8, 0x0f, 0x17, 0xd7, 0xb3, 0x1d, 0x5d, 0xe7, 0x48, 0xf2, 0xa2, 0xab, 0x20, 0x7e, 0xe7,
+    0x8c, 0xf8, 0x25, 0xca, 0xc8, 0xdb, 0xf9, 0x98, 0xf6, 0x04, 0xa2, 0xca, 0x87, 0xd7, 0x1c, 0x91,
+    0xbf, 0x9d, 0x9a, 0x67, 0x93, 0xdf, 0x06, 0xe0, 0x84, 0xcf, 0x58, 0x7a, 0x74, 0x43, 0x03, 0xab,
+    0xe4, 0x18, 0xd5, 0xe2, 0x19, 0x2e, 0xcc, 0xc9, 0x7a, 0x0e, 0x48, 0xa5, 0x68, 0xf1, 0xb6, 0x0d,
+    0xdc, 0x72, 0x45, 0x36, 0x4d, 0x59, 0x17, 0xe3, 0xcc, 0x64, 0xdc, 0xd5, 0x73, 0x8e, 0x96, 0xf8,
+    0xdc, 0x68, 0x3a, 0xcb, 0x45, 0x05, 0x86, 0x91, 0xb3, 0x55, 0xc3, 0x7f, 0x3e, 0xef, 0xc6, 0x5e,
+    0x7b, 0x38, 0x69, 0xea, 0x63, 0xe2, 0x0e, 0xce, 0xbb, 0x15, 0x9e, 0xc8, 0x11, 0x78, 0x87, 0x95,
+    0x1e, 0xf2, 0x50, 0xe2, 0xd1, 0x64, 0xee, 0x4d, 0x94, 0x78, 0xfd, 0xe1, 0x01, 0x10, 0x63, 0x02,
+    0x8a, 0xf9, 0xab, 0x03, 0x04, 0xf1, 0xf8, 0x8e, 0xb5, 0xcf, 0x86, 0x72, 0x19, 0x00, 0x1f, 0xa2,
+    0x94, 0x7c, 0xfe, 0x5e, 0xba, 0xee, 0x00, 0x70, 0x42, 0x11, 0xef, 0x7a, 0xa4, 0x53, 0x3a, 0x57,
+    0xb4, 0x24, 0xbb, 0x08, 0x37, 0xe8, 0x88, 0x1d, 0xbe, 0xbf, 0x5d, 0x38, 0x7c, 0x47, 0x01, 0xba,
+    0xe9, 0x36, 0xbe, 0x1d, 0x00, 0x67, 0xe7, 0x69, 0x60, 0xc4, 0x51, 0x0b, 0xa0, 0x96, 0xe5, 0xe5,
+    0xe8, 0xdc, 0x63, 0x7c, 0xeb, 0xf8, 0x89, 0x6b, 0xf7, 0xc6, 0x78, 0x4b, 0x7c, 0x2e, 0x84, 0x0d,
+    0x44, 0x5b, 0x60, 0x06, 0x72, 0x0f, 0x37, 0x44, 0x84, 0xb7, 0x2c, 0xc3, 0x7a, 0xc8, 0x37, 0xa3,
+    0x8f, 0x64, 0xa2, 0x22, 0x79, 0x48, 0xfa, 0x7c, 0x01, 0x6e, 0xcb, 0x79, 0x63, 0xe8, 0x76, 0x3f,
+    0x37, 0x62, 0x40, 0xc7, 0x3b, 0xdd, 0x00, 0x78, 0xdc, 0x2c, 0xfe, 0x7c, 0xe5, 0x01, 0x3e, 0x03,
+    0xf7, 0x48, 0x7b, 0x48, 0x39, 0x40, 0xde, 0x95, 0x37, 0x0d, 0x22, 0x3f, 0x60, 0xa8, 0xf3, 0x23,
+    0x35, 0xba, 0x15, 0x31, 0x17, 0xdf, 0xbf, 0x9f, 0x63, 0x72, 0x5e, 0x12, 0xf5, 0xbc, 0x26, 0x92,
+    0x27, 0x1b, 0x11, 0xfd, 0x84, 0xc1, 0xc1, 0x28, 0x24, 0xaf, 0x04, 0x45, 0x36, 0xc1, 0x67, 0x64,
+    0xe7, 0x2d, 0x3b, 0x14, 0x0d, 0xe2, 0x64, 0x88, 0x6e, 0x36, 0xbd, 0x29, 0xdf, 0xb1, 0x8f, 0xf9,
+    0x21, 0x17, 0xbf, 0x47, 0x28, 0x19, 0x20, 0xa6, 0xc9, 0x8f, 0x86, 0x53, 0x3a, 0x3e, 0x28, 0xc0,
+    0x85, 0x2f, 0x80, 0x0f, 0xdf, 0x1e, 0x5f, 0x17, 0xf9, 0xd7, 0x29, 0x07, 0x81, 0x3f, 0xe3, 0xaa,
+    0x4e, 0x4a, 0xda, 0xbf, 0x77, 0x00, 0x87, 0xf7, 0x77, 0xf2, 0xd9, 0x2d, 0x86, 0xfb, 0x2a, 0xe6,
+    0x48, 0xd1, 0x09, 0xc9, 0xc8, 0xf4, 0x35, 0x0f, 0x72, 0x32, 0x99, 0x80, 0x51, 0x01, 0x8f, 0xff,
+    0xd4, 0x24, 0x11, 0x15, 0x3a, 0xbb, 0xa9, 0xfb, 0xed, 0x97, 0x1f, 0x94, 0x40, 0x40, 0xb7, 0x13,
+    0x09, 0xe0, 0x61, 0x96, 0xb3, 0x12, 0x78, 0x10, 0x88, 0xdb, 0x90, 0x31, 0x55, 0xfc, 0xb3, 0x06,
+    0x0c, 0x1b, 0x78, 0x7c, 0xbc, 0x72, 0xe3, 0xde, 0xc5, 0xd1, 0x3f, 0xc6, 0xcf, 0x5b, 0xba, 0x20,
+    0xbf, 0xa6, 0x0b, 0xec, 0x1f, 0xd4, 0x05, 0x36, 0x09, 0xb7, 0xff, 0x72, 0x5d, 0x90, 0x7f, 0x4c,
+    0x17, 0xe4, 0xff, 0x6b, 0x74, 0x41, 0xfe, 0x9f, 0xac, 0x0b, 0x87, 0x59, 0x7e, 0x87, 0x2e, 0x1c,
+    0x21, 0xff, 0x72, 0x5d, 0x90, 0xbf, 0x5f, 0x17, 0x92, 0x30, 0xf3, 0xa4, 0x0d, 0x7f, 0x5c, 0x2e,
+    0x4f, 0x71, 0xeb, 0x77, 0x4a, 0x66, 0xd2, 0xee, 0x77, 0xe0, 0x96, 0x7d, 0x87, 0x27, 0xf2, 0xbd,
+    0xc2, 0xf8, 0x23, 0x74, 0x5f, 0x0b, 0xe4, 0xdb, 0x1e, 0xd0, 0x8f, 0x0a, 0xe5, 0x5f, 0xe2, 0x26,
+    0x5d, 0xfa, 0x41, 0xb1, 0xab, 0xfa, 0x07, 0xdc, 0x11, 0xf9, 0x28, 0x35, 0xaf, 0x88, 0xfe, 0x19,
+    0xe6, 0xaf, 0x15, 0xfa, 0x77, 0xce, 0xda, 0xb5, 0xd8, 0x9f, 0x92, 0xd8, 0x4e, 0x76, 0x21, 0x48,
+    0x7e, 0xc0, 0x26, 0xda, 0xf1, 0x3f, 0xf5, 0xb9, 0x73, 0x79, 0x2b, 0x9c, 0x1e, 0x7e, 0x68, 0xe2,
+    0x70, 0x44, 0xfb, 0xd8, 0xfc, 0x00, 0x7f, 0x34, 0xf5, 0x87, 0xd6, 0xd1, 0xe1, 0x8e, 0x66, 0x74,
+    0x7d, 0xf7, 0x43, 0x52, 0x90, 0x99, 0x92, 0xa4, 0xe8, 0x46, 0x5a, 0xe7, 0x78, 0xfc, 0xf6, 0x40,
+    0x72, 0x6a, 0xe1, 0x71, 0xe2, 0x2b, 0x57, 0x2e, 0x7e, 0x06, 0x24, 0xf7, 0x29, 0x57, 0x7c, 0xbc,
+    0x65, 0x98, 0xaf, 0x78, 0x04, 0x88, 0x8d, 0x26, 0xc1, 0xb9, 0x4a, 0x4c, 0x65, 0x7b, 0xbc, 0xe1,
+    0x0d, 0xbf, 0x8a, 0x13, 0xce, 0xbf, 0x8d, 0xf0, 0x22, 0xe7, 0xe2, 0x5c, 0x6e, 0xb4, 0xa7, 0x82,
+    0xbc, 0xd4, 0x9e, 0x03, 0x1c, 0xbd, 0x20, 0x70, 0x15, 0x82, 0x27, 0x8d, 0x91, 0xb7, 0x1a, 0x97,
+    0xe0, 0xdc, 0x7f, 0xe5, 0xe2, 0x3f, 0x08, 0x0c, 0xbf, 0x86, 0x09, 0x7d, 0x0b, 0x13, 0xfe, 0x4e,
+    0x44, 0xd8, 0x5b, 0x88, 0xb0, 0x77, 0x20, 0x29, 0x3e, 0xde, 0xc0, 0x91, 0xfa, 0x71, 0x8f, 0xac,
+    0x20, 0x27, 0xc2, 0xda, 0x9c, 0x37, 0x07, 0xf4, 0xef, 0x2d, 0xb2, 0xd9, 0x6f, 0x4c, 0xa3, 0x23,
+    0x2e, 0xf9, 0x24, 0x55, 0x19, 0x9f, 0x6a, 0x3b, 0x38, 0xbd, 0x87, 0x1c, 0xe8, 0x87, 0xd3, 0x7e,
+    0xc5, 0x69, 0x97, 0x20, 0xc9, 0x5a, 0xc4, 0xf9, 0x8c, 0xf8, 0x8d, 0x56, 0xef, 0xf8, 0x2d, 0x4a,
+    0x8f, 0x1c, 0x36, 0x02, 0x12, 0x90, 0xb8, 0xd5, 0x21, 0x7b, 0x75, 0x78, 0xb3, 0xef, 0xf8, 0x95,
+    0x91, 0x92, 0x37, 0x71, 0xe3, 0xf3, 0x6c, 0x51, 0x92, 0xf6, 0xf8, 0x85, 0xcd, 0x7f, 0xcd, 0x04,
+    0xcc, 0xb6, 0xbb, 0x89, 0x32, 0xfb, 0x1b, 0xfe, 0x21, 0xd6, 0x4b, 0xe0, 0x60, 0x65, 0xa2, 0xe5,
+    0xc3, 0x85, 0x81, 0xf1, 0xc9, 0xf8, 0x69, 0x7c, 0x48, 0xfe, 0xea, 0x97, 0x67, 0x52, 0x51, 0xec,
+    0xb7, 0x94, 0xc2, 0x26, 0xef, 0xbc, 0x1f, 0x36, 0x9d, 0x52, 0xed, 0xc1, 0x92, 0x92, 0x54, 0xfd,
+    0x7a, 0xec, 0xf0, 0x73, 0xa4, 0x04, 0xa7, 0xde, 0x13, 0x4c, 0x09, 0xc8, 0xb3, 0xa1, 0x1f, 0xec,
+    0x53, 0x14, 0x2d, 0x9f, 0x2e, 0xad, 0x8f, 0x2b, 0x2f, 0xcf, 0xae, 0x79, 0xc7, 0x33, 0x50, 0xa9,
+    0x8d, 0x83, 0x18, 0xf0, 0xf9, 0xc6, 0x35, 0xc1, 0xc6, 0x66, 0x9b, 0x39, 0x3b, 0x94, 0x9e, 0xb0,
+    0xb3, 0x91, 0x10, 0x64, 0x5e, 0xe5, 0x3e, 0xe4, 0xe4, 0x0b, 0xcb, 0x0d, 0x1a, 0xff, 0x16, 0x57,
+    0x45, 0xfb, 0xb0, 0x49, 0xb7, 0xbf, 0xc9, 0x5f, 0xaf, 0x6f, 0x94, 0xbf, 0xda, 0x95, 0x48, 0x19,
+    0xf8, 0x6f, 0x17, 0xc3, 0x8c, 0x0d, 0x79, 0x66, 0x90, 0x59, 0xab, 0x72, 0x00, 0x8c, 0x93, 0x12,
+    0x53, 0x27, 0x7e, 0xd1, 0x0b, 0xc8, 0x66, 0x8a, 0xad, 0xcf, 0xf5, 0xfe, 0x70, 0xda, 0x6c, 0x5c,
+    0x9e, 0x93, 0xca, 0x84, 0xcb, 0x0e, 0x1f, 0x99, 0x8a, 0x68, 0x91, 0x8f, 0xce, 0xaa, 0x7c, 0xc8,
+    0x99, 0x86, 0xaa, 0x46, 0x7e, 0xd0, 0x21, 0x66, 0x06, 0x73, 0x60, 0x3b, 0xa0, 0x83, 0x74, 0xec,
+    0x0c, 0xc6, 0x40, 0x1e, 0x66, 0xe6, 0x21, 0x8a, 0x68, 0x3f, 0x5c, 0x4e, 0xd4, 0xc9, 0x96, 0x7c,
+    0xfc, 0x25, 0x25, 0x13, 0xc7, 0x80, 0x37, 0xaa, 0x3b, 0x88, 0x10, 0xb0, 0x43, 0x31, 0xb9, 0x91,
+    0x51, 0xe2, 0xa3, 0x9b, 0x42, 0xf3, 0xaa, 0xc1, 0xdc, 0xfe, 0x31, 0x82, 0x38, 0x89, 0x13, 0xa1,
+    0x48, 0x99, 0xda, 0xbf, 0x9d, 0x05, 0x35, 0x52, 0xd8, 0xc7, 0xb4, 0x6a, 0x5f, 0x92, 0x18, 0x03,
+    0xa4, 0xf4, 0xf2, 0x31, 0xb5, 0x91, 0x15, 0x15, 0x7e, 0x82, 0xe2, 0x1f, 0xeb, 0xfb, 0x04, 0x49,
+    0x8e, 0xa6, 0x7e, 0xf9, 0xdf, 0xf7, 0x80, 0xdd, 0xa6, 0x93, 0xc9, 0x00, 0x00,
+};
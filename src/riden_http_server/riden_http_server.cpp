@@ -3,7 +3,10 @@
 // SPDX-License-Identifier: MIT
 
 #include "http_static.h"
+#include "http_static_gz.h"
 #include <riden_config/riden_config.h>
+#include <riden_format/riden_format.h>
+#include <riden_format/riden_json.h>
 #include <riden_http_server/riden_http_server.h>
 #include <riden_logging/riden_logging.h>
 #include <vxi11_server/vxi_server.h>
@@ -16,7 +19,13 @@ using namespace RidenDongle;
 
 static const String scpi_protocol = "SCPI RAW";
 static const String modbustcp_protocol = "Modbus TCP";
+static const String modbusrtutcp_protocol = "Modbus RTU over TCP";
 static const String vxi11_protocol = "VXI-11";
+static const String hislip_protocol = "HiSLIP";
+// Upper bound of the /status response, built on the stack
+#define STATUS_JSON_LENGTH 320
+// Upper bound of an /events frame, the compact form of /status
+#define EVENTS_FRAME_LENGTH 160
 static const std::list<uint32_t> uart_baudrates = {
     9600,
     19200,
@@ -30,34 +39,52 @@ static const std::list<uint32_t> uart_baudrates = {
     1000000,
 };
 
+/**
+ * Format `value` with a fixed number of decimals into `buffer`, which must
+ * hold at least FIXED_BUFFER_LENGTH characters.
+ */
+static const char *fixed(char *buffer, double value, uint8_t decimals)
+{
+    format_fixed(buffer, FIXED_BUFFER_LENGTH, value, decimals);
+    return buffer;
+}
+
+static String fixed_to_string(double value, uint8_t decimals, const char *unit)
+{
+    char buffer[FIXED_BUFFER_LENGTH + 16];
+    size_t length = format_fixed(buffer, FIXED_BUFFER_LENGTH, value, decimals);
+    strncat(buffer, unit, sizeof(buffer) - length - 1);
+    return String(buffer);
+}
+
 static String voltage_to_string(double voltage)
 {
     if (voltage < 1) {
-        return String(voltage * 1000, 0) + " mV";
+        return fixed_to_string(voltage * 1000, 0, " mV");
     } else {
-        return String(voltage, 3) + " V";
+        return fixed_to_string(voltage, 3, " V");
     }
 }
 
 static String current_to_string(double current)
 {
     if (current < 1) {
-        return String(current * 1000, 0) + " mA";
+        return fixed_to_string(current * 1000, 0, " mA");
     } else {
-        return String(current, 3) + " A";
+        return fixed_to_string(current, 3, " A");
     }
 }
 
 static String power_to_string(double power)
 {
     if (power < 1) {
-        return String(power * 1000, 0) + " mW";
+        return fixed_to_string(power * 1000, 0, " mW");
     } else {
-        return String(power, 3) + " W";
+        return fixed_to_string(power, 3, " W");
     }
 }
 
-static String protection_to_string(Protection protection)
+static const char *protection_to_string(Protection protection)
 {
     switch (protection) {
     case Protection::OVP:
@@ -69,6 +96,47 @@ static String protection_to_string(Protection protection)
     }
 }
 
+/**
+ * Write the values shown on the control page, as an object for /status or,
+ * when `compact`, as an array of the values in the same order for /events.
+ */
+static void write_status(JsonWriter &json, const AllValues &all_values, double max_voltage, double max_current, bool compact)
+{
+    auto field = [&json, compact](const char *name) -> JsonWriter & {
+        return compact ? json : json.key(name);
+    };
+
+    if (compact) {
+        json.begin_array();
+    } else {
+        json.begin_object();
+    }
+    field("out_on").boolean(all_values.output_on);
+    field("set_v").fixed(all_values.voltage_set, 3);
+    field("set_c").fixed(all_values.current_set, 3);
+    field("out_v").fixed(all_values.voltage_out, 3);
+    field("out_c").fixed(all_values.current_out, 3);
+    field("batt_mode").boolean(all_values.is_battery_mode);
+    field("cvmode").boolean(all_values.output_mode == OutputMode::CONSTANT_VOLTAGE);
+    field("prot").string(protection_to_string(all_values.protection));
+    field("batt_v").fixed(all_values.voltage_battery, 3);
+    if (all_values.probe_temperature_celsius < -50.0) {
+        field("ext_t_c").null();
+    } else {
+        field("ext_t_c").fixed(all_values.probe_temperature_celsius, 2);
+    }
+    field("int_t_c").fixed(all_values.system_temperature_celsius, 2);
+    field("ah").fixed(all_values.ah, 3);
+    field("wh").fixed(all_values.wh, 3);
+    field("max_v").fixed(max_voltage, 3);
+    field("max_c").fixed(max_current, 3);
+    if (compact) {
+        json.end_array();
+    } else {
+        json.end_object();
+    }
+}
+
 static String outputmode_to_string(OutputMode output_mode)
 {
     switch (output_mode) {
@@ -118,6 +186,7 @@ bool RidenHttpServer::begin()
     server.on("/set_i", HTTPMethod::HTTP_POST, std::bind(&RidenHttpServer::handle_set_i, this));
     server.on("/set_v", HTTPMethod::HTTP_POST, std::bind(&RidenHttpServer::handle_set_v, this));
     server.on("/toggle_out", HTTPMethod::HTTP_GET, std::bind(&RidenHttpServer::handle_toggle_out, this));
+    server.on("/events", HTTPMethod::HTTP_GET, std::bind(&RidenHttpServer::handle_events_get, this));
     server.on("/disconnect_client/", HTTPMethod::HTTP_POST, std::bind(&RidenHttpServer::handle_disconnect_client_post, this));
     server.on("/reboot/dongle/", HTTPMethod::HTTP_GET, std::bind(&RidenHttpServer::handle_reboot_dongle_get, this));
     server.on("/firmware/update/", HTTPMethod::HTTP_POST,
@@ -126,6 +195,8 @@ bool RidenHttpServer::begin()
     server.on("/lxi/identification", HTTPMethod::HTTP_GET, std::bind(&RidenHttpServer::handle_lxi_identification, this));
     server.on("/qps/modbus/", HTTPMethod::HTTP_GET, std::bind(&RidenHttpServer::handle_modbus_qps, this));
     server.onNotFound(std::bind(&RidenHttpServer::handle_not_found, this));
+    const char *headers[] = {"If-None-Match"};
+    server.collectHeaders(headers, 1);
     server.begin(port());
 
     if (MDNS.isRunning() && modbus.is_connected()) {
@@ -141,6 +212,7 @@ bool RidenHttpServer::begin()
 void RidenHttpServer::loop(void)
 {
     server.handleClient();
+    push_events();
 }
 
 uint16_t RidenHttpServer::port()
@@ -158,6 +230,7 @@ void RidenHttpServer::handle_root_get()
         send_network_info();
         send_services();
         send_connected_clients();
+        send_client_statistics();
     } else {
         server.sendContent_P(HTML_NO_CONNECTION_BODY);
     }
@@ -185,8 +258,8 @@ void RidenHttpServer::handle_psu_get()
         send_info_row("Current Range", String(all_values.current_range, 10));
         send_info_row("Battery Mode", all_values.is_battery_mode ? "Yes" : "No");
         send_info_row("Voltage Battery", voltage_to_string(all_values.voltage_battery));
-        send_info_row("Ah", String(all_values.ah, 3) + " Ah");
-        send_info_row("Wh", String(all_values.wh, 3) + " Wh");
+        send_info_row("Ah", fixed_to_string(all_values.ah, 3, " Ah"));
+        send_info_row("Wh", fixed_to_string(all_values.wh, 3, " Wh"));
         server.sendContent("                </tbody>");
         server.sendContent("            </table>");
         server.sendContent("        </div>");
@@ -196,8 +269,8 @@ void RidenHttpServer::handle_psu_get()
         server.sendContent("            <table class='info'>");
         server.sendContent("                <tbody>");
         send_info_row("Voltage In", voltage_to_string(all_values.voltage_in));
-        send_info_row("System Temperature", String(all_values.system_temperature_celsius, 0) + "&deg;C" + " / " + String(all_values.system_temperature_fahrenheit, 0) + "&deg;F");
-        send_info_row("Probe Temperature", String(all_values.probe_temperature_celsius, 0) + "&deg;C" + " / " + String(all_values.probe_temperature_fahrenheit, 0) + "&deg;F");
+        send_info_row("System Temperature", fixed_to_string(all_values.system_temperature_celsius, 0, "&deg;C / ") + fixed_to_string(all_values.system_temperature_fahrenheit, 0, "&deg;F"));
+        send_info_row("Probe Temperature", fixed_to_string(all_values.probe_temperature_celsius, 0, "&deg;C / ") + fixed_to_string(all_values.probe_temperature_fahrenheit, 0, "&deg;F"));
         server.sendContent("                </tbody>");
         server.sendContent("            </table>");
         server.sendContent("        </div>");
@@ -290,6 +363,16 @@ void RidenHttpServer::handle_config_get()
         }
     }
     server.sendContent_P(HTML_CONFIG_BODY_3);
+    server.sendContent(String(riden_config.get_modbus_cache_max_age()));
+    server.sendContent_P(HTML_CONFIG_BODY_4);
+    server.sendContent(String(riden_config.get_modbus_rtu_over_tcp_port()));
+    server.sendContent_P(HTML_CONFIG_BODY_5);
+    server.sendContent(String(riden_config.get_modbus_udp_port()));
+    server.sendContent_P(HTML_CONFIG_BODY_6);
+    server.sendContent(String(riden_config.get_client_rate_limit()));
+    server.sendContent_P(HTML_CONFIG_BODY_7);
+    server.sendContent(String(riden_config.get_client_burst()));
+    server.sendContent_P(HTML_CONFIG_BODY_8);
     server.sendContent_P(HTML_FOOTER);
     server.sendContent("");
 }
@@ -299,10 +382,29 @@ void RidenHttpServer::handle_config_post()
     String tz = server.arg("timezone");
     String uart_baudrate_string = server.arg("uart_baudrate");
     uint32_t uart_baudrate = std::strtoull(uart_baudrate_string.c_str(), nullptr, 10);
+    String modbus_cache_max_age_string = server.arg("modbus_cache_max_age");
+    uint32_t modbus_cache_max_age = std::strtoull(modbus_cache_max_age_string.c_str(), nullptr, 10);
+    String modbus_rtu_over_tcp_port_string = server.arg("modbus_rtu_over_tcp_port");
+    uint16_t modbus_rtu_over_tcp_port = std::strtoul(modbus_rtu_over_tcp_port_string.c_str(), nullptr, 10);
+    String modbus_udp_port_string = server.arg("modbus_udp_port");
+    uint16_t modbus_udp_port = std::strtoul(modbus_udp_port_string.c_str(), nullptr, 10);
+    String client_rate_limit_string = server.arg("client_rate_limit");
+    uint16_t client_rate_limit = std::strtoul(client_rate_limit_string.c_str(), nullptr, 10);
+    String client_burst_string = server.arg("client_burst");
+    uint16_t client_burst = std::strtoul(client_burst_string.c_str(), nullptr, 10);
     LOG_F("Selected timezone: %s\r\n", tz.c_str());
     LOG_F("Selected baudrate: %u\r\n", uart_baudrate);
+    LOG_F("Selected Modbus cache max age: %u ms\r\n", modbus_cache_max_age);
+    LOG_F("Selected Modbus RTU over TCP port: %u\r\n", modbus_rtu_over_tcp_port);
+    LOG_F("Selected Modbus UDP port: %u\r\n", modbus_udp_port);
+    LOG_F("Selected client rate limit: %u/s, burst %u\r\n", client_rate_limit, client_burst);
     riden_config.set_timezone_name(tz);
     riden_config.set_uart_baudrate(uart_baudrate);
+    riden_config.set_modbus_cache_max_age(modbus_cache_max_age);
+    riden_config.set_modbus_rtu_over_tcp_port(modbus_rtu_over_tcp_port);
+    riden_config.set_modbus_udp_port(modbus_udp_port);
+    riden_config.set_client_rate_limit(client_rate_limit);
+    riden_config.set_client_burst(client_burst);
     riden_config.commit();
 
     send_redirect_self();
@@ -365,10 +467,12 @@ void RidenHttpServer::handle_disconnect_client_post()
     if (ip.fromString(ip_string)) {
         if (protocol == scpi_protocol) {
             scpi.disconnect_client(ip);
-        } else if (protocol == modbustcp_protocol) {
+        } else if (protocol == modbustcp_protocol || protocol == modbusrtutcp_protocol) {
             bridge.disconnect_client(ip);
         } else if (protocol == vxi11_protocol) {
             vxi_server.disconnect_client(ip);
+        } else if (protocol == hislip_protocol) {
+            hislip.disconnect_client(ip);
         }
     }
 
@@ -400,11 +504,7 @@ void RidenHttpServer::handle_reboot_dongle_get()
 
 void RidenHttpServer::handle_control_get(void)
 {
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "text/html", HTML_HEADER);
-    server.sendContent_P(HTML_CONTROL_BODY);
-    server.sendContent_P(HTML_FOOTER);
-    server.sendContent("");
+    send_gzip("text/html", HTML_CONTROL_PAGE_GZ, sizeof(HTML_CONTROL_PAGE_GZ), HTML_CONTROL_PAGE_ETAG);
 }
 
 void RidenHttpServer::handle_status_get(void)
@@ -413,28 +513,15 @@ void RidenHttpServer::handle_status_get(void)
     // get a subset of the values, reading in bulk to be fast
     // Make sure this is below 800ms, because otherwise the graph will suffer
     if (modbus.is_connected() && modbus.get_all_values(all_values, true)) {
-        String s = "{";
-        s += "\"out_on\": " + String(all_values.output_on ? "true" : "false");
-        s += ",\"set_v\": " + String(all_values.voltage_set, 3);
-        s += ",\"set_c\": " + String(all_values.current_set, 3);
-        s += ",\"out_v\": " + String(all_values.voltage_out, 3);
-        s += ",\"out_c\": " + String(all_values.current_out, 3);
-        s += ",\"batt_mode\": " + String(all_values.is_battery_mode ? "true" : "false");
-        s += ",\"cvmode\": " + String(all_values.output_mode == OutputMode::CONSTANT_VOLTAGE ? "true" : "false");
-        s += ",\"prot\": \"" + protection_to_string(all_values.protection) + "\"";
-        s += ",\"batt_v\": " + String(all_values.voltage_battery, 3);
-        if (all_values.probe_temperature_celsius < -50.0) {
-            s += ",\"ext_t_c\": null";
+        char buffer[STATUS_JSON_LENGTH];
+        JsonWriter json(buffer, sizeof(buffer));
+        write_status(json, all_values, modbus.get_max_voltage(), modbus.get_max_current(), false);
+        if (json.failed()) {
+            LOG_LN("RidenHttpServer: /status does not fit STATUS_JSON_LENGTH");
+            server.send(500, "text/plain", "Status too large");
         } else {
-            s += ",\"ext_t_c\": " + String(all_values.probe_temperature_celsius, 2);
+            server.send(200, "application/json", json.c_str(), json.length());
         }
-        s += ",\"int_t_c\": " + String(all_values.system_temperature_celsius, 2);
-        s += ",\"ah\": " + String(all_values.ah, 3);
-        s += ",\"wh\": " + String(all_values.wh, 3);
-        s += ",\"max_v\": " + String(modbus.get_max_voltage(), 3);
-        s += ",\"max_c\": " + String(modbus.get_max_current(), 3);
-        s += "}";
-        server.send(200, "application/json", s);
     } else {
         server.send(500, "text/plain", "Not connected to power supply");
     }
@@ -481,6 +568,115 @@ void RidenHttpServer::handle_toggle_out()
     }
 }
 
+/**
+ * Subscribe to the telemetry as Server-Sent Events. The optional "interval"
+ * argument is the time between updates in milliseconds.
+ *
+ * Each event is a compact frame, see write_status(). The connection is kept
+ * open and fed by push_events().
+ */
+void RidenHttpServer::handle_events_get()
+{
+    long interval = EVENTS_DEFAULT_INTERVAL;
+    if (server.hasArg("interval")) {
+        interval = constrain(server.arg("interval").toInt(), EVENTS_MIN_INTERVAL, EVENTS_MAX_INTERVAL);
+    }
+
+    EventSubscriber *subscriber = nullptr;
+    for (auto &candidate : subscribers) {
+        if (candidate.interval == 0) {
+            subscriber = &candidate;
+            break;
+        }
+    }
+    if (subscriber == nullptr) {
+        server.send(503, "text/plain", "Too many subscribers");
+        return;
+    }
+
+    // The headers are written directly, as the response never ends
+    server.sendContent_P(EVENTS_HEADER);
+    subscriber->client = server.client();
+    subscriber->client.setNoDelay(true);
+    subscriber->interval = interval;
+    subscriber->sent_at = millis() - interval;
+    LOG_F("Telemetry subscriber %s, every %ld ms\n", subscriber->client.remoteIP().toString().c_str(), interval);
+}
+
+/**
+ * Send the telemetry to the subscribers that are due. Events are made from
+ * the values of the background poll of RidenModbus, so subscribers cause no
+ * traffic of their own on the bus.
+ */
+void RidenHttpServer::push_events()
+{
+    bool subscribed = false;
+    for (auto &subscriber : subscribers) {
+        if (subscriber.interval == 0) {
+            continue;
+        }
+        if (!subscriber.client.connected()) {
+            LOG_F("Telemetry subscriber %s left\n", subscriber.client.remoteIP().toString().c_str());
+            subscriber.client.stop();
+            subscriber.interval = 0;
+            continue;
+        }
+        subscribed = true;
+    }
+    uint32_t poll_count = modbus.get_poll_count();
+    if (!subscribed || poll_count == events_poll_count) {
+        return;
+    }
+    events_poll_count = poll_count;
+
+    AllValues all_values;
+    if (!modbus.get_polled_values(all_values)) {
+        return;
+    }
+    char frame[EVENTS_FRAME_LENGTH];
+    strcpy(frame, "data:");
+    JsonWriter json(frame + 5, sizeof(frame) - 5 - 2);
+    write_status(json, all_values, modbus.get_max_voltage(), modbus.get_max_current(), true);
+    if (json.failed()) {
+        return;
+    }
+    size_t length = 5 + json.length();
+    frame[length++] = '\n';
+    frame[length++] = '\n';
+
+    unsigned long now = millis();
+    for (auto &subscriber : subscribers) {
+        // Subscribers with a longer interval get the poll nearest their due time
+        if (subscriber.interval == 0 || now - subscriber.sent_at + RIDEN_POLL_INTERVAL / 2 < subscriber.interval) {
+            continue;
+        }
+        // A subscriber which is not keeping up misses this frame rather than stall the loop
+        if ((size_t)subscriber.client.availableForWrite() >= length) {
+            subscriber.client.write(frame, length);
+        }
+        subscriber.sent_at = now;
+    }
+}
+
+/**
+ * Send a page compressed at build time, see scripts/make_static_gz.py.
+ *
+ * The URL of the page stays the same across firmware versions, so browsers
+ * are told to revalidate it every time, which costs a 304 as long as the
+ * page has not changed.
+ */
+void RidenHttpServer::send_gzip(const char *content_type, const uint8_t *content, size_t length, const char *etag)
+{
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "no-cache");
+    if (server.header("If-None-Match") == etag) {
+        server.send(304);
+        return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, content_type, (PGM_P)content, length);
+}
+
 void RidenHttpServer::send_redirect_root()
 {
     server.setContentLength(CONTENT_LENGTH_UNKNOWN);
@@ -566,9 +762,17 @@ void RidenHttpServer::send_services()
     server.sendContent("                <tbody>");
     send_info_row("Web Server Port", String(this->port(), 10));
     send_info_row("Modbus TCP Port", String(bridge.port(), 10));
+    if (bridge.rtu_over_tcp_port() != 0) {
+        send_info_row("Modbus RTU over TCP Port", String(bridge.rtu_over_tcp_port(), 10));
+    }
+    if (bridge.udp_port() != 0) {
+        send_info_row("Modbus UDP Port", String(bridge.udp_port(), 10));
+    }
     send_info_row("VXI-11 Port", String(vxi_server.port(), 10));
+    send_info_row("HiSLIP Port", String(hislip.port(), 10));
     send_info_row("SCPI RAW Port", String(scpi.port(), 10));
     send_info_row("VISA Resource Address VXI-11", vxi_server.get_visa_resource());
+    send_info_row("VISA Resource Address HiSLIP", hislip.get_visa_resource());
     send_info_row("VISA Resource Address RAW", scpi.get_visa_resource());
     server.sendContent("                </tbody>");
     server.sendContent("            </table>");
@@ -589,12 +793,50 @@ void RidenHttpServer::send_connected_clients()
     for (auto const &ip : vxi_server.get_connected_clients()) {
         send_client_row(ip, vxi11_protocol);
     }    
+    for (auto const &ip : hislip.get_connected_clients()) {
+        send_client_row(ip, hislip_protocol);
+    }
     for (auto const &ip : scpi.get_connected_clients()) {
         send_client_row(ip, scpi_protocol);
     }
     for (auto const &ip : bridge.get_connected_clients()) {
         send_client_row(ip, modbustcp_protocol);
     }
+    for (auto const &ip : bridge.get_connected_rtu_over_tcp_clients()) {
+        send_client_row(ip, modbusrtutcp_protocol);
+    }
+    server.sendContent("                </tbody>");
+    server.sendContent("            </table>");
+    server.sendContent("        </div>");
+}
+
+void RidenHttpServer::send_client_statistics()
+{
+    server.sendContent("        <div class='box'>");
+    server.sendContent("            <h2>Client Statistics</h2>");
+    server.sendContent("            <table class='clients'>");
+    server.sendContent("                <thead><tr>");
+    server.sendContent("                <th>IP address</th>");
+    server.sendContent("                <th>Protocol</th>");
+    server.sendContent("                <th>Requests</th>");
+    server.sendContent("                <th>Throttled</th>");
+    server.sendContent("                <th>Avg. Latency</th>");
+    server.sendContent("                </tr></thead>");
+    server.sendContent("                <tbody>");
+    RidenScheduler &scheduler = modbus.get_scheduler();
+    for (uint8_t i = 0; i < SCHEDULER_MAX_CLIENTS; i++) {
+        ClientStatistics *client = scheduler.get_client(i);
+        if (client == nullptr) {
+            continue;
+        }
+        server.sendContent("<tr>");
+        server.sendContent("<td>" + IPAddress(client->ip).toString() + "</td>");
+        server.sendContent("<td>" + (client->traffic_class == TrafficClass::Scpi ? scpi_protocol : String("Modbus")) + "</td>");
+        server.sendContent("<td>" + String(client->requests, 10) + "</td>");
+        server.sendContent("<td>" + String(client->throttled, 10) + "</td>");
+        server.sendContent("<td>" + String(client->average_latency(), 10) + " ms</td>");
+        server.sendContent("</tr>");
+    }
     server.sendContent("                </tbody>");
     server.sendContent("            </table>");
     server.sendContent("        </div>");
@@ -647,7 +889,8 @@ void RidenHttpServer::handle_modbus_qps()
     double qps = 1000.0 * double(100) / double(end - start);
     LOG_F("qps = %f\r\n", qps);
     server.sendContent("<p>Result = ");
-    server.sendContent(String(qps, 1));
+    char number[FIXED_BUFFER_LENGTH];
+    server.sendContent(fixed(number, qps, 1));
     server.sendContent(" queries/second</p>");
     server.sendContent_P(HTML_FOOTER);
     server.sendContent("");
@@ -23,6 +23,28 @@ SoftwareSerial SerialRuideng = SoftwareSerial(MODBUS_RX, MODBUS_TX);
 
 using namespace RidenDongle;
 
+#ifndef MOCK_RIDEN
+// Outcome of the most recent transaction started by RidenModbus
+static Modbus::ResultCode last_result = Modbus::EX_SUCCESS;
+
+static bool modbus_transaction_callback(Modbus::ResultCode event, uint16_t transaction_id, void *data)
+{
+    last_result = event;
+    return true;
+}
+
+// Outcome of the background poll
+static bool poll_done = false;
+static Modbus::ResultCode poll_result = Modbus::EX_SUCCESS;
+
+static bool modbus_poll_callback(Modbus::ResultCode event, uint16_t transaction_id, void *data)
+{
+    poll_result = event;
+    poll_done = true;
+    return true;
+}
+#endif
+
 bool RidenModbus::begin()
 {
 #ifdef MOCK_RIDEN
@@ -103,6 +125,11 @@ bool RidenModbus::begin()
 bool RidenModbus::loop()
 {
 #ifdef MOCK_RIDEN
+    sequencer.loop(*this);
+    if (millis() - poll_started_at >= RIDEN_POLL_INTERVAL) {
+        poll_started_at = millis();
+        poll_count++;
+    }
     return true;
 #else
     if (!initialized) {
@@ -110,10 +137,87 @@ bool RidenModbus::loop()
     }
 
     modbus.task();
+    if (polling && poll_done) {
+        finish_poll();
+    }
+    sequencer.loop(*this);
+    if (!polling && !modbus.server()) {
+        if (slow_poll_due) {
+            start_poll(true);
+        } else if (millis() - poll_started_at >= RIDEN_POLL_INTERVAL) {
+            start_poll(false);
+        }
+    }
     return true;
 #endif
 }
 
+void RidenModbus::start_poll(const bool slow)
+{
+#ifndef MOCK_RIDEN
+    poll_done = false;
+    polling_slow = slow;
+    if (slow) {
+        slow_poll_due = false;
+        slow_poll_started_at = millis();
+        polling = modbus.readHreg(MODBUS_ADDRESS, +RIDEN_SLOW_POLL_FIRST_REGISTER, slow_poll_values, RIDEN_SLOW_POLL_REGISTERS, modbus_poll_callback);
+    } else {
+        poll_started_at = millis();
+        polling = modbus.readHreg(MODBUS_ADDRESS, +RIDEN_POLL_FIRST_REGISTER, poll_values, RIDEN_POLL_REGISTERS, modbus_poll_callback);
+    }
+#endif
+}
+
+void RidenModbus::finish_poll()
+{
+#ifndef MOCK_RIDEN
+    polling = false;
+    bool success = (poll_result == Modbus::EX_SUCCESS);
+    record_transaction(polling_slow ? slow_poll_started_at : poll_started_at, success);
+    if (!success) {
+        return;
+    }
+    if (polling_slow) {
+        register_cache.store(+RIDEN_SLOW_POLL_FIRST_REGISTER, slow_poll_values, RIDEN_SLOW_POLL_REGISTERS);
+        return;
+    }
+
+    register_cache.store(+RIDEN_POLL_FIRST_REGISTER, poll_values, RIDEN_POLL_REGISTERS);
+    poll_count++;
+    if (++polls_since_slow >= RIDEN_SLOW_POLL_EVERY) {
+        polls_since_slow = 0;
+        slow_poll_due = true;
+    }
+
+    const uint16_t first = +RIDEN_POLL_FIRST_REGISTER;
+    Sample sample;
+    sample.timestamp = poll_started_at;
+    sample.voltage = value_to_voltage(poll_values[+Register::VoltageOut - first]);
+    sample.current = value_to_current(poll_values[+Register::CurrentOut - first]);
+    sample.power = values_to_power(&poll_values[+Register::PowerOut_H - first]);
+    sample_log.add(sample);
+#endif
+}
+
+void RidenModbus::record_transaction(const unsigned long started_at, const bool success)
+{
+    statistics.transactions++;
+    if (!success) {
+        statistics.failures++;
+        return;
+    }
+    unsigned long elapsed = millis() - started_at;
+    uint16_t latency = (elapsed > 0xffff) ? 0xffff : elapsed;
+    if (statistics.transactions - statistics.failures == 1 || latency < statistics.min_latency) {
+        statistics.min_latency = latency;
+    }
+    if (latency > statistics.max_latency) {
+        statistics.max_latency = latency;
+    }
+    statistics.last_latency = latency;
+    statistics.total_latency += latency;
+}
+
 bool RidenModbus::is_connected()
 {
     return initialized;
@@ -126,8 +230,8 @@ String RidenModbus::get_type()
 
 bool RidenModbus::get_all_values(AllValues &all_values, bool subset)
 {
-    // Reading all registers at once fails silently, so
-    // we read 20 registers at a time instead.
+    // Reading all registers at once fails silently, so we read
+    // RIDEN_MAX_REGISTERS_PER_READ registers at a time instead.
 
     Register last_reg = Register::M9_OCP;
     if (subset) {
@@ -136,32 +240,14 @@ bool RidenModbus::get_all_values(AllValues &all_values, bool subset)
     }
     int total_nof_regs = (+last_reg) + 1;
     uint16_t values[total_nof_regs];
-    for (int first_reg_to_read = 0; first_reg_to_read < total_nof_regs; first_reg_to_read += 20) {
-        int regs_to_read = min(20, total_nof_regs - first_reg_to_read);
+    for (int first_reg_to_read = 0; first_reg_to_read < total_nof_regs; first_reg_to_read += RIDEN_MAX_REGISTERS_PER_READ) {
+        int regs_to_read = min(RIDEN_MAX_REGISTERS_PER_READ, total_nof_regs - first_reg_to_read);
         if (!read_holding_registers(first_reg_to_read, &(values[first_reg_to_read]), regs_to_read)) {
             return false;
         }
     }
 
-    all_values.system_temperature_celsius = values_to_temperature(&(values[+Register::SystemTemperatureCelsius_Sign]));
-    all_values.system_temperature_fahrenheit = values_to_temperature(&(values[+Register::SystemTemperatureFarhenheit_Sign]));
-    all_values.voltage_set = value_to_voltage(values[+Register::VoltageSet]);
-    all_values.current_set = value_to_current(values[+Register::CurrentSet]);
-    all_values.voltage_out = value_to_voltage(values[+Register::VoltageOut]);
-    all_values.current_out = value_to_current(values[+Register::CurrentOut]);
-    all_values.power_out = values_to_power(&(values[+Register::PowerOut_H]));
-    all_values.voltage_in = value_to_voltage_in(values[+Register::VoltageIn]);
-    all_values.keypad_locked = values[+Register::Keypad] != 0;
-    all_values.protection = value_to_protection(values[+Register::Protection]);
-    all_values.output_mode = value_to_output_mode(values[+Register::OutputMode]);
-    all_values.output_on = values[+Register::Output] != 0;
-    all_values.current_range = values[+Register::CurrentRange];
-    all_values.is_battery_mode = values[+Register::BatteryMode] != 0;
-    all_values.voltage_battery = value_to_voltage(values[+Register::VoltageBattery]);
-    all_values.probe_temperature_celsius = values_to_temperature(&(values[+Register::ProbeTemperatureCelsius_Sign]));
-    all_values.probe_temperature_fahrenheit = values_to_temperature(&(values[+Register::ProbeTemperatureFarhenheit_Sign]));
-    all_values.ah = values_to_ah(&(values[+Register::AH_H]));
-    all_values.wh = values_to_wh(&(values[+Register::WH_H]));
+    decode_values(values, all_values);
 
     if (subset) {
         // If we only want a subset, we can return early.
@@ -192,6 +278,85 @@ bool RidenModbus::get_all_values(AllValues &all_values, bool subset)
     return true;
 }
 
+bool RidenModbus::get_polled_values(AllValues &all_values)
+{
+#ifdef MOCK_RIDEN
+    return get_all_values(all_values, true);
+#else
+    uint16_t values[+Register::SUBSET_END + 1] = {};
+    if (!register_cache.lookup(+RIDEN_POLL_FIRST_REGISTER, &values[+RIDEN_POLL_FIRST_REGISTER], RIDEN_POLL_REGISTERS, RIDEN_POLL_MAX_AGE) ||
+        !register_cache.lookup(+RIDEN_SLOW_POLL_FIRST_REGISTER, &values[+RIDEN_SLOW_POLL_FIRST_REGISTER], RIDEN_SLOW_POLL_REGISTERS, RIDEN_SLOW_POLL_MAX_AGE)) {
+        return false;
+    }
+    decode_values(values, all_values);
+    return true;
+#endif
+}
+
+/**
+ * Decode the registers up to `Register::SUBSET_END`, indexed by register.
+ */
+void RidenModbus::decode_values(const uint16_t *values, AllValues &all_values)
+{
+    all_values.system_temperature_celsius = values_to_temperature(&(values[+Register::SystemTemperatureCelsius_Sign]));
+    all_values.system_temperature_fahrenheit = values_to_temperature(&(values[+Register::SystemTemperatureFarhenheit_Sign]));
+    all_values.voltage_set = value_to_voltage(values[+Register::VoltageSet]);
+    all_values.current_set = value_to_current(values[+Register::CurrentSet]);
+    all_values.voltage_out = value_to_voltage(values[+Register::VoltageOut]);
+    all_values.current_out = value_to_current(values[+Register::CurrentOut]);
+    all_values.power_out = values_to_power(&(values[+Register::PowerOut_H]));
+    all_values.voltage_in = value_to_voltage_in(values[+Register::VoltageIn]);
+    all_values.keypad_locked = values[+Register::Keypad] != 0;
+    all_values.protection = value_to_protection(values[+Register::Protection]);
+    all_values.output_mode = value_to_output_mode(values[+Register::OutputMode]);
+    all_values.output_on = values[+Register::Output] != 0;
+    all_values.current_range = values[+Register::CurrentRange];
+    all_values.is_battery_mode = values[+Register::BatteryMode] != 0;
+    all_values.voltage_battery = value_to_voltage(values[+Register::VoltageBattery]);
+    all_values.probe_temperature_celsius = values_to_temperature(&(values[+Register::ProbeTemperatureCelsius_Sign]));
+    all_values.probe_temperature_fahrenheit = values_to_temperature(&(values[+Register::ProbeTemperatureFarhenheit_Sign]));
+    all_values.ah = values_to_ah(&(values[+Register::AH_H]));
+    all_values.wh = values_to_wh(&(values[+Register::WH_H]));
+}
+
+bool RidenModbus::get_measurements(Measurements &measurements)
+{
+    const uint16_t first = +Register::VoltageOut;
+    uint16_t values[+Register::PowerOut_L - first + 1];
+    if (!read_holding_registers(Register::VoltageOut, values, sizeof(values) / sizeof(values[0]))) {
+        return false;
+    }
+    measurements.voltage_out = value_to_voltage(values[+Register::VoltageOut - first]);
+    measurements.current_out = value_to_current(values[+Register::CurrentOut - first]);
+    measurements.power_out = values_to_power(&values[+Register::PowerOut_H - first]);
+    return true;
+}
+
+bool RidenModbus::get_extended_measurements(ExtendedMeasurements &measurements)
+{
+    const uint16_t first = +Register::SystemTemperatureCelsius_Sign;
+    uint16_t values[+Register::OutputMode - first + 1];
+    if (!read_holding_registers(Register::SystemTemperatureCelsius_Sign, values, sizeof(values) / sizeof(values[0]))) {
+        return false;
+    }
+    const uint16_t probe_first = +Register::ProbeTemperatureCelsius_Sign;
+    uint16_t probe_values[+Register::WH_L - probe_first + 1];
+    if (!read_holding_registers(Register::ProbeTemperatureCelsius_Sign, probe_values, sizeof(probe_values) / sizeof(probe_values[0]))) {
+        return false;
+    }
+
+    measurements.voltage_out = value_to_voltage(values[+Register::VoltageOut - first]);
+    measurements.current_out = value_to_current(values[+Register::CurrentOut - first]);
+    measurements.power_out = values_to_power(&values[+Register::PowerOut_H - first]);
+    measurements.output_mode = value_to_output_mode(values[+Register::OutputMode - first]);
+    measurements.protection = value_to_protection(values[+Register::Protection - first]);
+    measurements.system_temperature_celsius = values_to_temperature(&values[+Register::SystemTemperatureCelsius_Sign - first]);
+    measurements.probe_temperature_celsius = values_to_temperature(&probe_values[+Register::ProbeTemperatureCelsius_Sign - probe_first]);
+    measurements.ah = values_to_ah(&probe_values[+Register::AH_H - probe_first]);
+    measurements.wh = values_to_wh(&probe_values[+Register::WH_H - probe_first]);
+    return true;
+}
+
 bool RidenModbus::reboot_to_bootloader()
 {
     return write_holding_register(256, 5633);
@@ -257,6 +422,12 @@ bool RidenModbus::set_current_set(const double current)
     return write_current(Register::CurrentSet, current);
 }
 
+bool RidenModbus::set_voltage_and_current_set(const double voltage, const double current)
+{
+    uint16_t values[] = {voltage_to_value(voltage), current_to_value(current)};
+    return write_holding_registers(Register::VoltageSet, values, 2);
+}
+
 bool RidenModbus::get_voltage_out(double &voltage)
 {
     return read_voltage(Register::VoltageOut, voltage);
@@ -712,12 +883,21 @@ bool RidenModbus::read_holding_registers(const uint16_t offset, uint16_t *value,
     if (!wait_for_inactive()) {
         return false;
     }
-    bool res = modbus.readHreg(MODBUS_ADDRESS, offset, value, numregs);
+    last_result = Modbus::EX_GENERAL_FAILURE;
+    unsigned long started_at = millis();
+    bool res = modbus.readHreg(MODBUS_ADDRESS, offset, value, numregs, modbus_transaction_callback);
     if (!res) {
         return false;
     }
     // Wait until we receive an answer
-    return wait_for_inactive();
+    if (!wait_for_inactive()) {
+        return false;
+    }
+    record_transaction(started_at, last_result == Modbus::EX_SUCCESS);
+    if (last_result == Modbus::EX_SUCCESS) {
+        register_cache.store(offset, value, numregs);
+    }
+    return true;
 #endif
 }
 
@@ -729,12 +909,21 @@ bool RidenModbus::write_holding_register(const uint16_t offset, const uint16_t v
     if (!wait_for_inactive()) {
         return false;
     }
-    bool res = modbus.writeHreg(MODBUS_ADDRESS, offset, value);
+    last_result = Modbus::EX_GENERAL_FAILURE;
+    unsigned long started_at = millis();
+    bool res = modbus.writeHreg(MODBUS_ADDRESS, offset, value, modbus_transaction_callback);
     if (!res) {
         return false;
     }
     // Wait until we receive an answer
-    return wait_for_inactive();
+    if (!wait_for_inactive()) {
+        return false;
+    }
+    record_transaction(started_at, last_result == Modbus::EX_SUCCESS);
+    if (last_result == Modbus::EX_SUCCESS) {
+        update_cached_holding_registers(offset, &value, 1);
+    }
+    return true;
 #endif
 }
 
@@ -746,12 +935,21 @@ bool RidenModbus::write_holding_registers(const uint16_t offset, uint16_t *value
     if (!wait_for_inactive()) {
         return false;
     }
-    bool res = modbus.writeHreg(MODBUS_ADDRESS, offset, value, numregs);
+    last_result = Modbus::EX_GENERAL_FAILURE;
+    unsigned long started_at = millis();
+    bool res = modbus.writeHreg(MODBUS_ADDRESS, offset, value, numregs, modbus_transaction_callback);
     if (!res) {
         return false;
     }
     // Wait until we receive an answer
-    return wait_for_inactive();
+    if (!wait_for_inactive()) {
+        return false;
+    }
+    record_transaction(started_at, last_result == Modbus::EX_SUCCESS);
+    if (last_result == Modbus::EX_SUCCESS) {
+        update_cached_holding_registers(offset, value, numregs);
+    }
+    return true;
 #endif
 }
 
@@ -773,6 +971,27 @@ bool RidenModbus::write_holding_registers(const Register reg, uint16_t *value, u
     return write_holding_registers(offset, value, numregs);
 }
 
+bool RidenModbus::read_cached_holding_registers(const uint16_t offset, uint16_t *value, const uint16_t numregs, const unsigned long max_age)
+{
+    return register_cache.lookup(offset, value, numregs, max_age);
+}
+
+void RidenModbus::update_cached_holding_registers(const uint16_t offset, const uint16_t *value, const uint16_t numregs)
+{
+    if (offset <= +Register::Preset && +Register::Preset < offset + numregs) {
+        // Recalling a preset changes the set values and protection
+        // limits in ways we cannot predict from the write itself.
+        register_cache.invalidate();
+        return;
+    }
+    register_cache.store(offset, value, numregs);
+}
+
+void RidenModbus::invalidate_cached_holding_registers()
+{
+    register_cache.invalidate();
+}
+
 double RidenModbus::value_to_voltage(const uint16_t value)
 {
     return double(value) / v_multi;
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_modbus/riden_register_cache.h>
+
+#include <Arduino.h>
+
+using namespace RidenDongle;
+
+void RegisterCache::store(const uint16_t offset, const uint16_t *values, const uint16_t numregs)
+{
+    unsigned long now = millis();
+    for (uint16_t i = 0; i < numregs; i++) {
+        uint32_t reg = uint32_t(offset) + i;
+        if (reg >= REGISTER_CACHE_SIZE) {
+            break;
+        }
+        this->values[reg] = values[i];
+        updated_at[reg] = now;
+        valid[reg] = true;
+    }
+}
+
+bool RegisterCache::lookup(const uint16_t offset, uint16_t *values, const uint16_t numregs, const unsigned long max_age)
+{
+    if (numregs == 0 || uint32_t(offset) + numregs > REGISTER_CACHE_SIZE) {
+        return false;
+    }
+    unsigned long now = millis();
+    for (uint16_t i = 0; i < numregs; i++) {
+        uint16_t reg = offset + i;
+        if (!valid[reg] || now - updated_at[reg] > max_age) {
+            return false;
+        }
+    }
+    memcpy(values, &(this->values[offset]), numregs * sizeof(uint16_t));
+    return true;
+}
+
+void RegisterCache::invalidate()
+{
+    memset(valid, 0, sizeof(valid));
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_modbus/riden_sample_log.h>
+
+using namespace RidenDongle;
+
+void SampleLog::add(const Sample &sample)
+{
+    Sample previous;
+    if (latest(previous)) {
+        unsigned long elapsed = sample.timestamp - previous.timestamp;
+        if (elapsed <= SAMPLE_MAX_GAP) {
+            // Trapezoidal integration
+            energy += (double(previous.power) + double(sample.power)) / 2.0 * double(elapsed) / 1000.0;
+        }
+    }
+
+    if (count < SAMPLE_LOG_SIZE) {
+        samples[(first + count) % SAMPLE_LOG_SIZE] = sample;
+        count++;
+    } else {
+        samples[first] = sample;
+        first = (first + 1) % SAMPLE_LOG_SIZE;
+    }
+    next_sequence++;
+}
+
+void SampleLog::clear()
+{
+    first = 0;
+    count = 0;
+}
+
+const Sample &SampleLog::get(const uint16_t index)
+{
+    return samples[(first + index) % SAMPLE_LOG_SIZE];
+}
+
+bool SampleLog::latest(Sample &sample)
+{
+    if (count == 0) {
+        return false;
+    }
+    sample = get(count - 1);
+    return true;
+}
+
+bool SampleLog::get_by_sequence(const uint32_t sequence, Sample &sample)
+{
+    uint32_t age = next_sequence - sequence;
+    if (age == 0 || age > count) {
+        return false;
+    }
+    sample = get(count - age);
+    return true;
+}
+
+SampleAverages SampleLog::get_averages()
+{
+    SampleAverages averages = {0, 0.0, 0.0, 0.0};
+    uint16_t n = (count < SAMPLE_AVERAGE_WINDOW) ? count : SAMPLE_AVERAGE_WINDOW;
+    for (uint16_t i = count - n; i < count; i++) {
+        const Sample &sample = get(i);
+        averages.voltage += sample.voltage;
+        averages.current += sample.current;
+        averages.power += sample.power;
+    }
+    if (n > 0) {
+        averages.voltage /= n;
+        averages.current /= n;
+        averages.power /= n;
+    }
+    averages.count = n;
+    return averages;
+}
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_config/riden_config.h>
+#include <riden_modbus/riden_scheduler.h>
+
+#include <Arduino.h>
+
+using namespace RidenDongle;
+
+void RidenScheduler::record_request(const TrafficClass traffic_class, const uint32_t ip)
+{
+    find_client(traffic_class, ip).requests++;
+}
+
+void RidenScheduler::record_throttled(const TrafficClass traffic_class, const uint32_t ip)
+{
+    find_client(traffic_class, ip).throttled++;
+}
+
+void RidenScheduler::record_latency(const TrafficClass traffic_class, const uint32_t ip, const unsigned long received_at)
+{
+    ClientStatistics &client = find_client(traffic_class, ip);
+    client.completed++;
+    client.total_latency += millis() - received_at;
+}
+
+void RidenScheduler::set_backlogged(const TrafficClass traffic_class, const bool backlogged)
+{
+    uint8_t index = +traffic_class;
+    if (backlogged && !this->backlogged[index]) {
+        // Idle time does not earn credit, so start out level with
+        // the protocols already competing.
+        for (uint8_t other = 0; other < +TrafficClass::COUNT; other++) {
+            if (other != index && this->backlogged[other]) {
+                virtual_time[index] = max(virtual_time[index], virtual_time[other]);
+            }
+        }
+    }
+    this->backlogged[index] = backlogged;
+}
+
+bool RidenScheduler::within_rate(const TrafficClass traffic_class, const uint32_t ip)
+{
+    if (riden_config.get_client_rate_limit() == 0) {
+        return true;
+    }
+    ClientStatistics &client = find_client(traffic_class, ip);
+    refill(client);
+    return client.tokens >= 1.0f;
+}
+
+bool RidenScheduler::within_share(const TrafficClass traffic_class)
+{
+    uint8_t index = +traffic_class;
+    double finish = virtual_time[index] + cost(traffic_class);
+    for (uint8_t other = 0; other < +TrafficClass::COUNT; other++) {
+        if (other != index && backlogged[other] &&
+            virtual_time[other] + cost(TrafficClass(other)) < finish) {
+            // Another protocol is behind on its share
+            return false;
+        }
+    }
+    return true;
+}
+
+void RidenScheduler::admit(const TrafficClass traffic_class, const uint32_t ip)
+{
+    virtual_time[+traffic_class] += cost(traffic_class);
+    if (riden_config.get_client_rate_limit() != 0) {
+        ClientStatistics &client = find_client(traffic_class, ip);
+        refill(client);
+        client.tokens = max(client.tokens - 1.0f, 0.0f);
+    }
+}
+
+ClientStatistics *RidenScheduler::get_client(const uint8_t index)
+{
+    if (index >= SCHEDULER_MAX_CLIENTS || !clients[index].used) {
+        return nullptr;
+    }
+    return &clients[index];
+}
+
+ClientStatistics &RidenScheduler::find_client(const TrafficClass traffic_class, const uint32_t ip)
+{
+    uint8_t found = 0;
+    for (uint8_t i = 0; i < SCHEDULER_MAX_CLIENTS; i++) {
+        ClientStatistics &client = clients[i];
+        if (client.used && client.traffic_class == traffic_class && client.ip == ip) {
+            client.last_seen = millis();
+            return client;
+        }
+        // Otherwise reuse an unused entry or the one seen least recently
+        if (clients[found].used && (!client.used || client.last_seen < clients[found].last_seen)) {
+            found = i;
+        }
+    }
+
+    ClientStatistics &client = clients[found];
+    client = ClientStatistics();
+    client.used = true;
+    client.traffic_class = traffic_class;
+    client.ip = ip;
+    client.tokens = riden_config.get_client_burst();
+    client.refilled_at = millis();
+    client.last_seen = millis();
+    return client;
+}
+
+void RidenScheduler::refill(ClientStatistics &client)
+{
+    unsigned long now = millis();
+    float burst = max(riden_config.get_client_burst(), uint16_t(1));
+    client.tokens = min(burst, client.tokens + riden_config.get_client_rate_limit() * (now - client.refilled_at) / 1000.0f);
+    client.refilled_at = now;
+}
+
+double RidenScheduler::cost(const TrafficClass traffic_class)
+{
+    switch (traffic_class) {
+    case TrafficClass::Modbus:
+        return 1.0 / SCHEDULER_WEIGHT_MODBUS;
+    case TrafficClass::Scpi:
+        return 1.0 / SCHEDULER_WEIGHT_SCPI;
+    default:
+        return 1.0;
+    }
+}
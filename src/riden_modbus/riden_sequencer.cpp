@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2024 Peder Toftegaard Olsen
+//
+// SPDX-License-Identifier: MIT
+
+#include <riden_logging/riden_logging.h>
+#include <riden_modbus/riden_modbus.h>
+#include <riden_modbus/riden_sequencer.h>
+
+#include <Arduino.h>
+
+using namespace RidenDongle;
+
+bool RidenSequencer::set_voltages(const float *values, const uint8_t count)
+{
+    return set_list(voltages, voltage_count, values, count);
+}
+
+bool RidenSequencer::set_currents(const float *values, const uint8_t count)
+{
+    return set_list(currents, current_count, values, count);
+}
+
+bool RidenSequencer::set_dwells(const float *seconds, const uint8_t count)
+{
+    return set_list(dwells, dwell_count, seconds, count);
+}
+
+uint8_t RidenSequencer::get_voltages(const float *&values)
+{
+    values = voltages;
+    return voltage_count;
+}
+
+uint8_t RidenSequencer::get_currents(const float *&values)
+{
+    values = currents;
+    return current_count;
+}
+
+uint8_t RidenSequencer::get_dwells(const float *&seconds)
+{
+    seconds = dwells;
+    return dwell_count;
+}
+
+bool RidenSequencer::set_count(const uint16_t count)
+{
+    if (state != SequenceState::Idle) {
+        return false;
+    }
+    this->count = count;
+    return true;
+}
+
+bool RidenSequencer::set_step_auto(const bool step_auto)
+{
+    if (state != SequenceState::Idle) {
+        return false;
+    }
+    this->step_auto = step_auto;
+    return true;
+}
+
+bool RidenSequencer::initiate()
+{
+    if (state != SequenceState::Idle) {
+        return false;
+    }
+    uint8_t length = get_length();
+    if (length == 0 || (voltage_count == 0 && current_count == 0) || (step_auto && dwell_count == 0)) {
+        return false;
+    }
+    // Every list must either hold a value per step or a single value
+    for (uint8_t list_count : {voltage_count, current_count, dwell_count}) {
+        if (list_count > 1 && list_count != length) {
+            return false;
+        }
+    }
+    LOG_F("RidenSequencer: armed with %u steps\n", length);
+    state = SequenceState::Armed;
+    step = 0;
+    return true;
+}
+
+bool RidenSequencer::trigger()
+{
+    switch (state) {
+    case SequenceState::Armed:
+        state = SequenceState::Running;
+        step = 0;
+        repetition = 0;
+        apply_pending = true;
+        step_started_at = millis();
+        return true;
+    case SequenceState::Running:
+        if (step_auto) {
+            return false;
+        }
+        advance();
+        step_started_at = millis();
+        return true;
+    default:
+        return false;
+    }
+}
+
+void RidenSequencer::abort()
+{
+    state = SequenceState::Idle;
+    step = 0;
+    apply_pending = false;
+}
+
+void RidenSequencer::loop(RidenModbus &ridenModbus)
+{
+    if (state != SequenceState::Running) {
+        return;
+    }
+
+    if (apply_pending) {
+        apply_pending = false;
+        uint8_t voltage_index = (voltage_count == 1) ? 0 : step;
+        uint8_t current_index = (current_count == 1) ? 0 : step;
+        bool success;
+        if (voltage_count > 0 && current_count > 0) {
+            success = ridenModbus.set_voltage_and_current_set(voltages[voltage_index], currents[current_index]);
+        } else if (voltage_count > 0) {
+            success = ridenModbus.set_voltage_set(voltages[voltage_index]);
+        } else {
+            success = ridenModbus.set_current_set(currents[current_index]);
+        }
+        if (!success) {
+            LOG_F("RidenSequencer: failed applying step %u\n", step);
+        }
+    }
+
+    unsigned long dwell = dwell_ms(step);
+    if (step_auto && millis() - step_started_at >= dwell) {
+        // Advance from the planned start, so delays do not accumulate
+        step_started_at += dwell;
+        advance();
+    }
+}
+
+uint8_t RidenSequencer::get_length()
+{
+    return max(voltage_count, max(current_count, dwell_count));
+}
+
+bool RidenSequencer::set_list(float *list, uint8_t &list_count, const float *values, const uint8_t count)
+{
+    if (state != SequenceState::Idle || count > SEQUENCE_MAX_STEPS) {
+        return false;
+    }
+    memcpy(list, values, count * sizeof(float));
+    list_count = count;
+    return true;
+}
+
+void RidenSequencer::advance()
+{
+    step++;
+    if (step >= get_length()) {
+        step = 0;
+        repetition++;
+        if (count != 0 && repetition >= count) {
+            LOG_LN("RidenSequencer: done");
+            state = SequenceState::Idle;
+            return;
+        }
+    }
+    apply_pending = true;
+}
+
+unsigned long RidenSequencer::dwell_ms(const uint8_t step)
+{
+    if (dwell_count == 0) {
+        return 0;
+    }
+    return lround(dwells[(dwell_count == 1) ? 0 : step] * 1000.0f);
+}
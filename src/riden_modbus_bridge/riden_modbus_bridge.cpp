@@ -2,9 +2,11 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <riden_config/riden_config.h>
 #include <riden_logging/riden_logging.h>
 #include <riden_modbus_bridge/riden_modbus_bridge.h>
 
+#include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 
 using namespace RidenDongle;
@@ -17,6 +19,18 @@ static RidenModbusBridge *one_and_only = nullptr;
 static Modbus::ResultCode modbus_tcp_raw_callback(uint8_t *data, uint8_t len, void *custom_data);
 static Modbus::ResultCode modbus_rtu_raw_callback(uint8_t *data, uint8_t len, void *custom);
 
+static uint16_t modbus_crc16(const uint8_t *data, uint16_t len)
+{
+    uint16_t crc = 0xffff;
+    for (uint16_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xa001 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
 bool RidenModbusBridge::begin()
 {
     if (initialized) {
@@ -37,6 +51,18 @@ bool RidenModbusBridge::begin()
         MDNS.addServiceTxt(modbus_service, "unitid", MODBUS_ADDRESS);
     }
 
+    rtu_over_tcp_listen_port = riden_config.get_modbus_rtu_over_tcp_port();
+    if (rtu_over_tcp_listen_port != 0) {
+        LOG_F("RidenModbusBridge: Modbus RTU over TCP on port %u\r\n", rtu_over_tcp_listen_port);
+        rtu_over_tcp_server.begin(rtu_over_tcp_listen_port);
+        rtu_over_tcp_server.setNoDelay(true);
+    }
+    udp_listen_port = riden_config.get_modbus_udp_port();
+    if (udp_listen_port != 0) {
+        LOG_F("RidenModbusBridge: Modbus UDP on port %u\r\n", udp_listen_port);
+        udp.begin(udp_listen_port);
+    }
+
     LOG_LN("RidenModbusBridge initialized");
 
     one_and_only = this;
@@ -47,6 +73,18 @@ bool RidenModbusBridge::begin()
 bool RidenModbusBridge::loop()
 {
     modbus_tcp.task();
+#ifndef MOCK_RIDEN
+    if (rtu_over_tcp_listen_port != 0) {
+        accept_rtu_over_tcp_clients();
+        receive_rtu_over_tcp();
+    }
+    if (udp_listen_port != 0) {
+        receive_udp();
+    }
+#endif
+    check_active_request();
+    serve_locally();
+    dispatch_next_request();
     return true;
 }
 
@@ -55,19 +93,52 @@ uint16_t RidenModbusBridge::port()
     return MODBUSTCP_PORT;
 }
 
+uint16_t RidenModbusBridge::rtu_over_tcp_port()
+{
+    return rtu_over_tcp_listen_port;
+}
+
+uint16_t RidenModbusBridge::udp_port()
+{
+    return udp_listen_port;
+}
+
 std::list<IPAddress> RidenModbusBridge::get_connected_clients()
 {
     return modbus_tcp.get_connected_clients();
 }
 
+std::list<IPAddress> RidenModbusBridge::get_connected_rtu_over_tcp_clients()
+{
+    std::list<IPAddress> connected_clients;
+    for (int i = 0; i < MODBUS_RTU_OVER_TCP_MAX_CLIENTS; i++) {
+        if (rtu_over_tcp_clients[i].client.connected()) {
+            connected_clients.push_back(rtu_over_tcp_clients[i].client.remoteIP());
+        }
+    }
+    return connected_clients;
+}
+
 void RidenModbusBridge::disconnect_client(const IPAddress &ip)
 {
     LOG_LN("RidenModbusBridge::disconnect_client");
     modbus_tcp.disconnect_client(ip);
+    for (int8_t i = 0; i < MODBUS_RTU_OVER_TCP_MAX_CLIENTS; i++) {
+        if (rtu_over_tcp_clients[i].client.connected() && rtu_over_tcp_clients[i].client.remoteIP() == ip) {
+            close_rtu_over_tcp_client(i);
+        }
+    }
+
+    // Drop anything the client is still waiting for
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        if (queue[i].used && queue[i].ip == uint32_t(ip) && i != active) {
+            release_request(i);
+        }
+    }
 }
 
 /**
- * Data received from the TCP-end is forwarded to ModbusRTU,
+ * Data received from the TCP-end is queued for ModbusRTU,
  * which in turn forwards it to the power supply.
  */
 Modbus::ResultCode RidenModbusBridge::modbus_tcp_raw_callback(uint8_t *data, uint8_t len, void *custom_data)
@@ -75,27 +146,21 @@ Modbus::ResultCode RidenModbusBridge::modbus_tcp_raw_callback(uint8_t *data, uin
     if (!initialized) {
         return Modbus::EX_GENERAL_FAILURE;
     }
-    // Wait until no transaction is active
 #ifdef MOCK_RIDEN
     return Modbus::EX_SUCCESS;
 #else
-    while (riden_modbus.modbus.server()) {
-        delay(1);
-        riden_modbus.modbus.task();
-    }
-
     Modbus::frame_arg_t *source = (Modbus::frame_arg_t *)custom_data;
-    if (!riden_modbus.modbus.rawRequest(source->slaveId, data, len)) {
-        // Inform TCP-end that processing failed
-        modbus_tcp.errorResponce(source->slaveId, (Modbus::FunctionCode)data[0], Modbus::EX_DEVICE_FAILED_TO_RESPOND);
-        return Modbus::EX_DEVICE_FAILED_TO_RESPOND; // Stop ModbusTCP from processing the data
+    BridgeRequest origin;
+    origin.source = BridgeSource::ModbusTCP;
+    origin.ip = source->ipaddr;
+    origin.transaction_id = source->transactionId;
+    origin.slave_id = source->slaveId;
+    origin.data[0] = data[0];
+    if (!enqueue(origin, data, len)) {
+        // Inform TCP-end that we cannot take any more requests right now
+        send_error(origin, Modbus::EX_SLAVE_DEVICE_BUSY);
+        return Modbus::EX_SLAVE_DEVICE_BUSY; // Stop ModbusTCP from processing the data
     }
-
-    // Set up ourself for forwarding the response to our ModbusTCP instance.
-    transaction_id = source->transactionId;
-    slave_id = source->slaveId;
-    ip = source->ipaddr;
-    riden_modbus.modbus.onRaw(::modbus_rtu_raw_callback);
     return Modbus::EX_SUCCESS; // Stops ModbusTCP from processing the data
 #endif
 }
@@ -112,26 +177,663 @@ Modbus::ResultCode RidenModbusBridge::modbus_rtu_raw_callback(uint8_t *data, uin
 #ifdef MOCK_RIDEN
     return Modbus::EX_SUCCESS;
 #else
+    const Modbus::frame_arg_t *source = static_cast<Modbus::frame_arg_t *>(custom);
+    if (source->to_server || active < 0) {
+        return Modbus::EX_PASSTHROUGH;
+    }
 
     // Stop intercepting raw data
     riden_modbus.modbus.onRaw(nullptr);
+    awaiting_response = false;
+    riden_modbus.record_transaction(dispatched_at, true);
 
-    const Modbus::frame_arg_t *source = static_cast<Modbus::frame_arg_t *>(custom);
-    if (!source->to_server) {
-        modbus_tcp.setTransactionId(transaction_id);
-        modbus_tcp.rawResponce(ip, data, len, slave_id);
-    } else {
-        return Modbus::EX_PASSTHROUGH;
+    const BridgeRequest &request = queue[active];
+    if (needs_split(request)) {
+        if (!collect_split_read(data, len)) {
+            // More parts to read, the next one is sent from loop()
+            return Modbus::EX_SUCCESS;
+        }
+        if (split_received == ((request.data[3] << 8) | request.data[4])) {
+            // Respond with the reassembled registers instead
+            data = split_response;
+            len = 2 + split_response[1];
+        }
     }
+    update_cache(request, data, len);
+    send_response(request, data, len);
 
-    // Clear state
-    transaction_id = 0;
-    slave_id = 0;
-    ip = 0;
+    release_request(active);
+    active = -1;
     return Modbus::EX_SUCCESS; // Stops ModbusRTU from processing the data
 #endif
 }
 
+bool RidenModbusBridge::enqueue(const BridgeRequest &origin, const uint8_t *data, uint8_t len)
+{
+    if (len == 0 || len > MODBUS_BRIDGE_MAX_PDU_LENGTH) {
+        return false;
+    }
+    RidenScheduler &scheduler = riden_modbus.get_scheduler();
+    scheduler.record_request(TrafficClass::Modbus, origin.ip);
+
+    int8_t free_index = -1;
+    int pending = 0;
+    uint32_t turn = current_turn;
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        if (!queue[i].used) {
+            if (free_index < 0) {
+                free_index = i;
+            }
+        } else if (queue[i].ip == origin.ip) {
+            // Line up behind the client's own pending requests
+            pending++;
+            turn = max(turn, queue[i].turn + 1);
+        }
+    }
+    if (free_index < 0 || pending >= MODBUS_BRIDGE_CLIENT_QUEUE_DEPTH) {
+        LOG_LN("RidenModbusBridge: queue full");
+        scheduler.record_throttled(TrafficClass::Modbus, origin.ip);
+        return false;
+    }
+
+    BridgeRequest &request = queue[free_index];
+    request.used = true;
+    request.sequence = next_sequence++;
+    request.turn = turn;
+    request.source = origin.source;
+    request.ip = origin.ip;
+    request.port = origin.port;
+    request.client = origin.client;
+    request.transaction_id = origin.transaction_id;
+    request.received_at = millis();
+    request.throttled = false;
+    request.slave_id = origin.slave_id;
+    request.len = len;
+    memcpy(request.data, data, len);
+    return true;
+}
+
+/**
+ * Pick the request with the lowest turn, i.e. the next client in
+ * round-robin order, breaking ties by order of arrival. Clients that
+ * exceed their rate limit must wait.
+ */
+int8_t RidenModbusBridge::next_request()
+{
+    RidenScheduler &scheduler = riden_modbus.get_scheduler();
+    int8_t next = -1;
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        if (!queue[i].used || i == active) {
+            continue;
+        }
+        if (!scheduler.within_rate(TrafficClass::Modbus, queue[i].ip)) {
+            if (!queue[i].throttled) {
+                scheduler.record_throttled(TrafficClass::Modbus, queue[i].ip);
+                queue[i].throttled = true;
+            }
+            continue;
+        }
+        if (next < 0 ||
+            queue[i].turn < queue[next].turn ||
+            (queue[i].turn == queue[next].turn && queue[i].sequence < queue[next].sequence)) {
+            next = i;
+        }
+    }
+    return next;
+}
+
+/**
+ * Answer requests that can be served without involving the power supply.
+ */
+void RidenModbusBridge::serve_locally()
+{
+#ifndef MOCK_RIDEN
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        const BridgeRequest &request = queue[i];
+        if (!request.used || i == active || request.slave_id != MODBUS_ADDRESS) {
+            continue;
+        }
+        // Responses must reach each client in the order it sent the requests
+        if (!is_first_pending(i)) {
+            continue;
+        }
+        if (serve_virtual_registers(request) || serve_from_cache(request)) {
+            release_request(i);
+        }
+    }
+#endif
+}
+
+/**
+ * Virtual registers live in dongle RAM. Reads are answered right away,
+ * and as they cannot be written any write is rejected.
+ */
+bool RidenModbusBridge::serve_virtual_registers(const BridgeRequest &request)
+{
+    if (request.len < 5) {
+        return false;
+    }
+    uint8_t function = request.data[0];
+    uint16_t offset = (request.data[1] << 8) | request.data[2];
+    if (offset < VIRTUAL_REGISTER_FIRST) {
+        return false;
+    }
+    if (function == Modbus::FC_WRITE_REG || function == Modbus::FC_WRITE_REGS) {
+        send_error(request, Modbus::EX_ILLEGAL_ADDRESS);
+        return true;
+    }
+    if (request.len != 5 || (function != Modbus::FC_READ_REGS && function != Modbus::FC_READ_INPUT_REGS)) {
+        return false;
+    }
+    uint16_t numregs = (request.data[3] << 8) | request.data[4];
+    if (numregs == 0 || uint32_t(offset) + numregs > +VirtualRegister::END) {
+        send_error(request, Modbus::EX_ILLEGAL_ADDRESS);
+        return true;
+    }
+
+    uint16_t values[VIRTUAL_REGISTER_COUNT];
+    read_virtual_registers(values);
+    send_registers(request, &values[offset - VIRTUAL_REGISTER_FIRST], numregs);
+    return true;
+}
+
+void RidenModbusBridge::read_virtual_registers(uint16_t *values)
+{
+    auto reg = [values](VirtualRegister r) -> uint16_t & {
+        return values[+r - VIRTUAL_REGISTER_FIRST];
+    };
+    auto put32 = [values](VirtualRegister high, uint32_t value) {
+        values[+high - VIRTUAL_REGISTER_FIRST] = value >> 16;
+        values[+high - VIRTUAL_REGISTER_FIRST + 1] = value & 0xffff;
+    };
+
+    put32(VirtualRegister::Uptime_H, millis() / 1000);
+    reg(VirtualRegister::WiFiRSSI) = uint16_t(int16_t(WiFi.RSSI()));
+    put32(VirtualRegister::FreeHeap_H, ESP.getFreeHeap());
+
+    ModbusStatistics &statistics = riden_modbus.get_statistics();
+    put32(VirtualRegister::Transactions_H, statistics.transactions);
+    put32(VirtualRegister::Failures_H, statistics.failures);
+    reg(VirtualRegister::LatencyLast) = statistics.last_latency;
+    reg(VirtualRegister::LatencyMin) = statistics.min_latency;
+    reg(VirtualRegister::LatencyMax) = statistics.max_latency;
+    reg(VirtualRegister::LatencyAverage) = statistics.average_latency();
+
+    SampleLog &sample_log = riden_modbus.get_sample_log();
+    SampleAverages averages = sample_log.get_averages();
+    reg(VirtualRegister::AverageSamples) = averages.count;
+    put32(VirtualRegister::AverageVoltage_H, averages.voltage * 1e6);
+    put32(VirtualRegister::AverageCurrent_H, averages.current * 1e6);
+    put32(VirtualRegister::AveragePower_H, averages.power * 1e6);
+
+    uint64_t energy = sample_log.get_energy() / 3600.0 * 1e6; // Ws to µWh
+    put32(VirtualRegister::Energy_3, energy >> 32);
+    put32(VirtualRegister::Energy_1, energy & 0xffffffff);
+
+    RidenSequencer &sequencer = riden_modbus.get_sequencer();
+    reg(VirtualRegister::SequenceState) = +sequencer.get_state();
+    reg(VirtualRegister::SequenceStep) = sequencer.get_step();
+
+    reg(VirtualRegister::SampleLogFill) = sample_log.size();
+    reg(VirtualRegister::SampleLogCapacity) = sample_log.capacity();
+}
+
+/**
+ * Answer holding register reads that the register cache can satisfy.
+ */
+bool RidenModbusBridge::serve_from_cache(const BridgeRequest &request)
+{
+    uint32_t max_age = riden_config.get_modbus_cache_max_age();
+    if (max_age == 0 || request.len != 5 || request.data[0] != Modbus::FC_READ_REGS) {
+        return false;
+    }
+    uint16_t offset = (request.data[1] << 8) | request.data[2];
+    uint16_t numregs = (request.data[3] << 8) | request.data[4];
+    if (numregs == 0 || numregs > MODBUS_MAX_REGISTERS_PER_RESPONSE) {
+        return false;
+    }
+    uint16_t values[MODBUS_MAX_REGISTERS_PER_RESPONSE];
+    if (!riden_modbus.read_cached_holding_registers(offset, values, numregs, max_age)) {
+        return false;
+    }
+    send_registers(request, values, numregs);
+    return true;
+}
+
+void RidenModbusBridge::send_registers(const BridgeRequest &request, const uint16_t *values, uint16_t numregs)
+{
+    uint8_t response[2 + 2 * MODBUS_MAX_REGISTERS_PER_RESPONSE];
+    response[0] = request.data[0];
+    response[1] = 2 * numregs;
+    for (uint16_t r = 0; r < numregs; r++) {
+        response[2 + 2 * r] = values[r] >> 8;
+        response[3 + 2 * r] = values[r] & 0xff;
+    }
+    send_response(request, response, 2 + 2 * numregs);
+}
+
+bool RidenModbusBridge::is_first_pending(int8_t index)
+{
+    const BridgeRequest &request = queue[index];
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        if (queue[i].used && queue[i].ip == request.ip && queue[i].sequence < request.sequence) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Keep the register cache in step with whatever the client read from
+ * or wrote to the power supply.
+ */
+void RidenModbusBridge::update_cache(const BridgeRequest &request, const uint8_t *data, uint8_t len)
+{
+    if (request.slave_id != MODBUS_ADDRESS || len == 0 || data[0] != request.data[0]) {
+        // Exception response or some other device
+        return;
+    }
+    uint16_t offset = (request.data[1] << 8) | request.data[2];
+    switch (request.data[0]) {
+    case Modbus::FC_READ_REGS: {
+        if (len < 2 || data[1] % 2 != 0 || len < 2 + data[1]) {
+            return;
+        }
+        uint16_t numregs = data[1] / 2;
+        uint16_t values[MODBUS_MAX_REGISTERS_PER_RESPONSE];
+        for (uint16_t r = 0; r < numregs && r < MODBUS_MAX_REGISTERS_PER_RESPONSE; r++) {
+            values[r] = (data[2 + 2 * r] << 8) | data[3 + 2 * r];
+        }
+        riden_modbus.update_cached_holding_registers(offset, values, min(numregs, uint16_t(MODBUS_MAX_REGISTERS_PER_RESPONSE)));
+        break;
+    }
+    case Modbus::FC_WRITE_REG: {
+        if (request.len < 5) {
+            return;
+        }
+        uint16_t value = (request.data[3] << 8) | request.data[4];
+        riden_modbus.update_cached_holding_registers(offset, &value, 1);
+        break;
+    }
+    case Modbus::FC_WRITE_REGS: {
+        if (request.len < 6) {
+            return;
+        }
+        uint16_t numregs = (request.data[3] << 8) | request.data[4];
+        if (numregs > MODBUS_MAX_REGISTERS_PER_RESPONSE || request.len < 6 + 2 * numregs) {
+            riden_modbus.invalidate_cached_holding_registers();
+            return;
+        }
+        uint16_t values[MODBUS_MAX_REGISTERS_PER_RESPONSE];
+        for (uint16_t r = 0; r < numregs; r++) {
+            values[r] = (request.data[6 + 2 * r] << 8) | request.data[7 + 2 * r];
+        }
+        riden_modbus.update_cached_holding_registers(offset, values, numregs);
+        break;
+    }
+    case Modbus::FC_READ_COILS:
+    case Modbus::FC_READ_INPUT_STAT:
+    case Modbus::FC_READ_INPUT_REGS:
+        break;
+    default:
+        // Anything else may have changed registers behind our back
+        riden_modbus.invalidate_cached_holding_registers();
+        break;
+    }
+}
+
+void RidenModbusBridge::dispatch_next_request()
+{
+#ifndef MOCK_RIDEN
+    // Only one request can be outstanding on the RTU-end
+    if (awaiting_response || riden_modbus.modbus.server()) {
+        return;
+    }
+    if (active >= 0) {
+        // Next part of a split read
+        dispatch_split_read();
+        return;
+    }
+    RidenScheduler &scheduler = riden_modbus.get_scheduler();
+    int8_t index = next_request();
+    scheduler.set_backlogged(TrafficClass::Modbus, index >= 0);
+    if (index < 0 || !scheduler.within_share(TrafficClass::Modbus)) {
+        return;
+    }
+
+    BridgeRequest &request = queue[index];
+    current_turn = request.turn;
+    scheduler.admit(TrafficClass::Modbus, request.ip);
+    if (needs_split(request)) {
+        active = index;
+        split_received = 0;
+        split_response[0] = request.data[0];
+        split_response[1] = 0;
+        dispatch_split_read();
+        return;
+    }
+    dispatched_at = millis();
+    if (!riden_modbus.modbus.rawRequest(request.slave_id, request.data, request.len)) {
+        // Inform TCP-end that processing failed
+        send_error(request, Modbus::EX_DEVICE_FAILED_TO_RESPOND);
+        release_request(index);
+        return;
+    }
+    if (request.slave_id == 0) {
+        // Broadcast, no response is expected from the power supply
+        if (request.source != BridgeSource::RtuOverTcp) {
+            send_error(request, Modbus::EX_ACKNOWLEDGE);
+        }
+        release_request(index);
+        return;
+    }
+
+    // Set up ourself for forwarding the response to our ModbusTCP instance.
+    active = index;
+    awaiting_response = true;
+    riden_modbus.modbus.onRaw(::modbus_rtu_raw_callback);
+#endif
+}
+
+/**
+ * Register reads larger than the power supply can handle are split
+ * into several reads and reassembled before responding.
+ */
+bool RidenModbusBridge::needs_split(const BridgeRequest &request)
+{
+    if (request.len != 5 || request.slave_id == 0 ||
+        (request.data[0] != Modbus::FC_READ_REGS && request.data[0] != Modbus::FC_READ_INPUT_REGS)) {
+        return false;
+    }
+    uint16_t numregs = (request.data[3] << 8) | request.data[4];
+    return numregs > RIDEN_MAX_REGISTERS_PER_READ && numregs <= MODBUS_MAX_REGISTERS_PER_RESPONSE;
+}
+
+void RidenModbusBridge::dispatch_split_read()
+{
+#ifndef MOCK_RIDEN
+    BridgeRequest &request = queue[active];
+    uint16_t offset = ((request.data[1] << 8) | request.data[2]) + split_received;
+    uint16_t numregs = (request.data[3] << 8) | request.data[4];
+    uint16_t regs_to_read = min(uint16_t(RIDEN_MAX_REGISTERS_PER_READ), uint16_t(numregs - split_received));
+
+    uint8_t data[5] = {request.data[0],
+                       uint8_t(offset >> 8), uint8_t(offset & 0xff),
+                       uint8_t(regs_to_read >> 8), uint8_t(regs_to_read & 0xff)};
+    dispatched_at = millis();
+    if (!riden_modbus.modbus.rawRequest(request.slave_id, data, sizeof(data))) {
+        send_error(request, Modbus::EX_DEVICE_FAILED_TO_RESPOND);
+        release_request(active);
+        active = -1;
+        return;
+    }
+    awaiting_response = true;
+    riden_modbus.modbus.onRaw(::modbus_rtu_raw_callback);
+#endif
+}
+
+/**
+ * Append the response to one part of a split read.
+ *
+ * @return true when the split read is complete or failed, i.e. when
+ *         the client must be answered.
+ */
+bool RidenModbusBridge::collect_split_read(const uint8_t *data, uint8_t len)
+{
+    const BridgeRequest &request = queue[active];
+    uint16_t numregs = (request.data[3] << 8) | request.data[4];
+    uint16_t expected = min(uint16_t(RIDEN_MAX_REGISTERS_PER_READ), uint16_t(numregs - split_received));
+    if (len < 2 || data[0] != request.data[0] || data[1] != 2 * expected || len < 2 + data[1]) {
+        // Exception or malformed response, pass it on as is
+        return true;
+    }
+    memcpy(&split_response[2 + 2 * split_received], &data[2], data[1]);
+    split_received += expected;
+    split_response[1] = 2 * split_received;
+    return split_received >= numregs;
+}
+
+/**
+ * ModbusRTU ends the transaction on its own if the power supply does
+ * not respond in time, in which case the response callback never fires.
+ */
+void RidenModbusBridge::check_active_request()
+{
+#ifndef MOCK_RIDEN
+    if (!awaiting_response || riden_modbus.modbus.server()) {
+        return;
+    }
+    LOG_LN("RidenModbusBridge: no response from power supply");
+    riden_modbus.modbus.onRaw(nullptr);
+    awaiting_response = false;
+    riden_modbus.record_transaction(dispatched_at, false);
+    send_error(queue[active], Modbus::EX_DEVICE_FAILED_TO_RESPOND);
+    release_request(active);
+    active = -1;
+#endif
+}
+
+void RidenModbusBridge::release_request(int8_t index)
+{
+    queue[index].used = false;
+}
+
+void RidenModbusBridge::send_response(const BridgeRequest &request, uint8_t *data, uint8_t len)
+{
+    if (request.used) {
+        riden_modbus.get_scheduler().record_latency(TrafficClass::Modbus, request.ip, request.received_at);
+    }
+    switch (request.source) {
+    case BridgeSource::ModbusTCP:
+        modbus_tcp.setTransactionId(request.transaction_id);
+        modbus_tcp.rawResponce(IPAddress(request.ip), data, len, request.slave_id);
+        break;
+    case BridgeSource::RtuOverTcp: {
+        if (request.client < 0) {
+            // The client has gone away
+            return;
+        }
+        uint8_t frame[MODBUS_RTU_MAX_FRAME_LENGTH];
+        frame[0] = request.slave_id;
+        memcpy(&frame[1], data, len);
+        uint16_t crc = modbus_crc16(frame, len + 1);
+        frame[len + 1] = crc & 0xff;
+        frame[len + 2] = crc >> 8;
+        rtu_over_tcp_clients[request.client].client.write(frame, len + 3);
+        break;
+    }
+    case BridgeSource::Udp: {
+        uint8_t header[7] = {uint8_t(request.transaction_id >> 8), uint8_t(request.transaction_id & 0xff),
+                             0, 0, // Protocol identifier
+                             uint8_t((len + 1) >> 8), uint8_t((len + 1) & 0xff),
+                             request.slave_id};
+        udp.beginPacket(IPAddress(request.ip), request.port);
+        udp.write(header, sizeof(header));
+        udp.write(data, len);
+        udp.endPacket();
+        break;
+    }
+    }
+}
+
+void RidenModbusBridge::send_error(const BridgeRequest &request, Modbus::ResultCode code)
+{
+    if (request.source == BridgeSource::ModbusTCP) {
+        if (request.used) {
+            riden_modbus.get_scheduler().record_latency(TrafficClass::Modbus, request.ip, request.received_at);
+        }
+        modbus_tcp.setTransactionId(request.transaction_id);
+        modbus_tcp.errorResponce(IPAddress(request.ip), (Modbus::FunctionCode)request.data[0], code, request.slave_id);
+        return;
+    }
+    uint8_t response[2] = {uint8_t(request.data[0] | 0x80), uint8_t(code)};
+    send_response(request, response, sizeof(response));
+}
+
+void RidenModbusBridge::accept_rtu_over_tcp_clients()
+{
+    if (!rtu_over_tcp_server.hasClient()) {
+        return;
+    }
+    WiFiClient client = rtu_over_tcp_server.accept();
+    for (int8_t i = 0; i < MODBUS_RTU_OVER_TCP_MAX_CLIENTS; i++) {
+        if (!rtu_over_tcp_clients[i].client.connected()) {
+            close_rtu_over_tcp_client(i);
+            LOG_F("RidenModbusBridge: RTU over TCP client %s connected\r\n", client.remoteIP().toString().c_str());
+            rtu_over_tcp_clients[i].client = client;
+            rtu_over_tcp_clients[i].client.setNoDelay(true);
+            return;
+        }
+    }
+    LOG_LN("RidenModbusBridge: too many RTU over TCP clients");
+    client.stop();
+}
+
+void RidenModbusBridge::close_rtu_over_tcp_client(int8_t index)
+{
+    RtuOverTcpClient &connection = rtu_over_tcp_clients[index];
+    connection.client.stop();
+    connection.client = WiFiClient();
+    connection.len = 0;
+
+    // Nobody is waiting for responses on this connection anymore
+    for (int8_t i = 0; i < MODBUS_BRIDGE_QUEUE_SIZE; i++) {
+        if (queue[i].used && queue[i].source == BridgeSource::RtuOverTcp && queue[i].client == index) {
+            if (i == active) {
+                queue[i].client = -1;
+            } else {
+                release_request(i);
+            }
+        }
+    }
+}
+
+void RidenModbusBridge::receive_rtu_over_tcp()
+{
+    for (int8_t i = 0; i < MODBUS_RTU_OVER_TCP_MAX_CLIENTS; i++) {
+        RtuOverTcpClient &connection = rtu_over_tcp_clients[i];
+        if (!connection.client.connected()) {
+            if (connection.client) {
+                close_rtu_over_tcp_client(i);
+            }
+            continue;
+        }
+        int available = connection.client.available();
+        if (available > 0) {
+            size_t space = MODBUS_RTU_MAX_FRAME_LENGTH - connection.len;
+            if (space == 0) {
+                // No valid frame is this long, start over
+                connection.len = 0;
+                space = MODBUS_RTU_MAX_FRAME_LENGTH;
+            }
+            connection.len += connection.client.read(&connection.buffer[connection.len], min(size_t(available), space));
+            connection.last_received_at = millis();
+        }
+        receive_rtu_over_tcp_frames(i);
+    }
+}
+
+/**
+ * Extract complete RTU frames from a connection's buffer. The length of
+ * most requests follows from the function code, anything else is
+ * delimited by a gap in the data stream.
+ */
+void RidenModbusBridge::receive_rtu_over_tcp_frames(int8_t index)
+{
+    RtuOverTcpClient &connection = rtu_over_tcp_clients[index];
+    while (connection.len >= 4) {
+        const uint8_t *buffer = connection.buffer;
+        uint16_t frame_len = 0;
+        switch (buffer[1]) {
+        case Modbus::FC_READ_COILS:
+        case Modbus::FC_READ_INPUT_STAT:
+        case Modbus::FC_READ_REGS:
+        case Modbus::FC_READ_INPUT_REGS:
+        case Modbus::FC_WRITE_COIL:
+        case Modbus::FC_WRITE_REG:
+        case Modbus::FC_DIAGNOSTICS:
+            frame_len = 8;
+            break;
+        case Modbus::FC_WRITE_COILS:
+        case Modbus::FC_WRITE_REGS:
+            if (connection.len >= 7) {
+                frame_len = 9 + buffer[6];
+            }
+            break;
+        case Modbus::FC_READWRITE_REGS:
+            if (connection.len >= 11) {
+                frame_len = 13 + buffer[10];
+            }
+            break;
+        }
+        bool gap = millis() - connection.last_received_at >= MODBUS_RTU_FRAME_GAP;
+        if (frame_len == 0 || frame_len > connection.len) {
+            if (!gap) {
+                // Wait for the rest of the frame
+                return;
+            }
+            // Whatever arrived before the gap is the frame
+            frame_len = connection.len;
+        }
+
+        uint16_t crc = modbus_crc16(buffer, frame_len - 2);
+        if (buffer[frame_len - 2] == (crc & 0xff) && buffer[frame_len - 1] == (crc >> 8)) {
+            BridgeRequest origin;
+            origin.source = BridgeSource::RtuOverTcp;
+            origin.ip = connection.client.remoteIP();
+            origin.client = index;
+            origin.slave_id = buffer[0];
+            origin.data[0] = buffer[1];
+            if (!enqueue(origin, &buffer[1], frame_len - 3)) {
+                send_error(origin, Modbus::EX_SLAVE_DEVICE_BUSY);
+            }
+        } else {
+            // Like a real device, ignore frames with a bad checksum
+            LOG_LN("RidenModbusBridge: RTU over TCP CRC error");
+        }
+
+        connection.len -= frame_len;
+        memmove(connection.buffer, &connection.buffer[frame_len], connection.len);
+    }
+    if (connection.len > 0 && millis() - connection.last_received_at >= MODBUS_RTU_FRAME_GAP) {
+        // Too short to be a frame
+        connection.len = 0;
+    }
+}
+
+void RidenModbusBridge::receive_udp()
+{
+    for (int packets = 0; packets < MODBUS_BRIDGE_QUEUE_SIZE; packets++) {
+        int size = udp.parsePacket();
+        if (size <= 0) {
+            return;
+        }
+        uint8_t packet[MODBUS_UDP_MAX_PACKET_LENGTH];
+        int len = udp.read(packet, sizeof(packet));
+        if (len != size || len < 8) {
+            LOG_LN("RidenModbusBridge: invalid Modbus UDP packet");
+            continue;
+        }
+        uint16_t protocol = (packet[2] << 8) | packet[3];
+        uint16_t length = (packet[4] << 8) | packet[5];
+        if (protocol != 0 || length != len - 6) {
+            LOG_LN("RidenModbusBridge: invalid Modbus UDP packet");
+            continue;
+        }
+
+        BridgeRequest origin;
+        origin.source = BridgeSource::Udp;
+        origin.ip = udp.remoteIP();
+        origin.port = udp.remotePort();
+        origin.transaction_id = (packet[0] << 8) | packet[1];
+        origin.slave_id = packet[6];
+        origin.data[0] = packet[7];
+        if (!enqueue(origin, &packet[7], len - 7)) {
+            send_error(origin, Modbus::EX_SLAVE_DEVICE_BUSY);
+        }
+    }
+}
+
 Modbus::ResultCode modbus_tcp_raw_callback(uint8_t *data, uint8_t len, void *custom_data)
 {
     return one_and_only->modbus_tcp_raw_callback(data, len, custom_data);
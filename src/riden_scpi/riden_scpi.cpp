@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <riden_format/riden_format.h>
 #include <riden_logging/riden_logging.h>
 #include <riden_modbus/riden_modbus.h>
 #include <riden_scpi/riden_scpi.h>
@@ -14,12 +15,13 @@
 // ************
 // This file combines a socket server with an SCPI parser.
 //
-// 3 main different types of socket servers are supported or are potentially possible:
+// 3 main different types of socket servers are supported:
 // 
 // ** RAW socket
 // The default. Requires no special flags.
 // scpi-raw uses a raw TCP connection to send and receive SCPI commands.
-// This FW implementation supports only 1 client.
+// This FW implementation supports up to SCPI_MAX_SESSIONS clients, each with its own
+// input buffer, output buffer and error queue.
 // - Discovery is done via mDNS, and the service name is "scpi-raw" (_scpi-raw._tcp).
 // - The VISA string is like: "TCPIP::<ip address>::5025::SOCKET" (using the default port 5025)
 // - The SCPI commands and responses are sent as plain text, delimited by newline characters.
@@ -50,8 +52,10 @@
 // - The VISA string is like: "TCPIP::<ip address>::hislip0::INSTR" (using the default port 4880)
 // - The SCPI commands and responses are sent as binary data, with a header and a payload.
 // - It requires 2 connections on the same port (async and sync), even if you only use 1
+// - Supports overlapped mode, and sends service requests on the async connection.
 // - is discoverable by pyvisa, and requires no special construction in Python other than installation of zeroconf
-// ==> THE 2 CONNECTIONS MAKE IT NOT EASY TO DO WITHOUT REWRITING MUCH OF riden_scpi.cpp, AND WORK WAS ABANDONED
+// ==> this is in a parallel server, see riden_hislip. Like VXI-11 it uses a session claimed
+//     with claim_external_control(), so both connections share one session.
 
 
 #ifdef MOCK_RIDEN
@@ -60,8 +64,6 @@
 
 using namespace RidenDongle;
 
-// We only support one client
-
 const scpi_command_t RidenScpi::scpi_commands[] = {
     /* IEEE Mandated Commands (SCPI std V1999.0 4.1.1) */
     {"*CLS", SCPI_CoreCls, 0},
@@ -123,6 +125,38 @@ const scpi_command_t RidenScpi::scpi_commands[] = {
     {"MEASure[:SCALar]:CURRent[:DC]?", RidenScpi::MeasureCurrentQ, 0},
     {"MEASure[:SCALar]:POWer[:DC]?", RidenScpi::MeasurePowerQ, 0},
     {"MEASure[:SCALar]:TEMPerature[:THERmistor][:DC]?", RidenScpi::MeasureTemperatureQ, 0},
+    {"MEASure:ALL[:DC]?", RidenScpi::MeasureAllQ, 0},
+    {"MEASure:ALL:EXTended?", RidenScpi::MeasureAllExtendedQ, 0},
+
+    {"FETCh[:SCALar]:VOLTage[:DC]?", RidenScpi::FetchVoltageQ, 0},
+    {"FETCh[:SCALar]:CURRent[:DC]?", RidenScpi::FetchCurrentQ, 0},
+    {"FETCh[:SCALar]:POWer[:DC]?", RidenScpi::FetchPowerQ, 0},
+    {"FETCh[:SCALar]:ALL[:DC]?", RidenScpi::FetchAllQ, 0},
+    {"FETCh:TIMestamp?", RidenScpi::FetchTimestampQ, 0},
+
+    {"FORMat[:DATA]", RidenScpi::FormatData, 0},
+    {"FORMat[:DATA]?", RidenScpi::FormatDataQ, 0},
+    {"FORMat:BORDer?", RidenScpi::FormatBorderQ, 0},
+    {"TRACe[:DATA]?", RidenScpi::TraceDataQ, 0},
+    {"TRACe:POINts?", RidenScpi::TracePointsQ, 0},
+
+    {"LIST:VOLTage[:LEVel]", RidenScpi::ListVoltage, 0},
+    {"LIST:VOLTage[:LEVel]?", RidenScpi::ListVoltageQ, 0},
+    {"LIST:VOLTage:POINts?", RidenScpi::ListVoltagePointsQ, 0},
+    {"LIST:CURRent[:LEVel]", RidenScpi::ListCurrent, 0},
+    {"LIST:CURRent[:LEVel]?", RidenScpi::ListCurrentQ, 0},
+    {"LIST:CURRent:POINts?", RidenScpi::ListCurrentPointsQ, 0},
+    {"LIST:DWELl", RidenScpi::ListDwell, 0},
+    {"LIST:DWELl?", RidenScpi::ListDwellQ, 0},
+    {"LIST:DWELl:POINts?", RidenScpi::ListDwellPointsQ, 0},
+    {"LIST:COUNt", RidenScpi::ListCount, 0},
+    {"LIST:COUNt?", RidenScpi::ListCountQ, 0},
+    {"LIST:STEP", RidenScpi::ListStep, 0},
+    {"LIST:STEP?", RidenScpi::ListStepQ, 0},
+    {"INITiate[:IMMediate]", RidenScpi::Initiate, 0},
+    {"ABORt", RidenScpi::Abort, 0},
+    {"TRIGger[:IMMediate]", RidenScpi::Trigger, 0},
+    {"*TRG", RidenScpi::Trigger, 0},
 
     {"[SOURce]:VOLTage:LIMit", RidenScpi::SourceVoltageLimit, 0},
 
@@ -148,6 +182,28 @@ scpi_choice_def_t language_options[] = {
     SCPI_CHOICE_LIST_END,
 };
 
+scpi_choice_def_t format_options[] = {
+    {.name = "ASCii", .tag = +DataFormat::Ascii},
+    {.name = "REAL", .tag = +DataFormat::Real32},
+    {.name = "INTeger", .tag = +DataFormat::Int32},
+    SCPI_CHOICE_LIST_END,
+};
+
+#define TRACE_ALL 3
+scpi_choice_def_t trace_options[] = {
+    {.name = "VOLTage", .tag = 0},
+    {.name = "CURRent", .tag = 1},
+    {.name = "POWer", .tag = 2},
+    {.name = "ALL", .tag = TRACE_ALL},
+    SCPI_CHOICE_LIST_END,
+};
+
+scpi_choice_def_t list_step_options[] = {
+    {.name = "ONCE", .tag = 0},
+    {.name = "AUTO", .tag = 1},
+    SCPI_CHOICE_LIST_END,
+};
+
 scpi_interface_t RidenScpi::scpi_interface = {
     .error = RidenScpi::SCPI_Error,
     .write = RidenScpi::SCPI_Write,
@@ -168,29 +224,48 @@ size_t SCPI_ResultChoice(scpi_t *context, scpi_choice_def_t *options, int32_t va
 
 size_t RidenScpi::SCPI_Write(scpi_t *context, const char *data, size_t len)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
     LOG_F("SCPI_Write: writing \"%.*s\"\n", (int)len, data);
-    ridenScpi->external_output_ready = false; // don't send half baked data to the client
-    memcpy(&(ridenScpi->write_buffer[ridenScpi->write_buffer_length]), data, len);
-    ridenScpi->write_buffer_length += len;
-    
-    return len;
+    session->output_ready = false; // don't send half baked data to the client
+    size_t written = 0;
+    while (written < len) {
+        size_t part;
+        if (!session->trace.active && session->trailer_length == 0 && session->write_buffer_length < WRITE_BUFFER_LENGTH) {
+            part = min(len - written, WRITE_BUFFER_LENGTH - session->write_buffer_length);
+            memcpy(&(session->write_buffer[session->write_buffer_length]), &data[written], part);
+            session->write_buffer_length += part;
+        } else if (session->trailer_length < SCPI_TRAILER_LENGTH) {
+            // Whatever follows a streamed response or a full buffer waits until produce_output() takes it
+            part = min(len - written, size_t(SCPI_TRAILER_LENGTH - session->trailer_length));
+            memcpy(&session->trailer[session->trailer_length], &data[written], part);
+            session->trailer_length += part;
+        } else if (session->owner->wait_for_output(*session)) {
+            continue;
+        } else {
+            LOG_F("ERROR: RidenScpi output buffer overflow. Truncating response.\n");
+            break;
+        }
+        written += part;
+    }
+
+    return written;
 }
 
 scpi_result_t RidenScpi::SCPI_Flush(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
 
-    if (ridenScpi->external_control) {
+    // The response is complete once the stream and trailer have been produced
+    session->flush_pending = true;
+    session->owner->produce_output(*session);
+    if (session->external) {
         // do not write to the client, let the read function fetch the data
-        ridenScpi->external_output_ready = true;
         return SCPI_RES_OK;
     }
-    LOG_F("SCPI_Flush: sending \"%.*s\"\n", (int)ridenScpi->write_buffer_length, ridenScpi->write_buffer);
-    if (ridenScpi->client) {
-        ridenScpi->client.write(ridenScpi->write_buffer, ridenScpi->write_buffer_length);
-        ridenScpi->write_buffer_length = 0;
-        ridenScpi->client.flush();
+    LOG_F("SCPI_Flush: sending \"%.*s\"\n", (int)session->write_buffer_length, session->write_buffer);
+    if (session->client) {
+        // Whatever the socket cannot take now is sent from loop()
+        session->owner->send_output(*session);
     }
     return SCPI_RES_OK;
 }
@@ -226,14 +301,16 @@ scpi_result_t RidenScpi::SCPI_Control(scpi_t *context, scpi_ctrl_name_t ctrl, sc
 
 scpi_result_t RidenScpi::SCPI_Reset(scpi_t *context)
 {
-    (void)context;
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
+    session->data_format = DataFormat::Ascii;
+    session->owner->ridenModbus.get_sequencer().abort();
     LOG_LN("**Reset");
     return SCPI_RES_OK;
 }
 
 scpi_result_t RidenScpi::Rcl(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint32_t profile;
     if (!SCPI_ParamUnsignedInt(context, &profile, true)) {
@@ -253,7 +330,7 @@ scpi_result_t RidenScpi::Rcl(scpi_t *context)
 
 scpi_result_t RidenScpi::DisplayBrightness(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint32_t brightness;
     if (!SCPI_ParamUnsignedInt(context, &brightness, true)) {
@@ -273,7 +350,7 @@ scpi_result_t RidenScpi::DisplayBrightness(scpi_t *context)
 
 scpi_result_t RidenScpi::DisplayBrightnessQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint8_t brightness;
     if (ridenScpi->ridenModbus.get_brightness(brightness)) {
@@ -287,7 +364,7 @@ scpi_result_t RidenScpi::DisplayBrightnessQ(scpi_t *context)
 
 scpi_result_t RidenScpi::DisplayLanguage(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     int32_t language = -1;
     scpi_parameter_t param;
@@ -315,7 +392,7 @@ scpi_result_t RidenScpi::DisplayLanguage(scpi_t *context)
 
 scpi_result_t RidenScpi::DisplayLanguageQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint16_t language;
     if (ridenScpi->ridenModbus.get_language(language)) {
@@ -329,7 +406,7 @@ scpi_result_t RidenScpi::DisplayLanguageQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemDate(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint32_t year, month, day;
     if (!SCPI_ParamUnsignedInt(context, &year, true) || !SCPI_ParamUnsignedInt(context, &month, true) || !SCPI_ParamUnsignedInt(context, &day, true)) {
@@ -345,7 +422,7 @@ scpi_result_t RidenScpi::SystemDate(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemDateQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     tm clock;
     if (ridenScpi->ridenModbus.get_clock(clock)) {
@@ -363,7 +440,7 @@ scpi_result_t RidenScpi::SystemDateQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemTime(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     uint32_t hour, minute, second;
     if (!SCPI_ParamUnsignedInt(context, &hour, true) || !SCPI_ParamUnsignedInt(context, &minute, true) || !SCPI_ParamUnsignedInt(context, &second, true)) {
@@ -379,7 +456,7 @@ scpi_result_t RidenScpi::SystemTime(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemTimeQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     tm clock;
     if (ridenScpi->ridenModbus.get_clock(clock)) {
@@ -395,7 +472,7 @@ scpi_result_t RidenScpi::SystemTimeQ(scpi_t *context)
 
 scpi_result_t RidenScpi::OutputState(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     bool on;
     if (!SCPI_ParamBool(context, &on, true)) {
@@ -411,7 +488,7 @@ scpi_result_t RidenScpi::OutputState(scpi_t *context)
 
 scpi_result_t RidenScpi::OutputStateQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     bool on;
     if (ridenScpi->ridenModbus.get_output_on(on)) {
@@ -425,7 +502,7 @@ scpi_result_t RidenScpi::OutputStateQ(scpi_t *context)
 
 scpi_result_t RidenScpi::OutputModeQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     OutputMode output_mode;
     if (ridenScpi->ridenModbus.get_output_mode(output_mode)) {
@@ -446,7 +523,7 @@ scpi_result_t RidenScpi::OutputModeQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceVoltage(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     scpi_choice_def_t special;
     scpi_number_t value;
@@ -470,12 +547,12 @@ scpi_result_t RidenScpi::SourceVoltage(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceVoltageQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     double voltage;
 
     if (ridenScpi->ridenModbus.get_voltage_set(voltage)) {
-        SCPI_ResultDouble(context, voltage);
+        ResultFixed(context, voltage, SCPI_VOLTAGE_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -485,7 +562,7 @@ scpi_result_t RidenScpi::SourceVoltageQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceVoltageProtectionTrippedQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     Protection protection;
     if (ridenScpi->ridenModbus.get_protection(protection)) {
@@ -499,7 +576,7 @@ scpi_result_t RidenScpi::SourceVoltageProtectionTrippedQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceCurrent(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     scpi_choice_def_t special;
     scpi_number_t value;
@@ -521,12 +598,12 @@ scpi_result_t RidenScpi::SourceCurrent(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceCurrentQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     double current;
 
     if (ridenScpi->ridenModbus.get_current_set(current)) {
-        SCPI_ResultDouble(context, current);
+        ResultFixed(context, current, SCPI_CURRENT_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -536,7 +613,7 @@ scpi_result_t RidenScpi::SourceCurrentQ(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceCurrentProtectionTrippedQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     Protection protection;
     if (ridenScpi->ridenModbus.get_protection(protection)) {
@@ -550,12 +627,12 @@ scpi_result_t RidenScpi::SourceCurrentProtectionTrippedQ(scpi_t *context)
 
 scpi_result_t RidenScpi::MeasureVoltageQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     double voltage;
 
     if (ridenScpi->ridenModbus.get_voltage_out(voltage)) {
-        SCPI_ResultDouble(context, voltage);
+        ResultFixed(context, voltage, SCPI_VOLTAGE_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -565,12 +642,12 @@ scpi_result_t RidenScpi::MeasureVoltageQ(scpi_t *context)
 
 scpi_result_t RidenScpi::MeasureCurrentQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     double current;
 
     if (ridenScpi->ridenModbus.get_current_out(current)) {
-        SCPI_ResultDouble(context, current);
+        ResultFixed(context, current, SCPI_CURRENT_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -580,12 +657,12 @@ scpi_result_t RidenScpi::MeasureCurrentQ(scpi_t *context)
 
 scpi_result_t RidenScpi::MeasurePowerQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     double power;
 
     if (ridenScpi->ridenModbus.get_power_out(power)) {
-        SCPI_ResultDouble(context, power);
+        ResultFixed(context, power, SCPI_POWER_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -595,7 +672,7 @@ scpi_result_t RidenScpi::MeasurePowerQ(scpi_t *context)
 
 scpi_result_t RidenScpi::MeasureTemperatureQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     int32_t choice;
     if (!SCPI_ParamChoice(context, temperature_options, &choice, TRUE)) {
@@ -610,7 +687,7 @@ scpi_result_t RidenScpi::MeasureTemperatureQ(scpi_t *context)
         success = ridenScpi->ridenModbus.get_probe_temperature_celsius(temperature);
     }
     if (success) {
-        SCPI_ResultDouble(context, temperature);
+        ResultFixed(context, temperature, SCPI_TEMPERATURE_DECIMALS);
         return SCPI_RES_OK;
     } else {
         SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
@@ -618,9 +695,481 @@ scpi_result_t RidenScpi::MeasureTemperatureQ(scpi_t *context)
     }
 }
 
+scpi_result_t RidenScpi::MeasureAllQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Measurements measurements;
+    if (ridenScpi->ridenModbus.get_measurements(measurements)) {
+        ResultFixed(context, measurements.voltage_out, SCPI_VOLTAGE_DECIMALS);
+        ResultFixed(context, measurements.current_out, SCPI_CURRENT_DECIMALS);
+        ResultFixed(context, measurements.power_out, SCPI_POWER_DECIMALS);
+        return SCPI_RES_OK;
+    } else {
+        SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
+        return SCPI_RES_ERR;
+    }
+}
+
+scpi_result_t RidenScpi::MeasureAllExtendedQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    ExtendedMeasurements measurements;
+    if (!ridenScpi->ridenModbus.get_extended_measurements(measurements)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_COMMAND);
+        return SCPI_RES_ERR;
+    }
+    ResultFixed(context, measurements.voltage_out, SCPI_VOLTAGE_DECIMALS);
+    ResultFixed(context, measurements.current_out, SCPI_CURRENT_DECIMALS);
+    ResultFixed(context, measurements.power_out, SCPI_POWER_DECIMALS);
+    switch (measurements.output_mode) {
+    case OutputMode::CONSTANT_VOLTAGE:
+        SCPI_ResultMnemonic(context, "CV");
+        break;
+    case OutputMode::CONSTANT_CURRENT:
+        SCPI_ResultMnemonic(context, "CC");
+        break;
+    default:
+        SCPI_ResultMnemonic(context, "XX");
+        break;
+    }
+    switch (measurements.protection) {
+    case Protection::OVP:
+        SCPI_ResultMnemonic(context, "OVP");
+        break;
+    case Protection::OCP:
+        SCPI_ResultMnemonic(context, "OCP");
+        break;
+    default:
+        SCPI_ResultMnemonic(context, "NONE");
+        break;
+    }
+    ResultFixed(context, measurements.system_temperature_celsius, SCPI_TEMPERATURE_DECIMALS);
+    ResultFixed(context, measurements.probe_temperature_celsius, SCPI_TEMPERATURE_DECIMALS);
+    ResultFixed(context, measurements.ah, SCPI_ENERGY_DECIMALS);
+    ResultFixed(context, measurements.wh, SCPI_ENERGY_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FetchVoltageQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Sample sample;
+    if (!ridenScpi->fetch_sample(context, sample)) {
+        return SCPI_RES_ERR;
+    }
+    ResultFixed(context, sample.voltage, SCPI_VOLTAGE_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FetchCurrentQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Sample sample;
+    if (!ridenScpi->fetch_sample(context, sample)) {
+        return SCPI_RES_ERR;
+    }
+    ResultFixed(context, sample.current, SCPI_CURRENT_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FetchPowerQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Sample sample;
+    if (!ridenScpi->fetch_sample(context, sample)) {
+        return SCPI_RES_ERR;
+    }
+    ResultFixed(context, sample.power, SCPI_POWER_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FetchAllQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Sample sample;
+    if (!ridenScpi->fetch_sample(context, sample)) {
+        return SCPI_RES_ERR;
+    }
+    ResultFixed(context, sample.voltage, SCPI_VOLTAGE_DECIMALS);
+    ResultFixed(context, sample.current, SCPI_CURRENT_DECIMALS);
+    ResultFixed(context, sample.power, SCPI_POWER_DECIMALS);
+    SCPI_ResultUInt32(context, sample.timestamp);
+    SCPI_ResultUInt32(context, millis() - sample.timestamp);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FetchTimestampQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    Sample sample;
+    if (!ridenScpi->fetch_sample(context, sample)) {
+        return SCPI_RES_ERR;
+    }
+    SCPI_ResultUInt32(context, sample.timestamp);
+    SCPI_ResultUInt32(context, millis() - sample.timestamp);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FormatData(scpi_t *context)
+{
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
+
+    int32_t format;
+    if (!SCPI_ParamChoice(context, format_options, &format, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+    uint32_t length = 32;
+    if (!SCPI_ParamUnsignedInt(context, &length, FALSE) && SCPI_ParamErrorOccurred(context)) {
+        return SCPI_RES_ERR;
+    }
+    if (DataFormat(format) != DataFormat::Ascii && length != 32) {
+        SCPI_ErrorPush(context, SCPI_ERROR_ILLEGAL_PARAMETER_VALUE);
+        return SCPI_RES_ERR;
+    }
+    session->data_format = DataFormat(format);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FormatDataQ(scpi_t *context)
+{
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
+
+    switch (session->data_format) {
+    case DataFormat::Real32:
+        SCPI_ResultMnemonic(context, "REAL");
+        SCPI_ResultUInt8(context, 32);
+        break;
+    case DataFormat::Int32:
+        SCPI_ResultMnemonic(context, "INT");
+        SCPI_ResultUInt8(context, 32);
+        break;
+    default:
+        SCPI_ResultMnemonic(context, "ASC");
+        break;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::FormatBorderQ(scpi_t *context)
+{
+    // Binary blocks are always little-endian
+    SCPI_ResultMnemonic(context, "SWAP");
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::TraceDataQ(scpi_t *context)
+{
+    ScpiSession *session = static_cast<ScpiSession *>(context->user_context);
+    RidenScpi *ridenScpi = session->owner;
+
+    int32_t quantity;
+    if (!SCPI_ParamChoice(context, trace_options, &quantity, FALSE)) {
+        if (SCPI_ParamErrorOccurred(context)) {
+            return SCPI_RES_ERR;
+        }
+        quantity = TRACE_ALL;
+    }
+
+    SampleLog &sample_log = ridenScpi->ridenModbus.get_sample_log();
+    uint16_t count = sample_log.size();
+    if (count == 0) {
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+    uint8_t values_per_sample = (quantity == TRACE_ALL) ? 3 : 1;
+
+    if (session->data_format != DataFormat::Ascii) {
+        SCPI_ResultArbitraryBlockHeader(context, size_t(count) * values_per_sample * 4);
+    } else {
+        session->trace.separator = (context->output_count > 0);
+        context->output_count++;
+    }
+    // The values are produced as the client takes them, see produce_output()
+    TraceStream &trace = session->trace;
+    trace.active = true;
+    trace.quantity = quantity;
+    trace.end_sequence = sample_log.get_next_sequence();
+    trace.next_sequence = trace.end_sequence - count;
+    trace.next_value = 0;
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::TracePointsQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    SCPI_ResultUInt16(context, ridenScpi->ridenModbus.get_sample_log().size());
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListVoltage(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    float values[SEQUENCE_MAX_STEPS];
+    uint8_t count;
+    if (!ParamList(context, values, count, SCPI_UNIT_VOLT, ridenScpi->ridenModbus.get_max_voltage())) {
+        return SCPI_RES_ERR;
+    }
+    if (!ridenScpi->ridenModbus.get_sequencer().set_voltages(values, count)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListVoltageQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    uint8_t count = ridenScpi->ridenModbus.get_sequencer().get_voltages(values);
+    ResultList(context, values, count, SCPI_VOLTAGE_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListVoltagePointsQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    SCPI_ResultUInt8(context, ridenScpi->ridenModbus.get_sequencer().get_voltages(values));
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListCurrent(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    float values[SEQUENCE_MAX_STEPS];
+    uint8_t count;
+    if (!ParamList(context, values, count, SCPI_UNIT_AMPER, ridenScpi->ridenModbus.get_max_current())) {
+        return SCPI_RES_ERR;
+    }
+    if (!ridenScpi->ridenModbus.get_sequencer().set_currents(values, count)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListCurrentQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    uint8_t count = ridenScpi->ridenModbus.get_sequencer().get_currents(values);
+    ResultList(context, values, count, SCPI_CURRENT_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListCurrentPointsQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    SCPI_ResultUInt8(context, ridenScpi->ridenModbus.get_sequencer().get_currents(values));
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListDwell(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    float values[SEQUENCE_MAX_STEPS];
+    uint8_t count;
+    // About 49 days, the range of millis()
+    if (!ParamList(context, values, count, SCPI_UNIT_SECOND, 4.2e6)) {
+        return SCPI_RES_ERR;
+    }
+    if (!ridenScpi->ridenModbus.get_sequencer().set_dwells(values, count)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListDwellQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    uint8_t count = ridenScpi->ridenModbus.get_sequencer().get_dwells(values);
+    ResultList(context, values, count, SCPI_TIME_DECIMALS);
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListDwellPointsQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    const float *values;
+    SCPI_ResultUInt8(context, ridenScpi->ridenModbus.get_sequencer().get_dwells(values));
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListCount(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    scpi_number_t value;
+    if (!SCPI_ParamNumber(context, scpi_special_numbers_def, &value, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+    uint16_t count;
+    if (value.special && value.content.tag == SCPI_NUM_INF) {
+        count = 0; // Forever
+    } else if (!value.special && value.content.value >= 1 && value.content.value <= UINT16_MAX) {
+        count = uint16_t(value.content.value);
+    } else {
+        SCPI_ErrorPush(context, SCPI_ERROR_DATA_OUT_OF_RANGE);
+        return SCPI_RES_ERR;
+    }
+    if (!ridenScpi->ridenModbus.get_sequencer().set_count(count)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListCountQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    uint16_t count = ridenScpi->ridenModbus.get_sequencer().get_count();
+    if (count == 0) {
+        SCPI_ResultDouble(context, 9.9e37); // SCPI infinity
+    } else {
+        SCPI_ResultUInt16(context, count);
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListStep(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    int32_t step_auto;
+    if (!SCPI_ParamChoice(context, list_step_options, &step_auto, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+    if (!ridenScpi->ridenModbus.get_sequencer().set_step_auto(step_auto != 0)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::ListStepQ(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    SCPI_ResultMnemonic(context, ridenScpi->ridenModbus.get_sequencer().is_step_auto() ? "AUTO" : "ONCE");
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::Initiate(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    RidenSequencer &sequencer = ridenScpi->ridenModbus.get_sequencer();
+    if (sequencer.get_state() != SequenceState::Idle) {
+        SCPI_ErrorPush(context, SCPI_ERROR_INIT_IGNORED);
+        return SCPI_RES_ERR;
+    }
+    if (!sequencer.initiate()) {
+        SCPI_ErrorPush(context, SCPI_ERROR_SETTINGS_CONFLICT);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::Abort(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    ridenScpi->ridenModbus.get_sequencer().abort();
+    return SCPI_RES_OK;
+}
+
+scpi_result_t RidenScpi::Trigger(scpi_t *context)
+{
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
+
+    if (!ridenScpi->ridenModbus.get_sequencer().trigger()) {
+        SCPI_ErrorPush(context, SCPI_ERROR_TRIGGER_IGNORED);
+        return SCPI_RES_ERR;
+    }
+    return SCPI_RES_OK;
+}
+
+/**
+ * Parse a comma-separated list of at most `SEQUENCE_MAX_STEPS` numbers
+ * between 0 and `max_value`, pushing an error on failure.
+ */
+bool RidenScpi::ParamList(scpi_t *context, float *values, uint8_t &count, const scpi_unit_t unit, const double max_value)
+{
+    count = 0;
+    scpi_number_t value;
+    while (SCPI_ParamNumber(context, NULL, &value, count == 0)) {
+        if (count == SEQUENCE_MAX_STEPS) {
+            SCPI_ErrorPush(context, SCPI_ERROR_TOO_MUCH_DATA);
+            return false;
+        }
+        if (value.unit != SCPI_UNIT_NONE && value.unit != unit) {
+            SCPI_ErrorPush(context, SCPI_ERROR_DATA_TYPE_ERROR);
+            return false;
+        }
+        if (value.special || value.content.value < 0 || value.content.value > max_value) {
+            SCPI_ErrorPush(context, SCPI_ERROR_DATA_OUT_OF_RANGE);
+            return false;
+        }
+        values[count++] = value.content.value;
+    }
+    return count > 0 && !SCPI_ParamErrorOccurred(context);
+}
+
+void RidenScpi::ResultList(scpi_t *context, const float *values, const uint8_t count, const uint8_t decimals)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        ResultFixed(context, values[i], decimals);
+    }
+}
+
+/**
+ * Write a number with a fixed number of decimals, avoiding the floating
+ * point conversion of SCPI_ResultDouble().
+ */
+size_t RidenScpi::ResultFixed(scpi_t *context, const double value, const uint8_t decimals)
+{
+    char buffer[FIXED_BUFFER_LENGTH];
+    size_t length = format_fixed(buffer, sizeof(buffer), value, decimals);
+    return SCPI_ResultCharacters(context, buffer, length);
+}
+
+/**
+ * Retrieve the most recent sample polled in the background, pushing an
+ * error if there is none yet.
+ */
+bool RidenScpi::fetch_sample(scpi_t *context, Sample &sample)
+{
+    if (!ridenModbus.get_sample_log().latest(sample)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return false;
+    }
+    return true;
+}
+
 scpi_result_t RidenScpi::SourceVoltageLimit(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     scpi_choice_def_t special;
     scpi_number_t value;
@@ -642,7 +1191,7 @@ scpi_result_t RidenScpi::SourceVoltageLimit(scpi_t *context)
 
 scpi_result_t RidenScpi::SourceCurrentLimit(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     scpi_choice_def_t special;
     scpi_number_t value;
@@ -664,7 +1213,7 @@ scpi_result_t RidenScpi::SourceCurrentLimit(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemBeeperState(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     bool on;
     if (!SCPI_ParamBool(context, &on, TRUE)) {
@@ -680,7 +1229,7 @@ scpi_result_t RidenScpi::SystemBeeperState(scpi_t *context)
 
 scpi_result_t RidenScpi::SystemBeeperStateQ(scpi_t *context)
 {
-    RidenScpi *ridenScpi = static_cast<RidenScpi *>(context->user_context);
+    RidenScpi *ridenScpi = static_cast<ScpiSession *>(context->user_context)->owner;
 
     bool on;
     if (ridenScpi->ridenModbus.is_buzzer_enabled(on)) {
@@ -692,55 +1241,189 @@ scpi_result_t RidenScpi::SystemBeeperStateQ(scpi_t *context)
     }
 }
 
+/**
+ * @brief Give an outside link a session of its own.
+ *
+ * @param ip address of the client, which the rate limit applies to
+ * @return Handle of the session, or -1 if all sessions are in use.
+ */
+int RidenScpi::claim_external_control(const uint32_t ip)
+{
+    ScpiSession *session = allocate_session();
+    if (session == nullptr) {
+        LOG_LN("RidenScpi: no free session for external control.");
+        return -1;
+    }
+    session->external = true;
+    session->ip = ip;
+    return session - sessions;
+}
+
+void RidenScpi::release_external_control(int handle)
+{
+    ScpiSession *session = find_external_session(handle);
+    if (session != nullptr) {
+        free_session(*session);
+    }
+}
+
+/**
+ * @brief Check whether an outside link may write now, under the rate limit
+ * of its client. A link which is told no holds the command and asks again
+ * later, like a raw socket line waiting in the receive buffer.
+ *
+ * @param handle session returned by claim_external_control()
+ * @param received_at when the command arrived, millis()
+ */
+bool RidenScpi::can_write(int handle, const unsigned long received_at)
+{
+    ScpiSession *session = find_external_session(handle);
+    if (session == nullptr) {
+        return true; // write() ignores it
+    }
+    RidenScheduler &scheduler = ridenModbus.get_scheduler();
+    bool within_rate = scheduler.within_rate(TrafficClass::Scpi, session->ip);
+    if (!within_rate && (!session->throttled || session->pending_since != received_at)) {
+        scheduler.record_throttled(TrafficClass::Scpi, session->ip);
+        session->throttled = true;
+    }
+    session->pending_since = received_at;
+    return within_rate;
+}
+
 /**
  * @brief Write data to the parser and the device.
- * It overwrites the data in the buffer from the raw socket server.
+ * The data is parsed where it is, so it is not limited by the input
+ * buffer of the session. The parser may modify it.
  * 
+ * @param handle session returned by claim_external_control()
  * @param data data to be sent
  * @param len length of data
  */
-void RidenScpi::write(const char *data, size_t len) 
+void RidenScpi::write(int handle, char *data, size_t len) 
 {
     if ((len == 0) || (data == NULL)) return;
-    // insert the data into the buffer.
-    if (len > SCPI_INPUT_BUFFER_LENGTH) {
-        LOG_F("ERROR: RidenScpi buffer overflow. Ignoring data.\n");
+    ScpiSession *session = find_external_session(handle);
+    if (session == nullptr) {
         return;
     }
-    memcpy(scpi_context.buffer.data, data, len);
-    scpi_context.buffer.position = len;
-    scpi_context.buffer.length = len;
-    external_control = true; // just to be sure
-    SCPI_Input(&scpi_context, NULL, 0);
+    if (session->trace.active || session->trailer_length > 0) {
+        // A new command abandons a response the client did not read
+        LOG_LN("RidenScpi: abandoning unread response.");
+        reset_output(*session);
+    }
+    RidenScheduler &scheduler = ridenModbus.get_scheduler();
+    unsigned long received_at = (session->pending_since != 0) ? session->pending_since : millis();
+    scheduler.record_request(TrafficClass::Scpi, session->ip);
+    scheduler.admit(TrafficClass::Scpi, session->ip);
+    scpi_t &context = session->context;
+    context.cmdlist = find_commands(data, len);
+    SCPI_Parse(&context, data, len);
+    scheduler.record_latency(TrafficClass::Scpi, session->ip, received_at);
+    session->pending_since = 0;
+    session->throttled = false;
 }
 
 /**
  * @brief Read data from the parser and the device, this is the reaction to "write()"
+ *
+ * Responses larger than `max_len` are returned over several calls.
  * 
+ * @param handle session returned by claim_external_control()
  * @param data buffer to copy the data into
  * @param len length of data
  * @param max_len maximum length of data
+ * @param term_char stop after this character, or -1 to ignore
+ * @param end set to true when the last part of the response has been read
  * @return scpi_result_t last error code
  */
-scpi_result_t RidenScpi::read(char *data, size_t *len, size_t max_len){
-    if (!external_control || len == NULL || data == NULL) {
+scpi_result_t RidenScpi::read(int handle, char *data, size_t *len, size_t max_len, int term_char, bool *end){
+    ScpiSession *found = find_external_session(handle);
+    if (found == nullptr || len == NULL || data == NULL || end == NULL) {
         return SCPI_RES_ERR;
     }
+    ScpiSession &session = *found;
     *len = 0;
-    if (write_buffer_length > max_len) {
-        LOG_F("ERROR: RidenScpi output buffer overflow. Flushing the data.\n");
-        return SCPI_RES_ERR;
-    }
-    if (!external_output_ready) {
+    *end = false;
+    produce_output(session);
+    if (!session.output_ready && !session.flush_pending) {
 
         return SCPI_RES_ERR;
     }
-    memcpy(data, write_buffer, write_buffer_length);
-    *len = write_buffer_length;
-    write_buffer_length = 0;
+    size_t length = min(max_len, session.write_buffer_length);
+    if (term_char >= 0) {
+        const char *found = (const char *)memchr(session.write_buffer, term_char, length);
+        if (found != NULL) {
+            length = found - session.write_buffer + 1;
+        }
+    }
+    memcpy(data, session.write_buffer, length);
+    session.write_buffer_length -= length;
+    memmove(session.write_buffer, &session.write_buffer[length], session.write_buffer_length);
+    *len = length;
+    if (session.output_ready && session.write_buffer_length == 0) {
+        session.output_ready = false;
+        *end = true;
+    }
     return SCPI_RES_OK;
 }
 
+/**
+ * @brief Status byte of an outside link's session, as read by a serial poll.
+ *
+ * MAV is set while a response is waiting to be read, and counts towards
+ * the service request like the other bits.
+ *
+ * @param handle session returned by claim_external_control()
+ */
+uint8_t RidenScpi::read_status_byte(int handle)
+{
+    ScpiSession *session = find_external_session(handle);
+    if (session == nullptr) {
+        return 0;
+    }
+    uint8_t stb = SCPI_RegGet(&session->context, SCPI_REG_STB);
+    if (session->output_ready || session->flush_pending) {
+        stb |= STB_MAV;
+    }
+    if (stb & SCPI_RegGet(&session->context, SCPI_REG_SRE) & ~STB_SRQ) {
+        stb |= STB_SRQ;
+    }
+    return stb;
+}
+
+/**
+ * @brief Discard pending input and output of an outside link's session.
+ * The status registers and error queue are kept, unlike *CLS.
+ *
+ * @param handle session returned by claim_external_control()
+ */
+void RidenScpi::device_clear(int handle)
+{
+    ScpiSession *session = find_external_session(handle);
+    if (session == nullptr) {
+        return;
+    }
+    reset_output(*session);
+    session->context.buffer.length = 0;
+    session->context.buffer.position = 0;
+}
+
+/**
+ * @brief Trigger on behalf of an outside link, like *TRG.
+ *
+ * @param handle session returned by claim_external_control()
+ */
+void RidenScpi::device_trigger(int handle)
+{
+    ScpiSession *session = find_external_session(handle);
+    if (session != nullptr) {
+        session->pending_since = 0; // triggers are not held back
+    }
+    char command[] = "*TRG";
+    write(handle, command, 4);
+}
+
 bool RidenScpi::begin()
 {
     if (initialized) {
@@ -758,14 +1441,20 @@ bool RidenScpi::begin()
     sprintf(idn3, "%08u", serial_number);
     sprintf(idn4, "%u.%u", firmware_version / 100u, firmware_version % 100u);
 
-    SCPI_Init(&scpi_context,
-              scpi_commands,
-              &scpi_interface,
-              scpi_units_def,
-              idn1, idn2, idn3, idn4,
-              scpi_input_buffer, SCPI_INPUT_BUFFER_LENGTH,
-              scpi_error_queue_data, SCPI_ERROR_QUEUE_SIZE);
-    scpi_context.user_context = this;
+    index_commands();
+
+    // All sessions share the command table and interface
+    for (ScpiSession &session : sessions) {
+        SCPI_Init(&session.context,
+                  scpi_commands,
+                  &scpi_interface,
+                  scpi_units_def,
+                  idn1, idn2, idn3, idn4,
+                  session.input_buffer, SCPI_INPUT_BUFFER_LENGTH,
+                  session.error_queue_data, SCPI_ERROR_QUEUE_SIZE);
+        session.context.user_context = &session;
+        session.owner = this;
+    }
 
     // Start TCP listener
     tcpServer.begin();
@@ -785,66 +1474,309 @@ bool RidenScpi::begin()
 
 bool RidenScpi::loop()
 {
-    if (external_control) {
-        // skip this loop if I'm under external control
-        if (client) {
-            LOG_LN("RidenScpi: disconnect client because I am under external control.");
-            client.stop();
-        }
-        return true;
-    }
-
     // Check for new client connecting
     WiFiClient newClient = tcpServer.accept();
     if (newClient) {
         LOG_LN("RidenScpi: New client.");
-        if (!client) {
-            newClient.setTimeout(100);
+        ScpiSession *session = allocate_session();
+        if (session != nullptr) {
             newClient.setNoDelay(true);
-            client = newClient;
-            reset_buffers();
+            session->client = newClient;
         } else {
+            LOG_LN("RidenScpi: no free session, rejecting client.");
             newClient.stop();
         }
     }
 
     // Check for incoming data
-    if (client) {
-        int bytes_available = client.available();
-        if (bytes_available > 0) {
-            // Now read until I find a newline. There may be way more data in the buffer than 1 command.
-            char buffer[1];
-            while (client.readBytes(buffer, 1) == 1) {
-                if (scpi_context.buffer.position >= SCPI_INPUT_BUFFER_LENGTH) {
-                    // Client is sending more data than we can handle
-                    LOG_F("ERROR: RidenScpi buffer overflow. Flushing data and killing connection.\n");
-                    scpi_context.buffer.position = 0;
-                    scpi_context.buffer.length = 0;
-                    client.stop();
-                    break;
-                }
-                // insert the character into the buffer.
-                scpi_context.buffer.data[scpi_context.buffer.position] = buffer[0];
-                scpi_context.buffer.position++;
-                scpi_context.buffer.length++;
-                if (buffer[0] == '\n') {
-                    LOG_F("RidenScpi: received %d bytes for handling\n", scpi_context.buffer.position);
-                    SCPI_Input(&scpi_context, NULL, 0);
-                    break;
-                }
+    for (ScpiSession &session : sessions) {
+        if (session.used && !session.external && session.client) {
+            receive(session);
+        }
+    }
+
+    // Send pending output as far as the sockets accept it
+    for (ScpiSession &session : sessions) {
+        if (session.used && !session.external && session.client) {
+            send_output(session);
+        }
+    }
+
+    // Take one line from each session in turn, so a client sending
+    // many commands at once cannot hold the others back.
+    bool backlogged = false;
+    bool executed;
+    do {
+        executed = false;
+        for (ScpiSession &session : sessions) {
+            if (session.used && !session.external && session.client) {
+                executed |= execute_next_line(session, backlogged);
+            }
+        }
+    } while (executed);
+    ridenModbus.get_scheduler().set_backlogged(TrafficClass::Scpi, backlogged);
+
+    // Let every session know when a sequence ends
+    SequenceState state = ridenModbus.get_sequencer().get_state();
+    if (sequence_state == SequenceState::Running && state == SequenceState::Idle) {
+        for (ScpiSession &session : sessions) {
+            if (session.used) {
+                SCPI_RegSetBits(&session.context, SCPI_REG_OPER, SCPI_OPER_SEQUENCE_DONE);
             }
         }
     }
+    sequence_state = state;
+
+    // Stop clients which disconnect
+    for (ScpiSession &session : sessions) {
+        if (session.used && !session.external && !session.client.connected()) {
+            LOG_LN("RidenScpi: disconnect client.");
+            session.client.stop();
+            free_session(session);
+        }
+    }
 
-    // Stop client which disconnects
-    if (client && !client.connected()) {
-        LOG_LN("RidenScpi: disconnect client.");
-        client.stop();
+    return true;
+}
+
+/**
+ * Remember where each root mnemonic first appears in the command table.
+ * Patterns with an optional root, like `[SOURce]:VOLTage`, are indexed
+ * under both mnemonics.
+ */
+void RidenScpi::index_commands()
+{
+    root_count = 0;
+    for (uint16_t i = 0; scpi_commands[i].pattern != NULL; i++) {
+        const char *pattern = scpi_commands[i].pattern;
+        bool optional = (pattern[0] == '[');
+        const char *name = optional ? &pattern[1] : pattern;
+        size_t length = strcspn(name, ":?[]");
+        add_root(name, length, i);
+        if (optional && name[length] == ']' && name[length + 1] == ':') {
+            const char *next = &name[length + 2];
+            add_root(next, strcspn(next, ":?[]"), i);
+        }
     }
+}
 
+void RidenScpi::add_root(const char *name, const size_t length, const uint16_t first)
+{
+    for (uint8_t i = 0; i < root_count; i++) {
+        if (roots[i].length == length && strncmp(roots[i].name, name, length) == 0) {
+            return; // Already indexed at an earlier entry
+        }
+    }
+    if (root_count == SCPI_MAX_ROOTS) {
+        LOG_LN("RidenScpi: too many command roots, not all are indexed.");
+        return;
+    }
+    // The short form is the upper case prefix of the long form
+    uint8_t short_length = 0;
+    while (short_length < length && !islower(name[short_length])) {
+        short_length++;
+    }
+    roots[root_count++] = {name, uint8_t(length), short_length, first};
+}
+
+/**
+ * Find where the parser should start looking for the command on `line`.
+ *
+ * The parser scans the command table from the start and stops at the first
+ * match. Every pattern which can match a command shares its root, so
+ * starting at the first entry for that root gives the same result with
+ * fewer comparisons.
+ *
+ * SCPI_Parse() runs every message of its input against the same table, so
+ * the whole table is used as soon as `line` holds more than one command,
+ * whether compound or as several messages, as VXI-11 and HiSLIP writes may.
+ *
+ * @return The first table entry for the root, or the whole table if the
+ *         root is unknown or the line holds several commands.
+ */
+const scpi_command_t *RidenScpi::find_commands(const char *line, const size_t length)
+{
+    // Compound lines and further messages may switch to another root
+    if (memchr(line, ';', length) != NULL) {
+        return scpi_commands;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (line[i] == '\n' || line[i] == '\r') {
+            while (i < length && isspace(line[i])) {
+                i++;
+            }
+            if (i < length) {
+                return scpi_commands;
+            }
+        }
+    }
+    size_t start = 0;
+    while (start < length && isspace(line[start])) {
+        start++;
+    }
+    if (start < length && line[start] == ':') {
+        start++;
+    }
+    size_t end = start;
+    while (end < length && (isalnum(line[end]) || line[end] == '*')) {
+        end++;
+    }
+    size_t root_length = end - start;
+    for (uint8_t i = 0; i < root_count; i++) {
+        const ScpiRoot &root = roots[i];
+        if ((root_length == root.length || root_length == root.short_length) &&
+            strncasecmp(root.name, &line[start], root_length) == 0) {
+            return &scpi_commands[root.first];
+        }
+    }
+    return scpi_commands;
+}
+
+/**
+ * @return A free session with empty buffers, or nullptr if all are in use.
+ */
+ScpiSession *RidenScpi::allocate_session()
+{
+    for (ScpiSession &session : sessions) {
+        if (!session.used) {
+            reset_buffers(session);
+            SCPI_ErrorClear(&session.context);
+            session.data_format = DataFormat::Ascii;
+            session.used = true;
+            return &session;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @return The session claimed by an outside link, or nullptr if the handle is invalid.
+ */
+ScpiSession *RidenScpi::find_external_session(int handle)
+{
+    if (handle < 0 || handle >= SCPI_MAX_SESSIONS || !sessions[handle].used || !sessions[handle].external) {
+        LOG_F("ERROR: RidenScpi invalid external session %d\n", handle);
+        return nullptr;
+    }
+    return &sessions[handle];
+}
+
+void RidenScpi::free_session(ScpiSession &session)
+{
+    session.used = false;
+    session.external = false;
+    session.ip = 0;
+    session.client = WiFiClient();
+    reset_buffers(session);
+}
+
+/**
+ * Move whatever the client has sent into the receive buffer.
+ *
+ * @return false if the connection was closed.
+ */
+bool RidenScpi::receive(ScpiSession &session)
+{
+    size_t available = session.client.available();
+    while (available > 0 && session.receive_length < SCPI_RECEIVE_BUFFER_LENGTH) {
+        if (session.pending_since == 0) {
+            session.pending_since = millis();
+        }
+        // Read into the contiguous free space after the received data
+        size_t end = (session.receive_start + session.receive_length) % SCPI_RECEIVE_BUFFER_LENGTH;
+        size_t space = (end >= session.receive_start) ? SCPI_RECEIVE_BUFFER_LENGTH - end : session.receive_start - end;
+        int bytes_read = session.client.read(&session.receive_buffer[end], min(available, space));
+        if (bytes_read <= 0) {
+            break;
+        }
+        session.receive_length += bytes_read;
+        available = session.client.available();
+    }
+    if (session.receive_length == SCPI_RECEIVE_BUFFER_LENGTH && find_line_end(session) < 0) {
+        // Client is sending more data than we can handle
+        LOG_F("ERROR: RidenScpi buffer overflow. Flushing data and killing connection.\n");
+        session.receive_length = 0;
+        session.client.stop();
+        return false;
+    }
     return true;
 }
 
+/**
+ * Execute the next complete command line in the receive buffer, if the
+ * client is within its rate limit and the protocol within its fair share,
+ * and the previous response has been sent.
+ * The line is parsed once, executing `;` separated commands in order.
+ *
+ * @param backlogged Set to true if a line is left waiting for its share.
+ * @return true if a line was executed.
+ */
+bool RidenScpi::execute_next_line(ScpiSession &session, bool &backlogged)
+{
+    if (session.write_buffer_length > 0 || session.trace.active || session.trailer_length > 0) {
+        // The client must take the previous response first
+        return false;
+    }
+    RidenScheduler &scheduler = ridenModbus.get_scheduler();
+    uint32_t ip = session.client.remoteIP();
+    int line_end = find_line_end(session);
+    if (line_end < 0) {
+        return false;
+    }
+    if (!scheduler.within_rate(TrafficClass::Scpi, ip)) {
+        // Leave the data in the buffer until the client has tokens again
+        if (!session.throttled) {
+            scheduler.record_throttled(TrafficClass::Scpi, ip);
+            session.throttled = true;
+        }
+        return false;
+    }
+    backlogged = true;
+    scheduler.set_backlogged(TrafficClass::Scpi, true);
+    if (!scheduler.within_share(TrafficClass::Scpi)) {
+        return false;
+    }
+
+    size_t line_length = line_end + 1;
+    if (line_length >= SCPI_INPUT_BUFFER_LENGTH) {
+        LOG_F("ERROR: RidenScpi command too long. Flushing data and killing connection.\n");
+        session.receive_length = 0;
+        session.client.stop();
+        return false;
+    }
+    // Lines may wrap around the end of the ring buffer
+    char *line = session.context.buffer.data;
+    size_t first_part = min(line_length, SCPI_RECEIVE_BUFFER_LENGTH - session.receive_start);
+    memcpy(line, &session.receive_buffer[session.receive_start], first_part);
+    memcpy(&line[first_part], session.receive_buffer, line_length - first_part);
+    line[line_length] = '\0';
+    session.receive_start = (session.receive_start + line_length) % SCPI_RECEIVE_BUFFER_LENGTH;
+    session.receive_length -= line_length;
+
+    LOG_F("RidenScpi: received %d bytes for handling\n", line_length);
+    scheduler.record_request(TrafficClass::Scpi, ip);
+    scheduler.admit(TrafficClass::Scpi, ip);
+    session.context.cmdlist = find_commands(line, line_length);
+    SCPI_Parse(&session.context, line, line_length);
+    scheduler.record_latency(TrafficClass::Scpi, ip, session.pending_since);
+    session.pending_since = (session.receive_length > 0) ? millis() : 0;
+    session.throttled = false;
+    return true;
+}
+
+/**
+ * @return Offset of the first newline in the receive buffer, or -1.
+ */
+int RidenScpi::find_line_end(ScpiSession &session)
+{
+    for (size_t i = 0; i < session.receive_length; i++) {
+        if (session.receive_buffer[(session.receive_start + i) % SCPI_RECEIVE_BUFFER_LENGTH] == '\n') {
+            return i;
+        }
+    }
+    return -1;
+}
+
 uint16_t RidenScpi::port()
 {
     return tcpServer.port();
@@ -853,24 +1785,181 @@ uint16_t RidenScpi::port()
 std::list<IPAddress> RidenScpi::get_connected_clients()
 {
     std::list<IPAddress> connected_clients;
-    if (client && client.connected()) {
-        connected_clients.push_back(client.remoteIP());
+    for (ScpiSession &session : sessions) {
+        if (session.used && !session.external && session.client.connected()) {
+            connected_clients.push_back(session.client.remoteIP());
+        }
     }
     return connected_clients;
 }
 
 void RidenScpi::disconnect_client(const IPAddress &ip)
 {
-    if (client && client.connected() && client.remoteIP() == ip) {
-        client.stop();
+    for (ScpiSession &session : sessions) {
+        if (session.used && !session.external && session.client.connected() && session.client.remoteIP() == ip) {
+            session.client.stop();
+        }
+    }
+}
+
+/**
+ * Fill the write buffer from an active stream. When the stream ends,
+ * move the output held back in the trailer along as space frees up, and
+ * complete the response once it has all been taken.
+ */
+void RidenScpi::produce_output(ScpiSession &session)
+{
+    while (session.trace.active && produce_trace_value(session)) {
     }
+    if (session.trace.active) {
+        return;
+    }
+    if (session.trailer_length > 0) {
+        size_t length = min(size_t(session.trailer_length), WRITE_BUFFER_LENGTH - session.write_buffer_length);
+        memcpy(&session.write_buffer[session.write_buffer_length], session.trailer, length);
+        session.write_buffer_length += length;
+        session.trailer_length -= length;
+        memmove(session.trailer, &session.trailer[length], session.trailer_length);
+        if (session.trailer_length > 0) {
+            return;
+        }
+    }
+    if (session.flush_pending) {
+        session.flush_pending = false;
+        session.output_ready = true;
+    }
+}
+
+/**
+ * Append the next TRACe:DATA? value to the write buffer. Samples
+ * overwritten since the query was received are sent as zeros, so the
+ * response keeps the length promised in its header.
+ *
+ * @return false if the stream has ended or the buffer is full.
+ */
+bool RidenScpi::produce_trace_value(ScpiSession &session)
+{
+    TraceStream &trace = session.trace;
+    if (trace.next_sequence == trace.end_sequence) {
+        trace.active = false;
+        return false;
+    }
+    size_t room = WRITE_BUFFER_LENGTH - session.write_buffer_length;
+    if (room < ((session.data_format == DataFormat::Ascii) ? FIXED_BUFFER_LENGTH + 1 : 4)) {
+        return false;
+    }
+
+    Sample sample = {};
+    ridenModbus.get_sample_log().get_by_sequence(trace.next_sequence, sample);
+    const float values[] = {sample.voltage, sample.current, sample.power};
+    const uint8_t decimals[] = {SCPI_VOLTAGE_DECIMALS, SCPI_CURRENT_DECIMALS, SCPI_POWER_DECIMALS};
+    uint8_t index = (trace.quantity == TRACE_ALL) ? trace.next_value : trace.quantity;
+    float value = values[index];
+    char *end = &session.write_buffer[session.write_buffer_length];
+    uint32_t bits;
+    switch (session.data_format) {
+    case DataFormat::Real32:
+        memcpy(&bits, &value, sizeof(bits));
+        break;
+    case DataFormat::Int32:
+        bits = uint32_t(int32_t(lround(value * 1000.0)));
+        break;
+    default:
+        if (trace.separator) {
+            *end++ = ',';
+            room--;
+        }
+        trace.separator = true;
+        end += format_fixed(end, room, value, decimals[index]);
+        break;
+    }
+    if (session.data_format != DataFormat::Ascii) {
+        // Binary blocks are little-endian
+        for (uint8_t byte = 0; byte < 4; byte++) {
+            *end++ = char(bits >> (8 * byte));
+        }
+    }
+    session.write_buffer_length = end - session.write_buffer;
+
+    uint8_t values_per_sample = (trace.quantity == TRACE_ALL) ? 3 : 1;
+    if (++trace.next_value == values_per_sample) {
+        trace.next_value = 0;
+        trace.next_sequence++;
+    }
+    return true;
+}
+
+/**
+ * Send as much of the write buffer as the socket accepts without blocking,
+ * producing more output from an active stream as space frees up.
+ *
+ * @return true if anything was sent.
+ */
+bool RidenScpi::send_output(ScpiSession &session)
+{
+    produce_output(session);
+    if (session.write_buffer_length == 0) {
+        return false;
+    }
+    size_t length = min(size_t(session.client.availableForWrite()), session.write_buffer_length);
+    if (length == 0) {
+        return false; // TCP send window is full
+    }
+    size_t sent = session.client.write(session.write_buffer, length);
+    session.write_buffer_length -= sent;
+    memmove(session.write_buffer, &session.write_buffer[sent], session.write_buffer_length);
+    produce_output(session);
+    return sent > 0;
+}
+
+/**
+ * Send output of a raw socket until the trailer has room again, for a
+ * response larger than the write buffer and trailer together. A client
+ * which stops taking data for SCPI_SEND_TIMEOUT is disconnected.
+ *
+ * @return false if the output cannot be sent, and the response is truncated.
+ */
+bool RidenScpi::wait_for_output(ScpiSession &session)
+{
+    if (session.external || !session.client) {
+        return false; // read() takes the response once it is complete
+    }
+    unsigned long last_sent = millis();
+    while (session.trailer_length == SCPI_TRAILER_LENGTH) {
+        if (send_output(session)) {
+            last_sent = millis();
+        } else if (!session.client.connected() || millis() - last_sent >= SCPI_SEND_TIMEOUT) {
+            LOG_LN("RidenScpi: client stopped taking the response, closing the connection.");
+            session.client.stop();
+            return false;
+        } else {
+            yield(); // let the TCP stack process acknowledgements
+        }
+    }
+    return true;
+}
+
+/**
+ * Discard the response being sent, including an active stream.
+ */
+void RidenScpi::reset_output(ScpiSession &session)
+{
+    session.write_buffer_length = 0;
+    session.output_ready = false;
+    session.trace.active = false;
+    session.trailer_length = 0;
+    session.flush_pending = false;
 }
 
-void RidenScpi::reset_buffers()
+void RidenScpi::reset_buffers(ScpiSession &session)
 {
-    write_buffer_length = 0;
-    scpi_context.buffer.length = 0;
-    scpi_context.buffer.position = 0;
+    reset_output(session);
+    session.context.buffer.length = 0;
+    session.context.buffer.position = 0;
+    session.pending_since = 0;
+    session.throttled = false;
+    session.receive_start = 0;
+    session.receive_length = 0;
 }
 
 const char *RidenScpi::get_visa_resource()
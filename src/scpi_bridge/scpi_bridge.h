@@ -8,21 +8,37 @@ class SCPI_handler: public SCPI_handler_interface
   public:
     SCPI_handler(RidenDongle::RidenScpi &ridenScpi): ridenScpi(ridenScpi) {}
 
-    void write(const char *data, size_t len) override
+    void write(int handle, char *data, size_t len) override
     {
-        ridenScpi.write(data, len);
+        ridenScpi.write(handle, data, len);
     }
-    scpi_result_t read(char *data, size_t *len, size_t max_len) override
+    bool can_write(int handle, unsigned long received_at) override
     {
-        return ridenScpi.read(data, len, max_len);
+        return ridenScpi.can_write(handle, received_at);
     }
-    bool claim_control() override
+    scpi_result_t read(int handle, char *data, size_t *len, size_t max_len, int term_char, bool *end) override
     {
-        return ridenScpi.claim_external_control();
+        return ridenScpi.read(handle, data, len, max_len, term_char, end);
     }
-    void release_control() override
+    int claim_control(uint32_t ip) override
     {
-        ridenScpi.release_external_control();
+        return ridenScpi.claim_external_control(ip);
+    }
+    void release_control(int handle) override
+    {
+        ridenScpi.release_external_control(handle);
+    }
+    uint8_t read_status_byte(int handle) override
+    {
+        return ridenScpi.read_status_byte(handle);
+    }
+    void clear(int handle) override
+    {
+        ridenScpi.device_clear(handle);
+    }
+    void trigger(int handle) override
+    {
+        ridenScpi.device_trigger(handle);
     }
 
   private:
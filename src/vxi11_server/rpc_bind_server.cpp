@@ -18,106 +18,244 @@ void RPC_Bind_Server::begin()
     udp.begin(rpc::BIND_PORT);
     tcp.begin(rpc::BIND_PORT);
 
+    for (uint8_t i = 0; i < BIND_MAX_CONNECTIONS; i++) {
+        readers[i].data = read_buffers[i];
+        readers[i].capacity = BIND_BUFFER_SIZE;
+    }
+
     LOG_F("Listening for RPC_BIND requests on UDP and TCP port %d\n", rpc::BIND_PORT);
 }
 
 /*!
   The loop() member function should be called by
   the main loop of the program to process any UDP or
-  TCP bind requests. It will only process requests if
-  the vxi_server is available. If so, it will hand off the
-  TCP or UDP request to process_request() for validation
-  and response. The response will be assembled by
-  process_request(), but it will be sent from loop() since
-  we know whether to send it via UDP or TCP.
+  TCP bind requests. Requests are read without waiting
+  for more data, and every complete request is answered,
+  even while VXI clients are connected.
 */
 void RPC_Bind_Server::loop()
 {
-    /*  What to do if the vxi_server is busy?
-
-        There is no "out of resources" error code return from the
-        RPC BIND request. We could respond with PROC_UNAVAIL, but
-        that might suggest that the ESP simply cannot do RPC BIND
-        at all (as opposed to not right now). Another optioon is to
-        reject the message, but the enumerated reasons for rejection
-        (RPC_MISMATCH, AUTH_ERROR) do not seem appropriate. For now,
-        the solution is to ignore (not read) incoming requests until
-        a vxi_server becomes available.
-    */
+    receive_udp();
+    accept_connection();
+    for (uint8_t i = 0; i < BIND_MAX_CONNECTIONS; i++) {
+        if (clients[i]) {
+            receive_tcp(i);
+        }
+    }
+}
 
-    if (vxi_server.available()) {
-        int len;
-
-        if (udp.parsePacket() > 0) {
-            len = get_bind_packet(udp);
-            if (len > 0) {
-                LOG_F("UDP packet received on port %d\n", rpc::BIND_PORT);
-                process_request(true);
-                send_bind_packet(udp, sizeof(bind_response_packet));
-            }
-        } else {
-            WiFiClient tcp_client;
-            tcp_client = tcp.accept();
-            if (tcp_client) {
-                len = get_bind_packet(tcp_client);
-                if (len > 0) {
-                    LOG_F("TCP packet received on port %d\n", rpc::BIND_PORT);
-                    process_request(false);
-                    send_bind_packet(tcp_client, sizeof(bind_response_packet));
-                }
-            }
+/*!
+  @brief  Answer the requests which have arrived on UDP, including
+          broadcasts sent to discover instruments.
+*/
+void RPC_Bind_Server::receive_udp()
+{
+    for (uint8_t datagram = 0; datagram < BIND_MAX_DATAGRAMS && udp.parsePacket() > 0; datagram++) {
+        int n = udp.read(udp_buffer, BIND_BUFFER_SIZE);
+        if (n <= 0) {
+            continue;
+        }
+        uint32_t len = n;
+        LOG_F("\nReceived %d bytes from %s: %d\n", len, udp.remoteIP().toString().c_str(), udp.remotePort());
+        LOG_DUMP(udp_buffer, len)
+        LOG_F("\n");
+
+        XDR_Reader request(udp_buffer, len);
+        XDR_Writer reply(reply_buffer, BIND_BUFFER_SIZE);
+        if (process_request(request, reply, true)) {
+            udp.beginPacket(udp.remoteIP(), udp.remotePort());
+            udp.write(reply_buffer, reply.length());
+            udp.endPacket();
+
+            LOG_F("\nSent %d bytes to %s:%d\n", reply.length(), udp.remoteIP().toString().c_str(), udp.remotePort());
+            LOG_DUMP(reply_buffer, reply.length())
+            LOG_F("\n");
         }
     }
 }
 
+/*!
+  @brief  Take a new TCP connection, closing the one idle
+          longest when all are in use.
+*/
+void RPC_Bind_Server::accept_connection()
+{
+    WiFiClient new_client = tcp.accept();
+    if (!new_client) {
+        return;
+    }
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < BIND_MAX_CONNECTIONS; i++) {
+        if (!clients[i]) {
+            slot = i;
+            break;
+        }
+        if (millis() - last_active[i] > millis() - last_active[slot]) {
+            slot = i;
+        }
+    }
+    if (clients[slot]) {
+        LOG_F("Closing idle RPC_BIND connection from %s\n", clients[slot].remoteIP().toString().c_str());
+        clients[slot].stop();
+    }
+    clients[slot] = new_client;
+    readers[slot].reset();
+    last_active[slot] = millis();
+}
+
+void RPC_Bind_Server::receive_tcp(uint8_t connection)
+{
+    WiFiClient &client = clients[connection];
+    if (!client.connected()) {
+        client.stop();
+        client = WiFiClient();
+        return;
+    }
+    uint32_t len = get_rpc_record(client, readers[connection]);
+    if (len == 0) {
+        return;
+    }
+    XDR_Reader request(readers[connection].data, len);
+    XDR_Writer reply(reply_buffer + 4, BIND_BUFFER_SIZE - 4); // the first 4 bytes take the record mark
+    if (process_request(request, reply, false)) {
+        send_rpc_record(client, reply_buffer, reply.length());
+    }
+    last_active[connection] = millis();
+}
+
 /*!
   @brief  Handle the details of processing an incoming request
           for both TCP and UDP servers.
 
   This function checks to see if the incoming request is a valid
-  PORT_MAP request. It assembles the response including a
-  success or error code and the port passed by the VXI_Server.
-  Actually sending the response is handled by the caller.
+  PORT_MAP request, and encodes the reply. Actually sending the
+  reply is handled by the caller.
 
+  @param  request The request received.
+  @param  reply   Where to encode the reply.
   @param  onUDP   Indicates whether the server calling on this
                   function is UDP or TCP.
+  @return False if the request must not be answered.
 */
-void RPC_Bind_Server::process_request(bool onUDP)
+bool RPC_Bind_Server::process_request(XDR_Reader &request, XDR_Writer &reply, bool onUDP)
 {
-    uint32_t rc = rpc::SUCCESS;
-    uint32_t port = 0;
-
-    rpc_request_packet *rpc_request = (onUDP ? udp_request : tcp_request);
-    bind_response_packet *bind_response = (onUDP ? udp_bind_response : tcp_bind_response);
+    rpc_call call;
+    if (!get_rpc_call(request, call)) {
+        LOG_LN("ERROR: Invalid RPC call header");
+        put_rpc_reply(reply, call.xid, rpc::GARBAGE_ARGS);
+        return true;
+    }
 
-    if (rpc_request->program != rpc::PORTMAP) {
-        rc = rpc::PROG_UNAVAIL;
+    if (call.program != rpc::PORTMAP) {
+        LOG_F("ERROR: Invalid program (expected PORTMAP = 0x186A0; received 0x%08x)\n", call.program);
+        put_rpc_reply(reply, call.xid, rpc::PROG_UNAVAIL);
+        return true;
+    }
+    if (call.version != rpc::PORTMAP_VERSION) {
+        // rpcbind versions 3 and 4; the client falls back to version 2
+        put_rpc_reply(reply, call.xid, rpc::PROG_MISMATCH);
+        reply.u32(rpc::PORTMAP_VERSION); // lowest version supported
+        reply.u32(rpc::PORTMAP_VERSION); // highest version supported
+        return true;
+    }
 
-        LOG_F("ERROR: Invalid program (expected PORTMAP = 0x186A0; received 0x%08x)\n", (uint32_t)(rpc_request->program));
-    } else if (rpc_request->procedure != rpc::GET_PORT) {
-        rc = rpc::PROC_UNAVAIL;
+    switch (call.procedure) {
+    case rpc::NULL_PROC:
+        put_rpc_reply(reply, call.xid, rpc::SUCCESS);
+        break;
+    case rpc::PMAP_SET:
+    case rpc::PMAP_UNSET:
+        // mappings are fixed, so registering is refused
+        put_rpc_reply(reply, call.xid, rpc::SUCCESS);
+        reply.u32(0); // FALSE
+        break;
+    case rpc::GET_PORT: {
+        uint32_t program = request.u32();
+        uint32_t version = request.u32();
+        uint32_t protocol = request.u32();
+        if (request.failed()) {
+            put_rpc_reply(reply, call.xid, rpc::GARBAGE_ARGS);
+            break;
+        }
+        uint32_t port = get_port(program, version, protocol);
+        LOG_F("PORTMAP command received on %s port %d; program 0x%08x assigned to port %d\n",
+              (onUDP ? "UDP" : "TCP"), rpc::BIND_PORT, program, port);
+        put_rpc_reply(reply, call.xid, rpc::SUCCESS);
+        reply.u32(port);
+        break;
+    }
+    case rpc::PMAP_DUMP:
+        put_rpc_reply(reply, call.xid, rpc::SUCCESS);
+        dump(reply);
+        break;
+    case rpc::PMAP_CALLIT:
+        return callit(call, request, reply);
+    default:
+        LOG_F("ERROR: Invalid procedure (received %u)\n", call.procedure);
+        put_rpc_reply(reply, call.xid, rpc::PROC_UNAVAIL);
+        break;
+    }
+    return true;
+}
 
-        LOG_F("ERROR: Invalid procedure (expected GET_PORT = 3; received %u)\n", (uint32_t)(rpc_request->procedure));
-    } else {
-        // i.e., if it is a valid PORTMAP request
-        LOG_F("PORTMAP command received on %s port %d; ", (onUDP ? "UDP" : "TCP"), rpc::BIND_PORT);
+/*!
+  @brief  Answer CALLIT of the NULL procedure of a mapped program.
 
-        port = vxi_server.allocate();
+  Clients broadcast this call to find the instruments on a subnet.
+  Other procedures are not forwarded, and, like any CALLIT which
+  fails, are not answered, so a broadcast only gets replies from
+  hosts where the call succeeds.
 
-        /*  The logic in the loop() routine should not allow
-            the port returned to be zero, since we first checked
-            to see if the vxi_server was available. However, we are
-            including the following test just in case.
-        */
+  @return False if the call must not be answered.
+*/
+bool RPC_Bind_Server::callit(const rpc_call &call, XDR_Reader &request, XDR_Writer &reply)
+{
+    uint32_t program = request.u32();
+    uint32_t version = request.u32();
+    uint32_t procedure = request.u32();
+    uint32_t args_length;
+    request.opaque(args_length);
+    uint32_t port = get_port(program, version, program == rpc::PORTMAP ? rpc::PROTO_UDP : rpc::PROTO_TCP);
+    if (request.failed() || procedure != rpc::NULL_PROC || port == 0) {
+        return false;
+    }
+    LOG_F("PORTMAP discovery of program 0x%08x, port %d\n", program, port);
+    put_rpc_reply(reply, call.xid, rpc::SUCCESS);
+    reply.u32(port);
+    reply.u32(0); // the NULL procedure returns nothing
+    return true;
+}
 
-        if (port == 0) {
-            rc = rpc::GARBAGE_ARGS; // not really the appropriate response, but we need to signal failure somehow!
-            LOG_F("ERROR: PORTMAP failed: vxi_server not available.\n");
-        } else {
-            LOG_F("assigned to port %d\n", port);
+/*!
+  @brief  Encode the list of mappings, ending with FALSE.
+*/
+void RPC_Bind_Server::dump(XDR_Writer &reply)
+{
+    const uint32_t mappings[][4] = {
+        {rpc::PORTMAP, rpc::PORTMAP_VERSION, rpc::PROTO_TCP, rpc::BIND_PORT},
+        {rpc::PORTMAP, rpc::PORTMAP_VERSION, rpc::PROTO_UDP, rpc::BIND_PORT},
+        {rpc::VXI_11_CORE, rpc::VXI_11_VERSION, rpc::PROTO_TCP, vxi_server.port()},
+    };
+    for (const uint32_t *mapping : mappings) {
+        reply.u32(1); // TRUE, a mapping follows
+        for (uint8_t i = 0; i < 4; i++) {
+            reply.u32(mapping[i]);
         }
     }
+    reply.u32(0); // FALSE, no more mappings
+}
 
-    bind_response->rpc_status = rc;
-    bind_response->vxi_port = port;
+/*!
+  @return The port of a program, or 0 if it is not mapped.
+*/
+uint32_t RPC_Bind_Server::get_port(uint32_t program, uint32_t version, uint32_t protocol)
+{
+    if (program == rpc::PORTMAP && version == rpc::PORTMAP_VERSION &&
+        (protocol == rpc::PROTO_TCP || protocol == rpc::PROTO_UDP)) {
+        return rpc::BIND_PORT;
+    }
+    if (program == rpc::VXI_11_CORE && version == rpc::VXI_11_VERSION && protocol == rpc::PROTO_TCP) {
+        return vxi_server.allocate();
+    }
+    return 0;
 }
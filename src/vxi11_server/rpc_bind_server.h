@@ -5,21 +5,33 @@
   @brief  Declares the RPC_Bind_Server class
 */
 
+#include "rpc_packets.h"
 #include "utilities.h"
 #include "vxi_server.h"
+#include "xdr.h"
 #include <ESP8266WiFi.h>
 #include <WiFiUdp.h>
 
   // class VXI_Server; // forward declaration
 
+/*!
+  @brief  Limits of the RPC_Bind_Server.
+*/
+enum bind_limits {
+    BIND_MAX_CONNECTIONS = 2, ///< TCP connections; a new one replaces the one idle longest
+    BIND_MAX_DATAGRAMS = 8    ///< UDP requests answered per loop, so a broadcast storm cannot stall it
+};
+
 /*!
   @brief  Listens for and responds to PORT_MAP requests.
 
   The RPC_Bind_Server class listens for incoming PORT_MAP requests
-  on port 111, both on UDP and TCP. When a request comes in, it asks
-  the VXI_Server (passed as part of the construction of the class)
-  for the current port and returns a response accordingly. Note that
-  the VXI_Server must be constructed before the RPC_Bind_Server.
+  on port 111, both on UDP and TCP. It answers NULL, GETPORT and DUMP
+  for the portmapper itself and VXI_11_CORE, asking the VXI_Server
+  (passed as part of the construction of the class) for the current
+  port, and CALLIT of the NULL procedure, which clients broadcast on
+  UDP to discover instruments. Note that the VXI_Server must be
+  constructed before the RPC_Bind_Server.
 */
 class RPC_Bind_Server
 {
@@ -58,10 +70,22 @@ class RPC_Bind_Server
     void loop();
 
   protected:
-    void process_request(bool onUDP);
+    void accept_connection();
+    void receive_udp();
+    void receive_tcp(uint8_t connection);
+    bool process_request(XDR_Reader &request, XDR_Writer &reply, bool onUDP);
+    bool callit(const rpc_call &call, XDR_Reader &request, XDR_Writer &reply);
+    void dump(XDR_Writer &reply);
+    uint32_t get_port(uint32_t program, uint32_t version, uint32_t protocol);
 
     VXI_Server &vxi_server; ///< Reference to the VXI_Server
     WiFiUDP udp;            ///< UDP server
     WiFiServer_ext tcp;     ///< TCP server
+    WiFiClient clients[BIND_MAX_CONNECTIONS];
+    record_reader readers[BIND_MAX_CONNECTIONS];
+    uint8_t read_buffers[BIND_MAX_CONNECTIONS][BIND_BUFFER_SIZE]; ///< Requests being received on TCP
+    unsigned long last_active[BIND_MAX_CONNECTIONS];               ///< When each connection was accepted or last answered
+    uint8_t udp_buffer[BIND_BUFFER_SIZE];                          ///< Request received on UDP
+    uint8_t reply_buffer[BIND_BUFFER_SIZE];                        ///< Record mark (on TCP) and reply being sent
 };
 
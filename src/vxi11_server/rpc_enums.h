@@ -97,20 +97,54 @@ enum rpc_status {
 */
 enum programs {
 
-    PORTMAP = 0x186A0,    ///< Request for the port on which the VXI_Server is listening
-    VXI_11_CORE = 0x607AF ///< Request for a VXI command to be executed
+    PORTMAP = 0x186A0,     ///< Request for the port on which the VXI_Server is listening
+    VXI_11_CORE = 0x607AF, ///< Request for a VXI command to be executed
+    VXI_11_INTR = 0x607B1  ///< Service request sent by the device on the interrupt channel
 };
 
 /*!
-  @brief  espBode provides only GET_PORT and selected VXI_11 procedures.
+  @brief  Versions of the programs served.
+*/
+enum versions {
+
+    RPC_VERSION = 2,     ///< Version of the RPC protocol itself
+    PORTMAP_VERSION = 2, ///< Only version 2 of the portmapper; rpcbind versions 3 and 4 are not served
+    VXI_11_VERSION = 1   ///< Version of VXI_11_CORE and VXI_11_INTR
+};
+
+/*!
+  @brief  Protocols of portmap mappings.
+*/
+enum protocols {
+
+    PROTO_TCP = 6,  ///< Mapping on TCP
+    PROTO_UDP = 17 ///< Mapping on UDP
+};
+
+/*!
+  @brief  espBode provides the portmap procedures and selected VXI_11 procedures.
 */
 enum procedures {
 
-    GET_PORT = 3,            ///< Return the port on which the VXI_Server is currently listening
-    VXI_11_CREATE_LINK = 10, ///< Create a link to handle a series of requests
-    VXI_11_DEV_WRITE = 11,   ///< Write to the AWG
-    VXI_11_DEV_READ = 12,    ///< Read from the AWG
-    VXI_11_DESTROY_LINK = 23 ///< Destroy the link and cycle to the next port
+    NULL_PROC = 0,                 ///< Do nothing, used to check that a program is there
+    PMAP_SET = 1,                  ///< Register a mapping, always refused
+    PMAP_UNSET = 2,                ///< Unregister a mapping, always refused
+    GET_PORT = 3,                  ///< Return the port on which a program is listening
+    PMAP_DUMP = 4,                 ///< Return all mappings
+    PMAP_CALLIT = 5,               ///< Call a procedure through the portmapper, used for broadcast discovery
+    VXI_11_CREATE_LINK = 10,       ///< Create a link to handle a series of requests
+    VXI_11_DEV_WRITE = 11,         ///< Write to the device
+    VXI_11_DEV_READ = 12,          ///< Read from the device
+    VXI_11_DEV_READSTB = 13,       ///< Read the status byte
+    VXI_11_DEV_TRIGGER = 14,       ///< Send a trigger, like *TRG
+    VXI_11_DEV_CLEAR = 15,         ///< Discard pending input and output
+    VXI_11_DEV_LOCK = 18,          ///< Lock the device to the link
+    VXI_11_DEV_UNLOCK = 19,        ///< Release the lock
+    VXI_11_DEV_ENABLE_SRQ = 20,    ///< Enable or disable service requests for the link
+    VXI_11_DESTROY_LINK = 23,      ///< Destroy the link
+    VXI_11_CREATE_INTR_CHAN = 25,  ///< Connect the interrupt channel to the client
+    VXI_11_DESTROY_INTR_CHAN = 26, ///< Close the interrupt channel
+    VXI_11_INTR_SRQ = 30           ///< Service request, on the interrupt channel
 };
 
 /*!
@@ -145,4 +179,23 @@ enum reasons {
     REQCNT = 1 ///< Data reached the maximum count requested
 };
 
+/*!
+  @brief  Flags of the VXI_11 read and write requests.
+*/
+enum flags {
+
+    WAIT_LOCK = 1,     ///< Wait up to lock_timeout for a lock held by another link
+    END_FLAG = 8,      ///< The write request holds the end of the message
+    TERM_CHR_SET = 128 ///< The read request supplies a terminating character
+};
+
+/*!
+  @brief  Transport of the interrupt channel, see VXI_11_CREATE_INTR_CHAN.
+*/
+enum prog_family {
+
+    INTR_TCP = 0, ///< The client listens for service requests on TCP
+    INTR_UDP = 1  ///< The client listens for service requests on UDP
+};
+
 }; // namespace rpc
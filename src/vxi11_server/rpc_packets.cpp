@@ -1,212 +1,148 @@
 /*!
   @file   rpc_packets.cpp
-  @brief  Definitions of variables and basic functions
+  @brief  Definitions of basic functions
           to receive and send RPC/VXI packets.
 */
 
 #include "rpc_packets.h"
 #include "rpc_enums.h"
 
-/*  The definition of the buffers to hold packet data	*/
-
-uint8_t udp_read_buffer[UDP_READ_SIZE]; // only for udp bind requests
-uint8_t udp_send_buffer[UDP_SEND_SIZE]; // only for udp bind responses
-uint8_t tcp_read_buffer[TCP_READ_SIZE]; // only for tcp bind requests
-uint8_t tcp_send_buffer[TCP_SEND_SIZE]; // only for tcp bind responses
-uint8_t vxi_read_buffer[VXI_READ_SIZE]; // only for vxi requests
-uint8_t vxi_send_buffer[VXI_SEND_SIZE]; // only for vxi responses
-
-/*!
-  @brief  Receive an RPC bind request packet via UDP.
-
-  This function is called only when the udp connection has
-  data available. It reads the data into the udp_read_buffer.
-
-  @param  udp		The WiFiUDP connection from which to read.
-  @return The length of data received.
-*/
-uint32_t get_bind_packet(WiFiUDP &udp)
-{
-    uint32_t len = udp.read(udp_request_packet_buffer, UDP_READ_SIZE);
-
-    if (len > 0) {
-        LOG_F("\nReceived %d bytes from %s: %d\n", len, udp.remoteIP().toString().c_str(), udp.remotePort());
-        LOG_DUMP(udp_request_packet_buffer, len)
-        LOG_F("\n");
-    }
-
-    return len;
-}
-
-/*!
-  @brief  Receive an RPC bind request packet via TCP.
-
-  This function is called only when the tcp client has data
-  available. It reads the data into the tcp_read_buffer.
-
-  @param  tcp   The WiFiClient connection from which to read.
-  @return The length of data received.
-*/
-uint32_t get_bind_packet(WiFiClient &tcp)
-{
-    uint32_t len;
-
-    tcp_request_prefix->length = 0; // set the length to zero in case the following read fails
-
-    tcp.readBytes(tcp_request_prefix_buffer, 4); // get the FRAG + LENGTH field
-
-    len = (tcp_request_prefix->length & 0x7fffffff); // mask out the FRAG bit
-
-    if (len > 4) {
-        len = std::min(len, (uint32_t)(TCP_READ_SIZE - 4)); // do not read more than the buffer can hold
-
-        tcp.readBytes(tcp_request_packet_buffer, len);
-        LOG_F("\nReceived %d bytes from %s: %d\n", len + 4, tcp.remoteIP().toString().c_str(), tcp.remotePort());
-        LOG_DUMP(tcp_request_prefix_buffer, len + 4)
-        LOG_F("\n");
-    }
-
-    return len;
-}
-
 /*!
-  @brief  Receive an RPC/VXI command request packet via TCP.
+  @brief  Receive an RPC record via TCP.
 
-  This function is called only when the tcp client has data
-  available. It reads the data into the vxi_read_buffer.
+  This function reads whatever the tcp client has available
+  without waiting for more, straight into the reader's buffer.
+  The record is left there for decoding. Records too large for
+  the buffer are dropped.
 
-  @param  tcp   The WiFiClient connection from which to read.
+  @param  tcp     The WiFiClient connection from which to read.
+  @param  reader  The state of the record being received on this connection.
 
-  @return The length of data received.
+  @return The length of a complete record in reader.data, or 0 if none is complete yet.
 */
-uint32_t get_vxi_packet(WiFiClient &tcp)
+uint32_t get_rpc_record(WiFiClient &tcp, record_reader &reader)
 {
-    uint32_t len;
-
-    vxi_request_prefix->length = 0; // set the length to zero in case the following read fails
-
-    tcp.readBytes(vxi_request_prefix_buffer, 4); // get the FRAG + LENGTH field
-
-    len = (vxi_request_prefix->length & 0x7fffffff); // mask out the FRAG bit
-
-    if (len > 4) {
-        len = std::min(len, (uint32_t)(VXI_READ_SIZE - 4)); // do not read more than the buffer can hold
-
-        tcp.readBytes(vxi_request_packet_buffer, len);
-
-        LOG_F("\nReceived %d bytes from %s: %d\n", len + 4, tcp.remoteIP().toString().c_str(), tcp.remotePort());
-        LOG_DUMP(vxi_request_prefix_buffer, len + 4)
-        LOG_F("\n");
+    while (tcp.available() > 0) {
+        if (reader.mark_length < 4) {
+            int n = tcp.read(&reader.mark[reader.mark_length], 4 - reader.mark_length);
+            if (n <= 0) {
+                break;
+            }
+            reader.mark_length += n;
+            if (reader.mark_length < 4) {
+                continue;
+            }
+            uint32_t mark = (uint32_t(reader.mark[0]) << 24) | (uint32_t(reader.mark[1]) << 16) |
+                            (uint32_t(reader.mark[2]) << 8) | reader.mark[3]; // big-endian
+            reader.last_fragment = (mark & 0x80000000) != 0; // the FRAG bit
+            reader.fragment_left = mark & 0x7fffffff;
+        } else {
+            uint32_t space = reader.capacity - reader.length;
+            if (space == 0) {
+                reader.overflow = true;
+            }
+            uint8_t discard[32];
+            uint8_t *target = reader.overflow ? discard : &reader.data[reader.length];
+            uint32_t size = std::min(reader.fragment_left, reader.overflow ? (uint32_t)sizeof(discard) : space);
+            int n = tcp.read(target, size);
+            if (n <= 0) {
+                break;
+            }
+            if (!reader.overflow) {
+                reader.length += n;
+            }
+            reader.fragment_left -= n;
+        }
+
+        if (reader.mark_length == 4 && reader.fragment_left == 0) {
+            // the current fragment is complete
+            reader.mark_length = 0;
+            if (reader.last_fragment) {
+                uint32_t len = reader.length;
+                bool overflow = reader.overflow;
+                reader.reset();
+                if (overflow) {
+                    LOG_F("ERROR: Dropping RPC record from %s, it does not fit the buffer\n", tcp.remoteIP().toString().c_str());
+                    continue;
+                }
+
+                LOG_F("\nReceived %d bytes from %s: %d\n", len, tcp.remoteIP().toString().c_str(), tcp.remotePort());
+                LOG_DUMP(reader.data, len)
+                LOG_F("\n");
+                return len;
+            }
+        }
     }
 
-    return len;
+    return 0;
 }
 
 /*!
-  @brief  Send an RPC bind response packet via UDP.
+  @brief  Send an RPC record via TCP.
 
-  This function is called to return the port number on which
-  the VXI_Server is listening. It uses the udp_send_buffer.
-
-  @param  udp   The udp connection on which to send.
-  @param  len	  The length of the response to send.
-*/
-void send_bind_packet(WiFiUDP &udp, uint32_t len)
-{
-    fill_response_header(udp_response_packet_buffer, udp_request->xid); // get the xid from the request
-
-    udp.beginPacket(udp.remoteIP(), udp.remotePort());
-    udp.write(udp_response_packet_buffer, len);
-    udp.endPacket();
-
-    LOG_F("\nSent %d bytes to %s:%d\n", len, udp.remoteIP().toString().c_str(), udp.remotePort());
-    LOG_DUMP(udp_response_packet_buffer, len)
-    LOG_F("\n");
-}
-
-/*!
-  @brief  Send an RPC bind response packet via TCP.
-
-  This function is called to return the port number on which
-  the VXI_Server is listening. It uses the tcp_send_buffer.
+  This function is called to return the response to the
+  previous request. The response, including its
+  RPC header, has been encoded in place after the first
+  4 bytes of the buffer, which take the record mark.
 
   @param  tcp		The WiFiClient to which to send.
-  @param  len		The length of the response to send.
+  @param  buffer	The record mark followed by the response.
+  @param  len		The length of the response, a multiple of 4.
 */
-void send_bind_packet(WiFiClient &tcp, uint32_t len)
+void send_rpc_record(WiFiClient &tcp, uint8_t *buffer, uint32_t len)
 {
-    fill_response_header(tcp_response_packet_buffer, tcp_request->xid); // get the xid from the request
-
-    // adjust length to multiple of 4, appending 0's to fill the dword
-
-    while ((len & 3) > 0) {
-        tcp_response_packet_buffer[len++] = 0;
-    }
-
-    tcp_response_prefix->length = 0x80000000 | len; // set the FRAG bit and the length;
+    uint32_t mark = 0x80000000 | len; // set the FRAG bit and the length
+    buffer[0] = mark >> 24;
+    buffer[1] = mark >> 16;
+    buffer[2] = mark >> 8;
+    buffer[3] = mark;
 
     while (tcp.availableForWrite() == 0)
         ; // wait for tcp to be available
 
-    tcp.write(tcp_response_prefix_buffer, len + 4); // add 4 to the length to account for the tcp_response_prefix
+    tcp.write(buffer, len + 4); // add 4 to the length to account for the record mark
     tcp.flush();
 
     LOG_F("\nSent %d bytes to %s:%d\n", len, tcp.remoteIP().toString().c_str(), tcp.remotePort());
-    LOG_DUMP(tcp_response_prefix_buffer, len + 4)
+    LOG_DUMP(buffer, len + 4)
     LOG_F("\n");
 }
 
 /*!
-  @brief  Send a VXI command response packet via TCP.
+  @brief  Decode the header of an RPC call.
 
-  This function is called to return the response to the
-  previous command request; the packet includes at least
-  the basic response header plus an error code, but may
-  include additional data as appropriate. It uses the
-  vxi_send_buffer.
+  The credentials and verifier are skipped, whatever their flavor.
 
-  @param  tcp		The WiFiClient to which to send.
-  @param  len		The length of the response to send.
+  @param  request The request, positioned at its start.
+  @param  call    Set to the fields of the header.
+  @return False if the request is not a complete RPC call.
 */
-void send_vxi_packet(WiFiClient &tcp, uint32_t len)
+bool get_rpc_call(XDR_Reader &request, rpc_call &call)
 {
-    fill_response_header(vxi_response_packet_buffer, vxi_request->xid);
-
-    // adjust length to multiple of 4, appending 0's to fill the dword
-
-    while ((len & 3) > 0) {
-        vxi_response_packet_buffer[len++] = 0;
-    }
-
-    vxi_response_prefix->length = 0x80000000 | len; // set the FRAG bit and the length;
-
-    while (tcp.availableForWrite() == 0)
-        ; // wait for tcp to be available
-
-    tcp.write(vxi_response_prefix_buffer, len + 4); // add 4 to the length to account for the vxi_response_prefix
-    tcp.flush();
-
-    LOG_F("\nSent %d bytes to %s:%d\n", len, tcp.remoteIP().toString().c_str(), tcp.remotePort());
-    LOG_DUMP(vxi_response_prefix_buffer, len + 4)
-    LOG_F("\n");
+    call.xid = request.u32();
+    uint32_t msg_type = request.u32();
+    request.u32(); // rpc_version
+    call.program = request.u32();
+    call.version = request.u32();
+    call.procedure = request.u32();
+    request.skip_auth(); // credentials
+    request.skip_auth(); // verifier
+    return !request.failed() && msg_type == rpc::CALL;
 }
 
 /*!
-  @brief  Fill in the standard response header data.
-
-  This function is called by the various send_XYZ functions
-  to fill in the "generic" parts of the response.
+  @brief  Encode the standard header of an accepted reply.
 
-  @param  buffer	The buffer to use for the response
-  @param	xid			The transaction id copied from the request
+  @param  reply       The reply, at its start.
+  @param  xid         The transaction id copied from the request.
+  @param  rpc_status  See rpc::rpc_status.
 */
-void fill_response_header(uint8_t *buffer, uint32_t xid)
+void put_rpc_reply(XDR_Writer &reply, uint32_t xid, uint32_t rpc_status)
 {
-    rpc_response_packet *rpc_response = (rpc_response_packet *)buffer;
-
-    rpc_response->xid = xid;                       // transaction id supplied by the request
-    rpc_response->msg_type = rpc::REPLY;           // CALL = 0; REPLY = 1
-    rpc_response->reply_state = rpc::MSG_ACCEPTED; // MSG_ACCEPTED = 0; MSG_DENIED = 1
-    rpc_response->verifier_l = 0;
-    rpc_response->verifier_h = 0;
+    reply.u32(xid);               // transaction id supplied by the request
+    reply.u32(rpc::REPLY);        // CALL = 0; REPLY = 1
+    reply.u32(rpc::MSG_ACCEPTED); // MSG_ACCEPTED = 0; MSG_DENIED = 1
+    reply.u32(0);                 // verifier flavor
+    reply.u32(0);                 // verifier length
+    reply.u32(rpc_status);
 }
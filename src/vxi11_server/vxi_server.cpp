@@ -28,24 +28,38 @@ VXI_Server::~VXI_Server()
 {
 }
 
-uint32_t VXI_Server::allocate()
+/*!
+  @return True if another client can connect.
+*/
+bool VXI_Server::available()
 {
-    uint32_t port = 0;
-
-    if (available()) {
-        port = vxi_port; // This is a cyclic counter, not a simple integer
+    for (bool used : connection_used) {
+        if (!used) {
+            return true;
+        }
     }
-    return port;
+    return false;
+}
+
+/*!
+  @brief  The port to hand out to portmap requests.
+
+  The port is always returned, even when every connection is in use,
+  so discovery never hangs. A client connecting to a full server is
+  disconnected straight away.
+*/
+uint32_t VXI_Server::allocate()
+{
+    return vxi_port; // This is a cyclic counter, not a simple integer
 }
 
 void VXI_Server::begin(bool bNext)
 {
     if (bNext) {
-        client.stop();
-
         if (vxi_port.is_noncyclic()) return; // no need to change port, and the rest is already done
 
-        // counter is cyclic, so we need to stop the server and rotate to the next port
+        // counter is cyclic, so we need to stop the server and rotate to the next port.
+        // Connections already accepted stay open.
         LOG_F("Stop Listening for VXI commands on TCP port %u\n", (uint32_t)vxi_port);
         tcp_server.stop();
 
@@ -74,64 +88,146 @@ void VXI_Server::begin(bool bNext)
 
 void VXI_Server::loop()
 {
-    if (client) // if a connection has been established on port
-    {
-        bool bClose = false;
+    WiFiClient new_client = tcp_server.accept(); // see if a client is available (data has been sent on port)
+    if (new_client) {
+        bool accepted = false;
+        for (uint8_t i = 0; i < VXI_MAX_CONNECTIONS; i++) {
+            if (!connection_used[i]) {
+                clients[i] = new_client;
+                connection_used[i] = true;
+                accepted = true;
+                break;
+            }
+        }
+        if (accepted) {
+            LOG_F("\nVXI connection established on port %u\n", (uint32_t)vxi_port);
+            /*  Clients which need a port per link get the next one
+                from portmap.  */
+            begin_next();
+        } else {
+            LOG_LN("VXI_Server: no free connection, rejecting client.");
+            new_client.stop();
+        }
+    }
 
+    for (uint8_t i = 0; i < VXI_MAX_CONNECTIONS; i++) {
+        WiFiClient &client = clients[i];
+        record_reader &reader = readers[i];
+        if (!connection_used[i]) {
+            continue;
+        }
+        /*  A peer which has gone without leaving data is not
+            even a valid client, but its links must still be
+            released.  */
         if (!client.connected()) {
-            bClose = true;
-        } else {
-            int len = get_vxi_packet(client);
+            LOG_F("Closing VXI connection from %s\n", client.remoteIP().toString().c_str());
+            close_connection(i);
+            continue;
+        } else if (pending_requests[i].active) {
+            // retry the deferred request; requests on this connection wait behind it
+            handle_packet(i);
+        } else if (client.available() > 0) {
+            if (reader.data == nullptr && (reader.data = acquire_buffer()) == nullptr) {
+                continue; // leave the data in the socket until a buffer is free
+            }
+            reader.capacity = VXI_BUFFER_SIZE;
+            int len = get_rpc_record(client, reader);
 
             if (len > 0) {
-                bClose = handle_packet();
+                pending_requests[i].length = len;
+                pending_requests[i].started = millis();
+                handle_packet(i);
             }
         }
-
-        if (bClose) {
-            LOG_F("Closing VXI connection on port %u\n", (uint32_t)vxi_port);
-            /*  this method will stop the client and the tcp_server, then rotate
-                to the next port (within the specified range) and restart the
-                tcp_server to listen on that port.  */
-            begin_next();
+        if (!pending_requests[i].active && !reader.in_progress()) {
+            reader.data = nullptr; // return the buffer to the pool
         }
-    } else // i.e., if ! client
-    {
-        client = tcp_server.accept(); // see if a client is available (data has been sent on port)
+    }
 
-        if (client) {
-            LOG_F("\nVXI connection established on port %u\n", (uint32_t)vxi_port);
+    check_service_requests();
+}
+
+/*!
+  @return A buffer of VXI_BUFFER_SIZE not lent to any reader, or nullptr.
+*/
+uint8_t *VXI_Server::acquire_buffer()
+{
+    for (uint8_t *buffer : buffers) {
+        bool used = false;
+        for (record_reader &reader : readers) {
+            used = used || (reader.data == buffer);
+        }
+        if (!used) {
+            return buffer;
         }
     }
+    return nullptr;
 }
 
-bool VXI_Server::handle_packet()
+void VXI_Server::handle_packet(uint8_t connection)
 {
-    bool bClose = false;
     uint32_t rc = rpc::SUCCESS;
 
-    if (vxi_request->program != rpc::VXI_11_CORE) {
+    /*  A handler which has to wait sets the request
+        active again, see defer().  */
+    pending_requests[connection].active = false;
+
+    XDR_Reader request(readers[connection].data, pending_requests[connection].length);
+    rpc_call call;
+    bool valid = get_rpc_call(request, call);
+    request_xid = call.xid;
+    uint32_t procedure = call.procedure;
+
+    if (!valid) {
+        LOG_LN("ERROR: Invalid RPC call header");
+        rc = rpc::GARBAGE_ARGS;
+
+    } else if (call.program != rpc::VXI_11_CORE) {
         rc = rpc::PROG_UNAVAIL;
 
-        LOG_F("ERROR: Invalid program (expected VXI_11_CORE = 0x607AF; received 0x%08x)\n", (uint32_t)(vxi_request->program));
+        LOG_F("ERROR: Invalid program (expected VXI_11_CORE = 0x607AF; received 0x%08x)\n", call.program);
+
+    } else if (call.version != rpc::VXI_11_VERSION) {
+        rc = rpc::PROG_MISMATCH;
+
+        LOG_F("ERROR: Invalid VXI_11_CORE version %u\n", call.version);
 
     } else
-        switch (vxi_request->procedure) {
+        switch (procedure) {
         case rpc::VXI_11_CREATE_LINK:
-            create_link();
+            create_link(connection, request);
             break;
         case rpc::VXI_11_DEV_READ:
-            read();
+            read(connection, request);
             break;
         case rpc::VXI_11_DEV_WRITE:
-            write();
+            write(connection, request);
+            break;
+        case rpc::VXI_11_DEV_READSTB:
+        case rpc::VXI_11_DEV_TRIGGER:
+        case rpc::VXI_11_DEV_CLEAR:
+            generic(connection, request, procedure);
+            break;
+        case rpc::VXI_11_DEV_LOCK:
+            lock(connection, request);
+            break;
+        case rpc::VXI_11_DEV_UNLOCK:
+            unlock(connection, request);
+            break;
+        case rpc::VXI_11_DEV_ENABLE_SRQ:
+            enable_srq(connection, request);
             break;
         case rpc::VXI_11_DESTROY_LINK:
-            destroy_link();
-            bClose = true;
+            destroy_link(connection, request);
+            break;
+        case rpc::VXI_11_CREATE_INTR_CHAN:
+            create_intr_chan(connection, request);
+            break;
+        case rpc::VXI_11_DESTROY_INTR_CHAN:
+            destroy_intr_chan(connection);
             break;
         default:
-            LOG_F("Invalid VXI-11 procedure (received %u)\n", (uint32_t)(vxi_request->procedure));
+            LOG_F("Invalid VXI-11 procedure (received %u)\n", procedure);
             rc = rpc::PROC_UNAVAIL;
             break;
         }
@@ -142,90 +238,488 @@ bool VXI_Server::handle_packet()
         if rc != rpc::SUCCESS.  */
 
     if (rc != rpc::SUCCESS) {
-        vxi_response->rpc_status = rc;
-        send_vxi_packet(client, sizeof(rpc_response_packet));
+        XDR_Writer reply = begin_reply(rc);
+        if (rc == rpc::PROG_MISMATCH) {
+            reply.u32(rpc::VXI_11_VERSION); // lowest version supported
+            reply.u32(rpc::VXI_11_VERSION); // highest version supported
+        }
+        send_reply(connection, reply);
+    }
+}
+
+/*!
+  @brief  Stop a connection and destroy the links it created.
+*/
+void VXI_Server::close_connection(uint8_t connection)
+{
+    for (uint8_t i = 0; i < VXI_MAX_LINKS; i++) {
+        VXI_Link &link = links[i];
+        if (link.used && link.connection == connection) {
+            scpi_handler.release_control(link.handle);
+            if (lock_owner == i) {
+                lock_owner = -1;
+            }
+            link = VXI_Link();
+        }
     }
+    clients[connection].stop();
+    clients[connection] = WiFiClient();
+    connection_used[connection] = false;
+    readers[connection].reset();
+    readers[connection].data = nullptr;
+    pending_requests[connection] = VXI_Pending_Request();
+    intr_channels[connection].client.stop();
+    intr_channels[connection] = VXI_Interrupt_Channel();
+}
 
-    /*  signal to caller whether the connection should be close (i.e., DESTROY_LINK)  */
+/*!
+  @return The link with `link_id` created on `connection`, or nullptr.
+*/
+VXI_Link *VXI_Server::find_link(uint8_t connection, uint32_t link_id)
+{
+    for (VXI_Link &link : links) {
+        if (link.used && link.connection == connection && link.link_id == link_id) {
+            return &link;
+        }
+    }
+    LOG_F("ERROR: Invalid link id %u\n", link_id);
+    return nullptr;
+}
 
-    return bClose;
+/*!
+  @return True if another link holds the device lock.
+*/
+bool VXI_Server::is_locked_out(const VXI_Link &link)
+{
+    return lock_owner >= 0 && &links[lock_owner] != &link;
 }
 
-void VXI_Server::create_link()
+/*!
+  @brief  Keep the request of a connection to be handled again
+          from loop(), until `timeout` has passed since it arrived.
+
+  @return True if the request was deferred, false if it timed out.
+*/
+bool VXI_Server::defer(uint8_t connection, uint32_t timeout)
 {
-    /*  The data field in a link request should contain a string
-        with the name of the requesting device. It may already
-        be null-terminated, but just in case, we will put in
-        the terminator.  */
+    VXI_Pending_Request &pending = pending_requests[connection];
+    pending.active = (millis() - pending.started < timeout);
+    return pending.active;
+}
+
+/*!
+  @brief  Check that the link may use the device.
+
+  If another link holds the lock and the request has the WAIT_LOCK
+  flag, the request is deferred for up to `lock_timeout`. Otherwise
+  it is answered with DEVICE_LOCKED.
+
+  @param  response_words  Words following the error in the response of the request.
+  @return True if the request may go ahead.
+*/
+bool VXI_Server::check_lock(uint8_t connection, const VXI_Link &link, uint32_t flags, uint32_t lock_timeout, uint32_t response_words)
+{
+    if (!is_locked_out(link)) {
+        return true;
+    }
+    if (!(flags & rpc::WAIT_LOCK) || !defer(connection, lock_timeout)) {
+        send_error(connection, rpc::DEVICE_LOCKED, response_words);
+    }
+    return false;
+}
 
-    if (!scpi_handler.claim_control()) {
-        create_response->rpc_status = rpc::SUCCESS;
-        create_response->error = rpc::OUT_OF_RESOURCES; // not DEVICE_LOCKED because that would require lock_timeout etc
-        create_response->link_id = 0;
-        create_response->abort_port = 0;
-        create_response->max_receive_size = 0;
-        send_vxi_packet(client, sizeof(create_response_packet));
+/*!
+  @brief  Start the response to the request being handled.
+
+  The RPC reply header is encoded after the first 4 bytes of
+  the reply_buffer, which are left for the record mark.
+*/
+XDR_Writer VXI_Server::begin_reply(uint32_t rpc_status)
+{
+    XDR_Writer reply(reply_buffer + 4, VXI_BUFFER_SIZE - 4);
+    put_rpc_reply(reply, request_xid, rpc_status);
+    return reply;
+}
+
+void VXI_Server::send_reply(uint8_t connection, XDR_Writer &reply)
+{
+    send_rpc_record(clients[connection], reply_buffer, reply.length());
+}
+
+/*!
+  @brief  Answer the request with an error, followed by
+          `response_words` zero words for the rest of the response.
+*/
+void VXI_Server::send_error(uint8_t connection, uint32_t error, uint32_t response_words)
+{
+    XDR_Writer reply = begin_reply(rpc::SUCCESS);
+    reply.u32(error);
+    for (uint32_t i = 0; i < response_words; i++) {
+        reply.u32(0);
+    }
+    send_reply(connection, reply);
+}
+
+void VXI_Server::create_link(uint8_t connection, XDR_Reader &request)
+{
+    request.u32(); // client_id
+    bool lock_device = request.u32() != 0;
+    uint32_t lock_timeout = request.u32();
+    uint32_t device_len;
+    char *device = (char *)request.opaque(device_len);
+    if (request.failed()) {
+        send_error(connection, rpc::PARAMETER_ERROR, 3);
         return;
     }
 
-    create_request->data[create_request->data_len] = 0;
-    LOG_F("CREATE LINK request from \"%s\" on port %u\n", create_request->data, (uint32_t)vxi_port);
+    int free_link = -1;
+    for (uint8_t i = 0; i < VXI_MAX_LINKS; i++) {
+        if (!links[i].used) {
+            free_link = i;
+            break;
+        }
+    }
+    if (lock_device && lock_owner >= 0) {
+        // the lock timeout applies to the lock requested with the link
+        if (!defer(connection, lock_timeout)) {
+            send_error(connection, rpc::DEVICE_LOCKED, 3);
+        }
+        return;
+    }
+    int handle;
+    if (free_link < 0 || (handle = scpi_handler.claim_control(clients[connection].remoteIP())) < 0) {
+        // not enough links, or the raw socket clients hold the remaining SCPI sessions
+        send_error(connection, rpc::OUT_OF_RESOURCES, 3);
+        return;
+    }
+
+    VXI_Link &link = links[free_link];
+    link.used = true;
+    link.link_id = next_link_id++;
+    link.connection = connection;
+    link.handle = handle;
+    if (lock_device) {
+        lock_owner = free_link;
+    }
+    LOG_F("CREATE LINK %u request from \"%.*s\" on port %u\n", link.link_id, (int)device_len, device, (uint32_t)vxi_port);
     /*  Generate the response  */
-    create_response->rpc_status = rpc::SUCCESS;
-    create_response->error = rpc::NO_ERROR;
-    create_response->link_id = 0;
-    create_response->abort_port = 0;
-    create_response->max_receive_size = VXI_READ_SIZE - 4;
-    send_vxi_packet(client, sizeof(create_response_packet));
+    XDR_Writer reply = begin_reply(rpc::SUCCESS);
+    reply.u32(rpc::NO_ERROR);
+    reply.u32(link.link_id);
+    reply.u32(0); // abort_port
+    /*  The RPC header, with room for AUTH_UNIX credentials, and the
+        write request header share the buffer with the data.  */
+    reply.u32(VXI_BUFFER_SIZE - 128);
+    send_reply(connection, reply);
 }
 
-void VXI_Server::destroy_link()
+void VXI_Server::destroy_link(uint8_t connection, XDR_Reader &request)
 {
-    LOG_F("DESTROY LINK on port %u\n", (uint32_t)vxi_port);
-    destroy_response->rpc_status = rpc::SUCCESS;
-    destroy_response->error = rpc::NO_ERROR;
-    send_vxi_packet(client, sizeof(destroy_response_packet));
-    scpi_handler.release_control();
+    VXI_Link *link = find_link(connection, request.u32());
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 0);
+        return;
+    }
+    LOG_F("DESTROY LINK %u on port %u\n", link->link_id, (uint32_t)vxi_port);
+    scpi_handler.release_control(link->handle);
+    if (lock_owner == link - links) {
+        lock_owner = -1;
+    }
+    *link = VXI_Link();
+    send_error(connection, rpc::NO_ERROR, 0);
 }
 
-void VXI_Server::read()
+void VXI_Server::read(uint8_t connection, XDR_Reader &request)
 {
-    // This is where we read from the device
-    char outbuffer[256];
+    uint32_t link_id = request.u32();
+    uint32_t request_size = request.u32();
+    uint32_t io_timeout = request.u32();
+    uint32_t lock_timeout = request.u32();
+    uint32_t flags = request.u32();
+    uint32_t term_char_field = request.u32();
+    VXI_Link *link = find_link(connection, link_id);
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 2);
+        return;
+    }
+    if (!check_lock(connection, *link, flags, lock_timeout, 2)) {
+        return;
+    }
+    int term_char = (flags & rpc::TERM_CHR_SET) ? (int)(term_char_field & 0xff) : -1;
+
+    // This is where we read from the device, straight into the response.
+    // Long responses are returned over several reads, the last one with
+    // the END reason.
+    XDR_Writer reply = begin_reply(rpc::SUCCESS);
+    reply.u32(rpc::NO_ERROR);
+    uint32_t reason_position = reply.length();
+    reply.u32(0); // reason, filled in below
+    uint32_t space;
+    char *data = (char *)reply.begin_opaque(space);
+    size_t max_len = std::min(request_size, space);
     size_t len = 0;
-    scpi_result_t rv = scpi_handler.read(outbuffer, &len, sizeof(outbuffer));
-
-    // FIXME handle error codes, maybe even pick up errors from the SCPI Parser
-
-    LOG_F("READ DATA on port %u; data sent = %.*s\n", (uint32_t)vxi_port, (int)len, outbuffer);
-    read_response->rpc_status = rpc::SUCCESS;
-    read_response->error = rpc::NO_ERROR;
-    read_response->reason = rpc::END;
-    read_response->data_len = (uint32_t)len;
-    strcpy(read_response->data, outbuffer);
+    bool end = false;
+    if (scpi_handler.read(link->handle, data, &len, max_len, term_char, &end) != SCPI_RES_OK) {
+        // wait, without blocking the loop, until the response is ready
+        if (!defer(connection, io_timeout)) {
+            LOG_F("READ DATA on link %u timed out\n", link->link_id);
+            send_error(connection, rpc::IO_TIMEOUT, 2);
+        }
+        return;
+    }
 
-    send_vxi_packet(client, sizeof(read_response_packet) + len);
+    LOG_F("READ DATA on link %u; data sent = %.*s\n", link->link_id, (int)len, data);
+    uint32_t reason = 0;
+    if (end) {
+        reason |= rpc::END;
+    }
+    if (term_char >= 0 && len > 0 && data[len - 1] == (char)term_char) {
+        reason |= rpc::CHR;
+    }
+    if (len == request_size) {
+        reason |= rpc::REQCNT;
+    }
+    reply.end_opaque(len);
+    reply.u32_at(reason_position, reason);
+    send_reply(connection, reply);
 }
 
-void VXI_Server::write()
+void VXI_Server::write(uint8_t connection, XDR_Reader &request)
 {
-    // This is where we write to the device
-    uint32_t wlen = write_request->data_len;
+    uint32_t link_id = request.u32();
+    uint32_t io_timeout = request.u32();
+    uint32_t lock_timeout = request.u32();
+    uint32_t flags = request.u32();
+    uint32_t wlen;
+    char *data = (char *)request.opaque(wlen);
+    if (request.failed()) {
+        send_error(connection, rpc::PARAMETER_ERROR, 1);
+        return;
+    }
+    VXI_Link *link = find_link(connection, link_id);
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 1);
+        return;
+    }
+    if (!check_lock(connection, *link, flags, lock_timeout, 1)) {
+        return;
+    }
+    /*  The rate limit of the client holds the command back
+        for up to io_timeout.  */
+    if (!scpi_handler.can_write(link->handle, pending_requests[connection].started)) {
+        if (!defer(connection, io_timeout)) {
+            send_error(connection, rpc::IO_TIMEOUT, 1);
+        }
+        return;
+    }
     uint32_t len = wlen;
     // right trim. SCPI parser doesn't like \r\n
-    while (len > 0 && isspace(write_request->data[len - 1])) {
+    while (len > 0 && isspace(data[len - 1])) {
         len--;
     }
-    write_request->data[len] = 0;
-    LOG_F("WRITE DATA on port %u = \"%.*s\"\n", (uint32_t)vxi_port, (int)len, write_request->data);
-    /*  Parse and respond to the SCPI command  */
-    scpi_handler.write(write_request->data, len);
+    LOG_F("WRITE DATA on link %u = \"%.*s\"\n", link->link_id, (int)len, data);
+    /*  Parse and respond to the SCPI command, where it was received  */
+    scpi_handler.write(link->handle, data, len);
 
     /*  Generate the response  */
-    write_response->rpc_status = rpc::SUCCESS;
-    write_response->error = rpc::NO_ERROR;
-    write_response->size = wlen; // with the original length
-    send_vxi_packet(client, sizeof(write_response_packet));
+    XDR_Writer reply = begin_reply(rpc::SUCCESS);
+    reply.u32(rpc::NO_ERROR);
+    reply.u32(wlen); // with the original length
+    send_reply(connection, reply);
+}
+
+/*!
+  @brief  Handle DEV_READSTB, DEV_TRIGGER and DEV_CLEAR, which share
+          their request format.
+*/
+void VXI_Server::generic(uint8_t connection, XDR_Reader &request, uint32_t procedure)
+{
+    uint32_t link_id = request.u32();
+    uint32_t flags = request.u32();
+    uint32_t lock_timeout = request.u32();
+    uint32_t response_words = (procedure == rpc::VXI_11_DEV_READSTB) ? 1 : 0;
+    VXI_Link *link = find_link(connection, link_id);
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, response_words);
+        return;
+    }
+    if (!check_lock(connection, *link, flags, lock_timeout, response_words)) {
+        return;
+    }
+
+    XDR_Writer reply = begin_reply(rpc::SUCCESS);
+    reply.u32(rpc::NO_ERROR);
+    switch (procedure) {
+    case rpc::VXI_11_DEV_READSTB: {
+        uint8_t stb = scpi_handler.read_status_byte(link->handle);
+        LOG_F("READSTB on link %u = 0x%02x\n", link->link_id, stb);
+        reply.u32(stb);
+        break;
+    }
+    case rpc::VXI_11_DEV_TRIGGER:
+        LOG_F("TRIGGER on link %u\n", link->link_id);
+        scpi_handler.trigger(link->handle);
+        break;
+    default:
+        LOG_F("CLEAR on link %u\n", link->link_id);
+        scpi_handler.clear(link->handle);
+        break;
+    }
+    send_reply(connection, reply);
+}
+
+void VXI_Server::lock(uint8_t connection, XDR_Reader &request)
+{
+    uint32_t link_id = request.u32();
+    uint32_t flags = request.u32();
+    uint32_t lock_timeout = request.u32();
+    VXI_Link *link = find_link(connection, link_id);
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 0);
+        return;
+    }
+    if (!check_lock(connection, *link, flags, lock_timeout, 0)) {
+        return;
+    }
+    LOG_F("LOCK on link %u\n", link->link_id);
+    lock_owner = link - links;
+    send_error(connection, rpc::NO_ERROR, 0);
+}
+
+void VXI_Server::unlock(uint8_t connection, XDR_Reader &request)
+{
+    VXI_Link *link = find_link(connection, request.u32());
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 0);
+        return;
+    }
+    if (lock_owner != link - links) {
+        send_error(connection, rpc::NO_LOCK_HELD, 0);
+        return;
+    }
+    LOG_F("UNLOCK on link %u\n", link->link_id);
+    lock_owner = -1;
+    send_error(connection, rpc::NO_ERROR, 0);
+}
+
+void VXI_Server::enable_srq(uint8_t connection, XDR_Reader &request)
+{
+    uint32_t link_id = request.u32();
+    bool enable = request.u32() != 0;
+    uint32_t handle_len;
+    uint8_t *handle = request.opaque(handle_len);
+    VXI_Link *link = find_link(connection, link_id);
+    if (link == nullptr) {
+        send_error(connection, rpc::INVALID_LINK, 0);
+        return;
+    }
+    if (request.failed() || handle_len > sizeof(link->srq_handle)) {
+        send_error(connection, rpc::PARAMETER_ERROR, 0);
+        return;
+    }
+    link->srq_enabled = enable;
+    link->srq_handle_len = handle_len;
+    memcpy(link->srq_handle, handle, handle_len);
+    link->srq_asserted = false;
+    LOG_F("ENABLE SRQ on link %u = %d\n", link->link_id, link->srq_enabled);
+    send_error(connection, rpc::NO_ERROR, 0);
+}
+
+void VXI_Server::create_intr_chan(uint8_t connection, XDR_Reader &request)
+{
+    uint32_t host_addr = request.u32();
+    uint32_t host_port = request.u32();
+    uint32_t prog_num = request.u32();
+    request.u32(); // prog_vers
+    uint32_t prog_family = request.u32();
+    VXI_Interrupt_Channel &channel = intr_channels[connection];
+    if (channel.active) {
+        send_error(connection, rpc::DUPLICATE_CHANNEL, 0);
+        return;
+    }
+    if (request.failed() || prog_num != rpc::VXI_11_INTR) {
+        send_error(connection, rpc::PARAMETER_ERROR, 0);
+        return;
+    }
+    channel.host = IPAddress(htonl(host_addr));
+    channel.port = host_port;
+    channel.udp = (prog_family == rpc::INTR_UDP);
+    if (!channel.udp && !channel.client.connect(channel.host, channel.port)) {
+        LOG_F("ERROR: Interrupt channel to %s:%u failed\n", channel.host.toString().c_str(), channel.port);
+        send_error(connection, rpc::NO_CHANNEL, 0);
+        return;
+    }
+    channel.active = true;
+    LOG_F("CREATE INTR CHAN to %s:%u\n", channel.host.toString().c_str(), channel.port);
+    send_error(connection, rpc::NO_ERROR, 0);
+}
+
+void VXI_Server::destroy_intr_chan(uint8_t connection)
+{
+    VXI_Interrupt_Channel &channel = intr_channels[connection];
+    if (!channel.active) {
+        send_error(connection, rpc::NO_CHANNEL, 0);
+        return;
+    }
+    LOG_LN("DESTROY INTR CHAN");
+    channel.client.stop();
+    channel = VXI_Interrupt_Channel();
+    send_error(connection, rpc::NO_ERROR, 0);
+}
+
+/*!
+  @brief  Send a service request to the clients whose session
+          has started requesting service since the last check.
+*/
+void VXI_Server::check_service_requests()
+{
+    for (VXI_Link &link : links) {
+        if (!link.used || !link.srq_enabled || !intr_channels[link.connection].active) {
+            continue;
+        }
+        bool asserted = (scpi_handler.read_status_byte(link.handle) & STB_SRQ) != 0;
+        if (asserted && !link.srq_asserted) {
+            send_service_request(link);
+        }
+        link.srq_asserted = asserted;
+    }
+}
+
+/*!
+  @brief  Call VXI_11_INTR_SRQ on the interrupt channel of the link.
+          This is a one-way call, no response is expected.
+*/
+void VXI_Server::send_service_request(const VXI_Link &link)
+{
+    VXI_Interrupt_Channel &channel = intr_channels[link.connection];
+    uint8_t buffer[4 + 10 * 4 + sizeof(link.srq_handle)];
+    XDR_Writer srq(buffer + 4, sizeof(buffer) - 4); // the first 4 bytes take the record mark on TCP
+    srq.u32(next_srq_xid++);
+    srq.u32(rpc::CALL);
+    srq.u32(rpc::RPC_VERSION);
+    srq.u32(rpc::VXI_11_INTR);
+    srq.u32(rpc::VXI_11_VERSION);
+    srq.u32(rpc::VXI_11_INTR_SRQ);
+    srq.u32(0); // credentials flavor
+    srq.u32(0); // credentials length
+    srq.u32(0); // verifier flavor
+    srq.u32(0); // verifier length
+    srq.opaque(link.srq_handle, link.srq_handle_len);
+    uint32_t len = srq.length();
+
+    LOG_F("SRQ on link %u to %s:%u\n", link.link_id, channel.host.toString().c_str(), channel.port);
+    if (channel.udp) {
+        intr_udp.beginPacket(channel.host, channel.port);
+        intr_udp.write(buffer + 4, len);
+        intr_udp.endPacket();
+    } else {
+        uint32_t mark = 0x80000000 | len; // set the FRAG bit and the length
+        buffer[0] = mark >> 24;
+        buffer[1] = mark >> 16;
+        buffer[2] = mark >> 8;
+        buffer[3] = mark;
+        channel.client.write(buffer, len + 4);
+    }
 }
 
 const char *VXI_Server::get_visa_resource()
@@ -238,16 +732,19 @@ const char *VXI_Server::get_visa_resource()
 std::list<IPAddress> VXI_Server::get_connected_clients()
 {
     std::list<IPAddress> connected_clients;
-    if (client && client.connected()) {
-        connected_clients.push_back(client.remoteIP());
+    for (uint8_t i = 0; i < VXI_MAX_CONNECTIONS; i++) {
+        if (connection_used[i] && clients[i].connected()) {
+            connected_clients.push_back(clients[i].remoteIP());
+        }
     }
     return connected_clients;
 }
 
 void VXI_Server::disconnect_client(const IPAddress &ip)
 {
-    if (client && client.connected() && client.remoteIP() == ip) {
-        client.stop();
-        scpi_handler.release_control();
+    for (uint8_t i = 0; i < VXI_MAX_CONNECTIONS; i++) {
+        if (connection_used[i] && clients[i].connected() && clients[i].remoteIP() == ip) {
+            close_connection(i);
+        }
     }
 }
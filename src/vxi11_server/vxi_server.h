@@ -1,30 +1,104 @@
 #pragma once
 
+#include "rpc_packets.h"
 #include "utilities.h"
 #include "wifi_ext.h"
+#include "xdr.h"
 #include <ESP8266WiFi.h>
 #include <SCPI_Parser.h>
+#include <WiFiUdp.h>
 #include <list>
 
 /*!
   @brief  Interface with the rest of the device.
+
+  Every link gets a SCPI session of its own, identified by the
+  handle returned from claim_control().
 */
 class SCPI_handler_interface
 {
   public:
     virtual ~SCPI_handler_interface() {} 
-    // write a command to the SCPI parser
-    virtual void write(const char *data, size_t len) = 0;
-    // read a response from the SCPI parser
-    virtual scpi_result_t read(char *data, size_t *len, size_t max_len) = 0;
-    // claim_control() should return true if the SCPI parser is ready to accept a command
-    virtual bool claim_control() = 0;
-    // release_control() should be called when the SCPI parser is no longer needed
-    virtual void release_control() = 0;
+    // write a command to the SCPI parser, which parses it in place
+    virtual void write(int handle, char *data, size_t len) = 0;
+    // false while the rate limit of the client holds back the command received at received_at
+    virtual bool can_write(int handle, unsigned long received_at) = 0;
+    // read a response from the SCPI parser, stopping after term_char unless it is -1.
+    // end is set on its last part. Returns an error while no response is ready.
+    virtual scpi_result_t read(int handle, char *data, size_t *len, size_t max_len, int term_char, bool *end) = 0;
+    // claim_control() returns the handle of a new session for the client at ip, or -1 if the SCPI parser cannot take another one
+    virtual int claim_control(uint32_t ip) = 0;
+    // release_control() should be called when the session is no longer needed
+    virtual void release_control(int handle) = 0;
+    // the status byte of the session, including MAV when a response is waiting
+    virtual uint8_t read_status_byte(int handle) = 0;
+    // discard pending input and output of the session
+    virtual void clear(int handle) = 0;
+    // same as *TRG
+    virtual void trigger(int handle) = 0;
+};
+
+/*!
+  @brief  Limits of the VXI_Server tables.
+*/
+enum vxi_limits {
+    VXI_MAX_CONNECTIONS = 3, ///< TCP connections to the core channel
+    VXI_MAX_LINKS = 3,       ///< Links across all connections, each holding a SCPI session
+    VXI_BUFFER_COUNT = 2     ///< Buffers of VXI_BUFFER_SIZE lent to connections receiving a request
+};
+
+/*!
+  @brief  A link created by CREATE_LINK.
+
+  Several links may share a connection.
+*/
+struct VXI_Link {
+    bool used = false;
+    uint32_t link_id = 0;
+    uint8_t connection = 0; ///< Index into VXI_Server::clients
+    int handle = -1;        ///< SCPI session, see SCPI_handler_interface
+    bool srq_enabled = false;
+    bool srq_asserted = false; ///< The session was requesting service at the last check
+    uint8_t srq_handle[40];    ///< Passed back to the client with each service request
+    uint8_t srq_handle_len = 0;
+};
+
+/*!
+  @brief  The interrupt channel of a connection, on which
+          service requests are sent to the client.
+*/
+struct VXI_Interrupt_Channel {
+    bool active = false;
+    IPAddress host;
+    uint16_t port = 0;
+    bool udp = false;
+    WiFiClient client; ///< Unused on UDP
+};
+
+/*!
+  @brief  A request waiting for the device, its response or a lock.
+
+  The request stays in the buffer of its connection and is
+  handled again from the main loop, so the loop keeps running while
+  it waits. Requests on the same connection wait behind it.
+*/
+struct VXI_Pending_Request {
+    bool active = false;
+    uint32_t length = 0;       ///< Length of the request
+    unsigned long started = 0; ///< When the request arrived, for its timeouts
 };
 
 /*!
   @brief  Listens for and responds to VXI-11 requests.
+
+  Several clients may be connected at once, each with any number
+  of links, up to the limits in vxi_limits.
+
+  Requests are decoded where they were received, in a buffer lent
+  to the connection until the request is answered. A connection
+  without a buffer leaves its data in the socket until one is free.
+  Write data goes from that buffer straight to the SCPI parser, and
+  read data is fetched straight into the response.
 */
 class VXI_Server
 {
@@ -44,7 +118,7 @@ class VXI_Server
     void loop();
     void begin(bool bNext = false);
     void begin_next() { begin(true); }
-    bool available() { return (!client); }
+    bool available();
     uint32_t allocate();
     uint32_t port() { return vxi_port; }
     const char *get_visa_resource();
@@ -52,18 +126,46 @@ class VXI_Server
     void disconnect_client(const IPAddress &ip);
 
   protected:
-    void create_link();
-    void destroy_link();
-    void read();
-    void write();
-    bool handle_packet();
+    void create_link(uint8_t connection, XDR_Reader &request);
+    void destroy_link(uint8_t connection, XDR_Reader &request);
+    void read(uint8_t connection, XDR_Reader &request);
+    void write(uint8_t connection, XDR_Reader &request);
+    void generic(uint8_t connection, XDR_Reader &request, uint32_t procedure);
+    void lock(uint8_t connection, XDR_Reader &request);
+    void unlock(uint8_t connection, XDR_Reader &request);
+    void enable_srq(uint8_t connection, XDR_Reader &request);
+    void create_intr_chan(uint8_t connection, XDR_Reader &request);
+    void destroy_intr_chan(uint8_t connection);
+    void handle_packet(uint8_t connection);
+    void close_connection(uint8_t connection);
+    uint8_t *acquire_buffer();
+    VXI_Link *find_link(uint8_t connection, uint32_t link_id);
+    bool is_locked_out(const VXI_Link &link);
+    bool defer(uint8_t connection, uint32_t timeout);
+    bool check_lock(uint8_t connection, const VXI_Link &link, uint32_t flags, uint32_t lock_timeout, uint32_t response_words);
+    XDR_Writer begin_reply(uint32_t rpc_status);
+    void send_reply(uint8_t connection, XDR_Writer &reply);
+    void send_error(uint8_t connection, uint32_t error, uint32_t response_words);
+    void check_service_requests();
+    void send_service_request(const VXI_Link &link);
     void parse_scpi(char *buffer);
 
     WiFiServer_ext tcp_server;
-    WiFiClient client;
+    WiFiClient clients[VXI_MAX_CONNECTIONS];
+    bool connection_used[VXI_MAX_CONNECTIONS] = {}; ///< Until close_connection(), even after the peer has gone
+    record_reader readers[VXI_MAX_CONNECTIONS]; ///< Requests being received on each connection
+    uint8_t buffers[VXI_BUFFER_COUNT][VXI_BUFFER_SIZE]; ///< Lent to the readers, see acquire_buffer()
+    uint8_t reply_buffer[VXI_BUFFER_SIZE];              ///< Record mark and response being sent
+    uint32_t request_xid = 0;                           ///< Transaction id of the request being handled
+    VXI_Pending_Request pending_requests[VXI_MAX_CONNECTIONS];
+    VXI_Interrupt_Channel intr_channels[VXI_MAX_CONNECTIONS];
+    WiFiUDP intr_udp;          ///< Sends service requests on UDP interrupt channels
+    uint32_t next_srq_xid = 1; ///< Transaction id of the next service request
+    VXI_Link links[VXI_MAX_LINKS];
+    uint32_t next_link_id = 1;
+    int lock_owner = -1; ///< Index of the link holding the device lock, or -1
     Read_Type read_type;
     uint32_t rw_channel;
     cyclic_uint32_t vxi_port;
     SCPI_handler_interface &scpi_handler;
 };
-
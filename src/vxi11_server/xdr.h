@@ -0,0 +1,187 @@
+#pragma once
+
+/*!
+  @file   xdr.h
+  @brief  Cursors to decode and encode XDR data in place.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+/*!
+  @brief  Decodes XDR data from a buffer without copying it.
+
+  All XDR items are a multiple of 4 bytes, big-endian. Reading past
+  the end of the buffer returns zeros and marks the reader as failed,
+  so a request can be decoded first and checked once.
+*/
+class XDR_Reader
+{
+  private:
+    uint8_t *m_data;
+    uint32_t m_length;
+    uint32_t m_position = 0;
+    bool m_failed = false;
+
+  public:
+    /*!
+      @param  data    The XDR data; opaque data is returned by reference into it.
+      @param  length  Length of the data.
+    */
+    XDR_Reader(uint8_t *data, uint32_t length)
+        : m_data(data), m_length(length)
+    {
+    }
+
+    /*!
+      @return The next unsigned integer, or 0 if there is none.
+    */
+    uint32_t u32()
+    {
+        if (m_length - m_position < 4) {
+            m_failed = true;
+            m_position = m_length;
+            return 0;
+        }
+        const uint8_t *p = &m_data[m_position];
+        m_position += 4;
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    /*!
+      @brief  Variable-length opaque data or string.
+
+      @param  length  Set to the length of the data.
+      @return Pointer to the data within the buffer, or nullptr if it does not fit.
+    */
+    uint8_t *opaque(uint32_t &length)
+    {
+        length = u32();
+        uint32_t padded = (length + 3) & ~3u;
+        if (m_failed || length > m_length - m_position || padded > m_length - m_position) {
+            m_failed = true;
+            m_position = m_length;
+            length = 0;
+            return nullptr;
+        }
+        uint8_t *data = &m_data[m_position];
+        m_position += padded;
+        return data;
+    }
+
+    /*!
+      @brief  Skip an authentication field (flavor and opaque body).
+    */
+    void skip_auth()
+    {
+        u32();
+        uint32_t length;
+        opaque(length);
+    }
+
+    /*!
+      @return True if the data ended before all items were read.
+    */
+    bool failed() { return m_failed; }
+};
+
+/*!
+  @brief  Encodes XDR data into a buffer.
+
+  Writing past the end of the buffer is ignored and marks the
+  writer as failed.
+*/
+class XDR_Writer
+{
+  private:
+    uint8_t *m_data;
+    uint32_t m_capacity;
+    uint32_t m_position = 0;
+    bool m_failed = false;
+
+  public:
+    XDR_Writer(uint8_t *data, uint32_t capacity)
+        : m_data(data), m_capacity(capacity)
+    {
+    }
+
+    void u32(uint32_t value)
+    {
+        if (m_capacity - m_position < 4) {
+            m_failed = true;
+            return;
+        }
+        uint8_t *p = &m_data[m_position];
+        p[0] = value >> 24;
+        p[1] = value >> 16;
+        p[2] = value >> 8;
+        p[3] = value;
+        m_position += 4;
+    }
+
+    /*!
+      @brief  Overwrite an unsigned integer written before, for
+              values only known once later items are written.
+
+      @param  position  The length() before the value was written.
+    */
+    void u32_at(uint32_t position, uint32_t value)
+    {
+        if (position + 4 <= m_position) {
+            uint8_t *p = &m_data[position];
+            p[0] = value >> 24;
+            p[1] = value >> 16;
+            p[2] = value >> 8;
+            p[3] = value;
+        }
+    }
+
+    /*!
+      @brief  Start variable-length opaque data, to be filled in
+              place and completed with end_opaque().
+
+      @param  max_length  Set to the most data that fits.
+      @return Where to put the data.
+    */
+    uint8_t *begin_opaque(uint32_t &max_length)
+    {
+        uint32_t space = (m_capacity - m_position) & ~3u;
+        max_length = (space >= 4) ? space - 4 : 0;
+        return &m_data[m_position + 4];
+    }
+
+    /*!
+      @brief  Complete opaque data started by begin_opaque(),
+              adding its length and padding.
+    */
+    void end_opaque(uint32_t length)
+    {
+        u32(length);
+        uint32_t padded = (length + 3) & ~3u;
+        if (m_failed || padded > m_capacity - m_position) {
+            m_failed = true;
+            return;
+        }
+        memset(&m_data[m_position + length], 0, padded - length);
+        m_position += padded;
+    }
+
+    void opaque(const uint8_t *data, uint32_t length)
+    {
+        uint32_t max_length;
+        uint8_t *target = begin_opaque(max_length);
+        if (length > max_length) {
+            m_failed = true;
+            return;
+        }
+        memcpy(target, data, length);
+        end_opaque(length);
+    }
+
+    /*!
+      @return Length of the data written.
+    */
+    uint32_t length() { return m_position; }
+
+    bool failed() { return m_failed; }
+};